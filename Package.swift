@@ -356,6 +356,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/client/chttp2_connector.h",
         "src/core/ext/transport/chttp2/server/chttp2_server.cc",
         "src/core/ext/transport/chttp2/server/chttp2_server.h",
+        "src/core/ext/transport/chttp2/transport/base64_simd.cc",
+        "src/core/ext/transport/chttp2/transport/base64_simd.h",
         "src/core/ext/transport/chttp2/transport/bin_decoder.cc",
         "src/core/ext/transport/chttp2/transport/bin_decoder.h",
         "src/core/ext/transport/chttp2/transport/bin_encoder.cc",
@@ -389,6 +391,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/hpack_encoder.h",
         "src/core/ext/transport/chttp2/transport/hpack_encoder_table.cc",
         "src/core/ext/transport/chttp2/transport/hpack_encoder_table.h",
+        "src/core/ext/transport/chttp2/transport/hpack_interned_slices.cc",
+        "src/core/ext/transport/chttp2/transport/hpack_interned_slices.h",
         "src/core/ext/transport/chttp2/transport/hpack_parse_result.cc",
         "src/core/ext/transport/chttp2/transport/hpack_parse_result.h",
         "src/core/ext/transport/chttp2/transport/hpack_parser.cc",
@@ -411,8 +415,12 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/ping_callbacks.h",
         "src/core/ext/transport/chttp2/transport/ping_rate_policy.cc",
         "src/core/ext/transport/chttp2/transport/ping_rate_policy.h",
+        "src/core/ext/transport/chttp2/transport/read_ahead.cc",
+        "src/core/ext/transport/chttp2/transport/read_ahead.h",
         "src/core/ext/transport/chttp2/transport/stream_lists.cc",
         "src/core/ext/transport/chttp2/transport/stream_lists.h",
+        "src/core/ext/transport/chttp2/transport/stream_priority.cc",
+        "src/core/ext/transport/chttp2/transport/stream_priority.h",
         "src/core/ext/transport/chttp2/transport/varint.cc",
         "src/core/ext/transport/chttp2/transport/varint.h",
         "src/core/ext/transport/chttp2/transport/write_size_policy.cc",
@@ -1279,11 +1287,17 @@ let package = Package(
         "src/core/lib/channel/connected_channel.h",
         "src/core/lib/channel/promise_based_filter.cc",
         "src/core/lib/channel/promise_based_filter.h",
+        "src/core/lib/compression/adaptive_compression.cc",
+        "src/core/lib/compression/adaptive_compression.h",
         "src/core/lib/compression/compression.cc",
         "src/core/lib/compression/compression_internal.cc",
         "src/core/lib/compression/compression_internal.h",
         "src/core/lib/compression/message_compress.cc",
         "src/core/lib/compression/message_compress.h",
+        "src/core/lib/compression/streaming_compression.cc",
+        "src/core/lib/compression/streaming_compression.h",
+        "src/core/lib/compression/zstd_compression.cc",
+        "src/core/lib/compression/zstd_compression.h",
         "src/core/lib/debug/trace.cc",
         "src/core/lib/debug/trace.h",
         "src/core/lib/debug/trace_flags.cc",
@@ -1325,6 +1339,8 @@ let package = Package(
         "src/core/lib/event_engine/posix.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
@@ -1355,6 +1371,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
+        "src/core/lib/event_engine/posix_engine/timing_wheel.cc",
+        "src/core/lib/event_engine/posix_engine/timing_wheel.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.h",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc",
@@ -1376,6 +1394,8 @@ let package = Package(
         "src/core/lib/event_engine/tcp_socket_utils.h",
         "src/core/lib/event_engine/thread_local.cc",
         "src/core/lib/event_engine/thread_local.h",
+        "src/core/lib/event_engine/thread_pool/numa_topology.cc",
+        "src/core/lib/event_engine/thread_pool/numa_topology.h",
         "src/core/lib/event_engine/thread_pool/thread_count.cc",
         "src/core/lib/event_engine/thread_pool/thread_count.h",
         "src/core/lib/event_engine/thread_pool/thread_pool.h",
@@ -1404,6 +1424,8 @@ let package = Package(
         "src/core/lib/event_engine/windows/windows_listener.h",
         "src/core/lib/event_engine/work_queue/basic_work_queue.cc",
         "src/core/lib/event_engine/work_queue/basic_work_queue.h",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h",
         "src/core/lib/event_engine/work_queue/work_queue.h",
         "src/core/lib/experiments/config.cc",
         "src/core/lib/experiments/config.h",
@@ -1611,6 +1633,8 @@ let package = Package(
         "src/core/lib/security/authorization/stdout_logger.h",
         "src/core/lib/slice/percent_encoding.cc",
         "src/core/lib/slice/percent_encoding.h",
+        "src/core/lib/slice/slab_allocator.cc",
+        "src/core/lib/slice/slab_allocator.h",
         "src/core/lib/slice/slice.cc",
         "src/core/lib/slice/slice.h",
         "src/core/lib/slice/slice_buffer.cc",
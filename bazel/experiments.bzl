@@ -22,6 +22,7 @@ EXPERIMENT_ENABLES = {
     "chaotic_good_framing_layer": "chaotic_good_framing_layer",
     "chttp2_bound_write_size": "chttp2_bound_write_size",
     "error_flatten": "error_flatten",
+    "event_engine_chase_lev_work_queue": "event_engine_chase_lev_work_queue",
     "event_engine_client": "event_engine_client",
     "event_engine_dns": "event_engine_dns",
     "event_engine_dns_non_client_channel": "event_engine_dns_non_client_channel",
@@ -29,14 +30,20 @@ EXPERIMENT_ENABLES = {
     "event_engine_listener": "event_engine_listener",
     "event_engine_callback_cq": "event_engine_callback_cq,event_engine_client,event_engine_listener",
     "event_engine_for_all_other_endpoints": "event_engine_client,event_engine_dns,event_engine_dns_non_client_channel,event_engine_for_all_other_endpoints,event_engine_listener",
+    "event_engine_numa_aware_thread_pool": "event_engine_numa_aware_thread_pool",
+    "event_engine_queue_delay_scaling": "event_engine_queue_delay_scaling",
     "event_engine_secure_endpoint": "event_engine_secure_endpoint",
+    "event_engine_timing_wheel": "event_engine_timing_wheel",
     "free_large_allocator": "free_large_allocator",
+    "hpack_index_unknown_metadata": "hpack_index_unknown_metadata",
+    "hpack_intern_dynamic_table_values": "hpack_intern_dynamic_table_values",
     "keep_alive_ping_timer_batch": "keep_alive_ping_timer_batch",
     "local_connector_secure": "local_connector_secure",
     "max_inflight_pings_strict_limit": "max_inflight_pings_strict_limit",
     "max_pings_wo_data_throttle": "max_pings_wo_data_throttle",
     "monitoring_experiment": "monitoring_experiment",
     "multiping": "multiping",
+    "offload_large_decompression": "offload_large_decompression",
     "pollset_alternative": "event_engine_client,event_engine_listener,pollset_alternative",
     "posix_ee_skip_grpc_init": "posix_ee_skip_grpc_init",
     "promise_based_http2_client_transport": "promise_based_http2_client_transport",
@@ -50,6 +57,7 @@ EXPERIMENT_ENABLES = {
     "secure_endpoint_offload_large_writes": "event_engine_client,event_engine_listener,event_engine_secure_endpoint,secure_endpoint_offload_large_writes",
     "server_global_callbacks_ownership": "server_global_callbacks_ownership",
     "shard_global_connection_pool": "shard_global_connection_pool",
+    "slab_slice_allocator": "slab_slice_allocator",
     "sleep_promise_exec_ctx_removal": "sleep_promise_exec_ctx_removal",
     "tcp_frame_size_tuning": "tcp_frame_size_tuning",
     "tcp_rcv_lowat": "tcp_rcv_lowat",
@@ -78,15 +86,18 @@ EXPERIMENTS = {
                 "error_flatten",
                 "event_engine_fork",
                 "local_connector_secure",
+                "offload_large_decompression",
                 "pollset_alternative",
                 "retry_in_callv3",
                 "secure_endpoint_offload_large_reads",
                 "secure_endpoint_offload_large_writes",
+                "slab_slice_allocator",
             ],
             "cpp_end2end_test": [
                 "error_flatten",
             ],
             "endpoint_test": [
+                "slab_slice_allocator",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
@@ -96,16 +107,29 @@ EXPERIMENTS = {
             "event_engine_fork_test": [
                 "event_engine_fork",
             ],
+            "event_engine_thread_pool_test": [
+                "event_engine_chase_lev_work_queue",
+                "event_engine_numa_aware_thread_pool",
+                "event_engine_queue_delay_scaling",
+            ],
+            "event_engine_timer_test": [
+                "event_engine_timing_wheel",
+            ],
             "flow_control_test": [
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_index_unknown_metadata",
+                "hpack_intern_dynamic_table_values",
+            ],
             "promise_test": [
                 "sleep_promise_exec_ctx_removal",
             ],
             "resource_quota_test": [
                 "free_large_allocator",
+                "slab_slice_allocator",
                 "unconstrained_max_quota_buffer_size",
             ],
             "xds_end2end_test": [
@@ -153,15 +177,18 @@ EXPERIMENTS = {
                 "error_flatten",
                 "event_engine_fork",
                 "local_connector_secure",
+                "offload_large_decompression",
                 "pollset_alternative",
                 "retry_in_callv3",
                 "secure_endpoint_offload_large_reads",
                 "secure_endpoint_offload_large_writes",
+                "slab_slice_allocator",
             ],
             "cpp_end2end_test": [
                 "error_flatten",
             ],
             "endpoint_test": [
+                "slab_slice_allocator",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
@@ -171,16 +198,29 @@ EXPERIMENTS = {
             "event_engine_fork_test": [
                 "event_engine_fork",
             ],
+            "event_engine_thread_pool_test": [
+                "event_engine_chase_lev_work_queue",
+                "event_engine_numa_aware_thread_pool",
+                "event_engine_queue_delay_scaling",
+            ],
+            "event_engine_timer_test": [
+                "event_engine_timing_wheel",
+            ],
             "flow_control_test": [
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_index_unknown_metadata",
+                "hpack_intern_dynamic_table_values",
+            ],
             "promise_test": [
                 "sleep_promise_exec_ctx_removal",
             ],
             "resource_quota_test": [
                 "free_large_allocator",
+                "slab_slice_allocator",
                 "unconstrained_max_quota_buffer_size",
             ],
             "xds_end2end_test": [
@@ -228,15 +268,18 @@ EXPERIMENTS = {
                 "error_flatten",
                 "event_engine_fork",
                 "local_connector_secure",
+                "offload_large_decompression",
                 "pollset_alternative",
                 "retry_in_callv3",
                 "secure_endpoint_offload_large_reads",
                 "secure_endpoint_offload_large_writes",
+                "slab_slice_allocator",
             ],
             "cpp_end2end_test": [
                 "error_flatten",
             ],
             "endpoint_test": [
+                "slab_slice_allocator",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
@@ -246,16 +289,29 @@ EXPERIMENTS = {
             "event_engine_fork_test": [
                 "event_engine_fork",
             ],
+            "event_engine_thread_pool_test": [
+                "event_engine_chase_lev_work_queue",
+                "event_engine_numa_aware_thread_pool",
+                "event_engine_queue_delay_scaling",
+            ],
+            "event_engine_timer_test": [
+                "event_engine_timing_wheel",
+            ],
             "flow_control_test": [
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_index_unknown_metadata",
+                "hpack_intern_dynamic_table_values",
+            ],
             "promise_test": [
                 "sleep_promise_exec_ctx_removal",
             ],
             "resource_quota_test": [
                 "free_large_allocator",
+                "slab_slice_allocator",
                 "unconstrained_max_quota_buffer_size",
             ],
             "xds_end2end_test": [
@@ -0,0 +1,37 @@
+# Copyright 2025 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# zstd is optional: with the default "none" provider, the zstd compression
+# algorithm is built without libzstd and is never advertised to peers.
+if(gRPC_ZSTD_PROVIDER STREQUAL "none")
+  set(_gRPC_ZSTD_LIBRARIES)
+elseif(gRPC_ZSTD_PROVIDER STREQUAL "package")
+  find_package(zstd REQUIRED)
+  if(NOT zstd_FOUND)
+    message(FATAL_ERROR "gRPC_ZSTD_PROVIDER is \"package\" but zstd was not found")
+  endif()
+  if(TARGET zstd::libzstd)
+    set(_gRPC_ZSTD_LIBRARIES zstd::libzstd)
+  elseif(TARGET zstd::libzstd_shared)
+    set(_gRPC_ZSTD_LIBRARIES zstd::libzstd_shared)
+  elseif(TARGET zstd::libzstd_static)
+    set(_gRPC_ZSTD_LIBRARIES zstd::libzstd_static)
+  else()
+    set(_gRPC_ZSTD_LIBRARIES zstd)
+  endif()
+  add_definitions(-DGRPC_HAVE_ZSTD)
+  set(_gRPC_FIND_ZSTD "if(NOT zstd_FOUND)\n  find_package(zstd)\nendif()")
+else()
+  message(FATAL_ERROR "Unknown value for gRPC_ZSTD_PROVIDER = ${gRPC_ZSTD_PROVIDER}")
+endif()
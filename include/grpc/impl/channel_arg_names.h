@@ -142,6 +142,11 @@
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
+/** How long an http2 transport must have no active streams before it shrinks
+    its HPACK decoder table (by advertising a zero header table size to the
+    peer) and releases spare buffer capacity. Both are restored when the next
+    stream starts. Int valued, milliseconds. Defaults to 0 (disabled). */
+#define GRPC_ARG_HTTP2_IDLE_COMPACTION_MS "grpc.http2.idle_compaction_ms"
 /** An experimental channel arg which determines whether the preferred crypto
  * frame size http2 setting sent to the peer at startup. If set to 0 (false
  * - default), the preferred frame size is not sent to the peer. Otherwise it
@@ -286,10 +291,49 @@
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP TX Zerocopy adaptive tuning: if non-zero, the send threshold and the
+   maximum number of simultaneous sends above are only starting points, and
+   are tuned per connection from the measured cost of copying sends, zerocopy
+   sends and their completions, and from ENOBUFS errors. Only honored by the
+   posix EventEngine. By default, it is disabled. */
+#define GRPC_ARG_TCP_TX_ZEROCOPY_ADAPTIVE \
+  "grpc.experimental.tcp_tx_zerocopy_adaptive"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, large reads map payload pages from the socket with
+   TCP_ZEROCOPY_RECEIVE instead of copying them. Linux only. By default, it is
+   disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy threshold: only reads expected to return at least this many
+   bytes use TCP_ZEROCOPY_RECEIVE; smaller reads are copied. By default, this is
+   set to 256KB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_threshold"
+/* Busy-poll budget in microseconds for latency sensitive connections. When
+   positive, endpoint sockets get SO_BUSY_POLL (and SO_PREFER_BUSY_POLL) set to
+   this value, and while any of them is open the epoll1 poller of the
+   EventEngine serving them spins on epoll_wait() with a zero timeout for up to
+   this long before blocking, trading CPU for wakeup latency. The time spent
+   spinning is exported through stats. Linux only; only honored by the posix EventEngine. Default is 0 (disabled);
+   range is 0 to 1000000. */
+#define GRPC_ARG_TCP_BUSY_POLL_US "grpc.experimental.tcp_busy_poll_us"
 /* Overrides the TCP socket receive buffer size, SO_RCVBUF.
     Default value is -1(kReadBufferSizeUnset) indicating that the system will
     decide the buffer size. Range varies from 0 to INT_MAX. */
 #define GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE "grpc.tcp_receive_buffer_size"
+/* Maximum number of connections a listening socket accepts per readiness
+   notification before yielding to other work on the poller. Bounding the batch
+   keeps one busy listener from starving others during connection storms. Only
+   honored by the posix EventEngine. Default is 128; range is 1 to INT_MAX. */
+#define GRPC_ARG_TCP_SERVER_ACCEPT_BATCH_SIZE \
+  "grpc.experimental.tcp_server_accept_batch_size"
+/* Number of SO_REUSEPORT sockets a server opens for each bound TCP address.
+   Each socket gets its own accept queue and acceptor, so connection
+   establishment is spread across threads instead of funneling through one
+   listening socket. Requires GRPC_ARG_ALLOW_REUSEPORT; only honored by the
+   posix EventEngine. Default is 1 (a single socket per address). */
+#define GRPC_ARG_TCP_SERVER_LISTENER_SHARDS \
+  "grpc.experimental.tcp_server_listener_shards"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. Defaults to 0 ms. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
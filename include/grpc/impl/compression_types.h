@@ -49,11 +49,37 @@ extern "C" {
  * Its value is a bitset (an int). Bits correspond to algorithms in \a
  * grpc_compression_algorithm. For example, its LSB corresponds to
  * GRPC_COMPRESS_NONE, the next bit to GRPC_COMPRESS_DEFLATE, etc.
- * Unset bits disable support for the algorithm. By default all algorithms are
- * supported. It's not possible to disable GRPC_COMPRESS_NONE (the attempt will
- * be ignored). */
+ * Unset bits disable support for the algorithm. By default all algorithms the
+ * build supports are enabled. It's not possible to disable GRPC_COMPRESS_NONE
+ * (the attempt will be ignored). */
 #define GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET \
   "grpc.compression_enabled_algorithms_bitset"
+/** Level messages are compressed at with GRPC_COMPRESS_ZSTD, from zstd's own
+ * scale: 1 (fastest) to 22 (smallest), or negative for faster still. Int
+ * valued, defaults to 3. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL "grpc.zstd_compression_level"
+/** Pre-trained zstd dictionaries (the output of `zstd --train`), as a comma
+ * separated list of path_prefix=filename pairs. Messages of methods whose path
+ * starts with path_prefix (e.g. "/package.Service/") are compressed with that
+ * dictionary; the longest matching prefix wins. A filename without a prefix is
+ * only used to decompress, e.g. while rolling out a replacement. Both peers
+ * need a dictionary to use it: each advertises the ones it has, and only those
+ * are used. String valued. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARIES "grpc.zstd_dictionaries"
+/** Experimental: compress the messages a server sends on a call as one
+ * stream, so each can refer back to those before it, instead of one by one.
+ * Pays off for streams of small, similar messages, at the cost of holding a
+ * compressor (or decompressor) for the life of each call. Takes effect only
+ * when both peers enable it. Boolean, defaults to false. */
+#define GRPC_COMPRESSION_CHANNEL_CONTEXT_TAKEOVER \
+  "grpc.experimental.compression_context_takeover"
+/** Experimental: decide message by message whether compressing is worth the
+ * CPU. Messages that sample as incompressible (e.g. already compressed media
+ * or ciphertext) and calls whose messages keep not shrinking are sent
+ * uncompressed, as is everything while the process is using most of its
+ * cores. Boolean, defaults to false. */
+#define GRPC_COMPRESSION_CHANNEL_ADAPTIVE \
+  "grpc.experimental.adaptive_compression"
 /** \} */
 
 /** The various compression algorithms supported by gRPC (not sorted by
@@ -62,6 +88,10 @@ typedef enum {
   GRPC_COMPRESS_NONE = 0,
   GRPC_COMPRESS_DEFLATE,
   GRPC_COMPRESS_GZIP,
+  /** Only available in builds that define GRPC_HAVE_ZSTD and link libzstd,
+   * and never chosen for a compression level. Adding it raised
+   * GRPC_COMPRESS_ALGORITHMS_COUNT from 3 to 4: see doc/compression.md. */
+  GRPC_COMPRESS_ZSTD,
   /* TODO(ctiller): snappy */
   GRPC_COMPRESS_ALGORITHMS_COUNT
 } grpc_compression_algorithm;
@@ -79,9 +109,9 @@ typedef enum {
 } grpc_compression_level;
 
 typedef struct grpc_compression_options {
-  /** All algs are enabled by default. This option corresponds to the channel
-   * argument key behind \a GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET
-   */
+  /** All algs the build supports are enabled by default. This option
+   * corresponds to the channel argument key behind
+   * \a GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET */
   uint32_t enabled_algorithms_bitset;
 
   /** The default compression level. It'll be used in the absence of call
@@ -81,6 +81,21 @@ ABSL_FLAG(
     "EXPERIMENTAL: If non-zero, extend the lifetime of channelz nodes past the "
     "underlying object lifetime, up to this many nodes. The value may be "
     "adjusted slightly to account for implementation limits.");
+ABSL_FLAG(absl::optional<int32_t>,
+          grpc_event_engine_thread_pool_target_queue_delay_ms, {},
+          "EXPERIMENTAL: The queueing delay, in milliseconds, that the "
+          "EventEngine thread pool aims for when scaling its number of threads "
+          "by queue delay.");
+ABSL_FLAG(absl::optional<std::string>, grpc_slab_allocator_huge_pages, {},
+          "EXPERIMENTAL: How the slabs of the slab_slice_allocator experiment "
+          "are backed: 'none' for plain pages, 'transparent' to ask for "
+          "transparent huge pages, or 'hugetlb' to take them from the reserved "
+          "huge page pool first.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_slab_allocator_max_mb, {},
+          "EXPERIMENTAL: The most memory, in megabytes, the "
+          "slab_slice_allocator experiment maps for slices. Slices are "
+          "allocated with malloc beyond it. The memory mapped but not handed "
+          "out is charged to the default resource quota.");
 
 namespace grpc_core {
 
@@ -93,6 +108,13 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_channelz_max_orphaned_nodes,
                      "GRPC_CHANNELZ_MAX_ORPHANED_NODES",
                      overrides.channelz_max_orphaned_nodes, 0)),
+      event_engine_thread_pool_target_queue_delay_ms_(LoadConfig(
+          FLAGS_grpc_event_engine_thread_pool_target_queue_delay_ms,
+          "GRPC_EVENT_ENGINE_THREAD_POOL_TARGET_QUEUE_DELAY_MS",
+          overrides.event_engine_thread_pool_target_queue_delay_ms, 5)),
+      slab_allocator_max_mb_(LoadConfig(FLAGS_grpc_slab_allocator_max_mb,
+                                        "GRPC_SLAB_ALLOCATOR_MAX_MB",
+                                        overrides.slab_allocator_max_mb, 32)),
       enable_fork_support_(LoadConfig(
           FLAGS_grpc_enable_fork_support, "GRPC_ENABLE_FORK_SUPPORT",
           overrides.enable_fork_support, GRPC_ENABLE_FORK_SUPPORT_DEFAULT)),
@@ -119,6 +141,10 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           "TLS_AES_128_GCM_SHA256:TLS_AES_256_GCM_SHA384:TLS_CHACHA20_POLY1305_"
           "SHA256:ECDHE-ECDSA-AES128-GCM-SHA256:ECDHE-ECDSA-AES256-GCM-SHA384:"
           "ECDHE-RSA-AES128-GCM-SHA256:ECDHE-RSA-AES256-GCM-SHA384")),
+      slab_allocator_huge_pages_(LoadConfig(
+          FLAGS_grpc_slab_allocator_huge_pages,
+          "GRPC_SLAB_ALLOCATOR_HUGE_PAGES",
+          overrides.slab_allocator_huge_pages, "transparent")),
       experiments_(LoadConfig(FLAGS_grpc_experiments, "GRPC_EXPERIMENTS",
                               overrides.experiments, "")),
       trace_(LoadConfig(FLAGS_grpc_trace, "GRPC_TRACE", overrides.trace, "")),
@@ -156,7 +182,12 @@ std::string ConfigVars::ToString() const {
       ", ssl_cipher_suites: ", "\"", absl::CEscape(SslCipherSuites()), "\"",
       ", cpp_experimental_disable_reflection: ",
       CppExperimentalDisableReflection() ? "true" : "false",
-      ", channelz_max_orphaned_nodes: ", ChannelzMaxOrphanedNodes());
+      ", channelz_max_orphaned_nodes: ", ChannelzMaxOrphanedNodes(),
+      ", event_engine_thread_pool_target_queue_delay_ms: ",
+      EventEngineThreadPoolTargetQueueDelayMs(),
+      ", slab_allocator_huge_pages: ", "\"",
+      absl::CEscape(SlabAllocatorHugePages()), "\"",
+      ", slab_allocator_max_mb: ", SlabAllocatorMaxMb());
 }
 
 }  // namespace grpc_core
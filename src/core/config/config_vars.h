@@ -36,6 +36,8 @@ class GPR_DLL ConfigVars {
   struct Overrides {
     absl::optional<int32_t> client_channel_backup_poll_interval_ms;
     absl::optional<int32_t> channelz_max_orphaned_nodes;
+    absl::optional<int32_t> event_engine_thread_pool_target_queue_delay_ms;
+    absl::optional<int32_t> slab_allocator_max_mb;
     absl::optional<bool> enable_fork_support;
     absl::optional<bool> abort_on_leaks;
     absl::optional<bool> not_use_system_ssl_roots;
@@ -46,6 +48,7 @@ class GPR_DLL ConfigVars {
     absl::optional<std::string> system_ssl_roots_dir;
     absl::optional<std::string> default_ssl_roots_file_path;
     absl::optional<std::string> ssl_cipher_suites;
+    absl::optional<std::string> slab_allocator_huge_pages;
     absl::optional<std::string> experiments;
     absl::optional<std::string> trace;
   };
@@ -111,6 +114,22 @@ class GPR_DLL ConfigVars {
   int32_t ChannelzMaxOrphanedNodes() const {
     return channelz_max_orphaned_nodes_;
   }
+  // EXPERIMENTAL: The queueing delay, in milliseconds, that the EventEngine
+  // thread pool aims for when scaling its number of threads by queue delay.
+  int32_t EventEngineThreadPoolTargetQueueDelayMs() const {
+    return event_engine_thread_pool_target_queue_delay_ms_;
+  }
+  // EXPERIMENTAL: How the slabs of the slab_slice_allocator experiment are
+  // backed: 'none' for plain pages, 'transparent' to ask for transparent huge
+  // pages, or 'hugetlb' to take them from the reserved huge page pool first.
+  absl::string_view SlabAllocatorHugePages() const {
+    return slab_allocator_huge_pages_;
+  }
+  // EXPERIMENTAL: The most memory, in megabytes, the slab_slice_allocator
+  // experiment maps for slices. Slices are allocated with malloc beyond it.
+  // The memory mapped but not handed out is charged to the default resource
+  // quota.
+  int32_t SlabAllocatorMaxMb() const { return slab_allocator_max_mb_; }
 
  private:
   explicit ConfigVars(const Overrides& overrides);
@@ -118,6 +137,8 @@ class GPR_DLL ConfigVars {
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
   int32_t channelz_max_orphaned_nodes_;
+  int32_t event_engine_thread_pool_target_queue_delay_ms_;
+  int32_t slab_allocator_max_mb_;
   bool enable_fork_support_;
   bool abort_on_leaks_;
   bool not_use_system_ssl_roots_;
@@ -126,6 +147,7 @@ class GPR_DLL ConfigVars {
   std::string verbosity_;
   std::string poll_strategy_;
   std::string ssl_cipher_suites_;
+  std::string slab_allocator_huge_pages_;
   std::string experiments_;
   std::string trace_;
   absl::optional<std::string> override_system_ssl_roots_dir_;
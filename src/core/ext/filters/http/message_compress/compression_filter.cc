@@ -15,15 +15,19 @@
 #include "src/core/ext/filters/http/message_compress/compression_filter.h"
 
 #include <grpc/compression.h>
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/channel_arg_names.h>
 #include <grpc/impl/compression_types.h>
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>
 
 #include "absl/log/check.h"
@@ -35,23 +39,40 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/compression/adaptive_compression.h"
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/compression/streaming_compression.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/latch.h"
 #include "src/core/lib/promise/pipe.h"
 #include "src/core/lib/promise/prioritized_race.h"
+#include "src/core/lib/promise/wait_for_callback.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/latent_see.h"
 
 namespace grpc_core {
 
+namespace {
+
+// Not a registered metadata trait: peers that do not know it see unknown
+// metadata and ignore it, so takeover is never used with them.
+constexpr absl::string_view kContextTakeoverKey =
+    "grpc-compression-context-takeover";
+// Likewise: peers that do not advertise dictionaries are sent none.
+constexpr absl::string_view kZstdDictionariesKey = "grpc-zstd-dictionaries";
+
+}  // namespace
+
 const grpc_channel_filter ClientCompressionFilter::kFilter =
     MakePromiseBasedFilter<ClientCompressionFilter, FilterEndpoint::kClient,
                            kFilterExaminesServerInitialMetadata |
@@ -86,7 +107,37 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION).value_or(true)),
       enable_decompression_(
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION)
-              .value_or(true)) {
+              .value_or(true)),
+      zstd_level_(args.GetInt(GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL)
+                      .value_or(kDefaultZstdCompressionLevel)),
+      zstd_dictionaries_(args.GetObjectRef<ZstdDictionaries>()),
+      context_takeover_(
+          args.GetBool(GRPC_COMPRESSION_CHANNEL_CONTEXT_TAKEOVER)
+              .value_or(false)),
+      adaptive_(
+          args.GetBool(GRPC_COMPRESSION_CHANNEL_ADAPTIVE).value_or(false)),
+      decompression_offload_threshold_(
+          std::max(1, args.GetInt(GRPC_ARG_DECOMPRESSION_OFFLOAD_THRESHOLD)
+                          .value_or(256 * 1024))) {
+  if (zstd_dictionaries_ == nullptr) {
+    std::optional<absl::string_view> config =
+        args.GetString(GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARIES);
+    if (config.has_value()) {
+      auto dictionaries = ZstdDictionaries::FromConfig(*config);
+      if (dictionaries.ok()) {
+        zstd_dictionaries_ = std::move(*dictionaries);
+      } else {
+        LOG(ERROR) << "ignoring zstd dictionaries: " << dictionaries.status();
+      }
+    }
+  }
+  if (zstd_dictionaries_ != nullptr && zstd_dictionaries_->empty()) {
+    zstd_dictionaries_.reset();
+  }
+  if (zstd_dictionaries_ != nullptr && enable_decompression_ &&
+      enabled_compression_algorithms_.IsSet(GRPC_COMPRESS_ZSTD)) {
+    zstd_dictionary_ids_ = Slice::FromCopiedString(zstd_dictionaries_->IdList());
+  }
   // Make sure the default is enabled.
   if (!enabled_compression_algorithms_.IsSet(default_compression_algorithm_)) {
     const char* name;
@@ -100,9 +151,62 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
   }
 }
 
+void ChannelCompression::AdvertiseZstdDictionaries(
+    grpc_metadata_batch& metadata) const {
+  if (zstd_dictionary_ids_.empty()) return;
+  metadata.Append(kZstdDictionariesKey, zstd_dictionary_ids_.Ref(),
+                  [](absl::string_view, const Slice&) {});
+}
+
+const ZstdDictionary* ChannelCompression::ZstdDictionaryForPath(
+    const grpc_metadata_batch& client_metadata) const {
+  if (zstd_dictionaries_ == nullptr) return nullptr;
+  const Slice* path = client_metadata.get_pointer(HttpPathMetadata());
+  if (path == nullptr) return nullptr;
+  return zstd_dictionaries_->ForPath(path->as_string_view());
+}
+
+bool ChannelCompression::ZstdDictionaryAdvertised(
+    const ZstdDictionary* dictionary,
+    const grpc_metadata_batch& peer_metadata) {
+  if (dictionary == nullptr) return false;
+  std::string buffer;
+  std::optional<absl::string_view> ids =
+      peer_metadata.GetStringValue(kZstdDictionariesKey, &buffer);
+  return ids.has_value() &&
+         ZstdDictionaries::IdListContains(*ids, dictionary->id());
+}
+
+void ChannelCompression::OfferContextTakeover(
+    grpc_metadata_batch& client_metadata) const {
+  if (!context_takeover_) return;
+  client_metadata.Append(kContextTakeoverKey, Slice::FromStaticString("1"),
+                         [](absl::string_view, const Slice&) {});
+}
+
+bool ChannelCompression::ContextTakeoverOffered(
+    const grpc_metadata_batch& client_metadata) const {
+  if (!context_takeover_) return false;
+  std::string buffer;
+  return client_metadata.GetStringValue(kContextTakeoverKey, &buffer) == "1";
+}
+
+void ChannelCompression::AcceptContextTakeover(
+    grpc_metadata_batch& server_metadata) const {
+  server_metadata.Append(kContextTakeoverKey, Slice::FromStaticString("1"),
+                         [](absl::string_view, const Slice&) {});
+}
+
+bool ChannelCompression::ContextTakeoverAccepted(
+    const grpc_metadata_batch& server_metadata) const {
+  // Only a client that offered it may see it accepted.
+  return ContextTakeoverOffered(server_metadata);
+}
+
 MessageHandle ChannelCompression::CompressMessage(
-    MessageHandle message, grpc_compression_algorithm algorithm,
+    MessageHandle message, CompressArgs& args,
     CallTracerInterface* call_tracer) const {
+  const grpc_compression_algorithm algorithm = args.algorithm;
   GRPC_TRACE_LOG(compression, INFO)
       << "CompressMessage: len=" << message->payload()->Length()
       << " alg=" << algorithm << " flags=" << message->flags();
@@ -117,11 +221,51 @@ MessageHandle ChannelCompression::CompressMessage(
       (flags & (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS))) {
     return message;
   }
-  // Try to compress the payload.
-  SliceBuffer tmp;
   SliceBuffer* payload = message->payload();
-  bool did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
-                                        tmp.c_slice_buffer());
+  if (adaptive_) {
+    switch (args.adaptive_policy.Decide(payload->c_slice_buffer())) {
+      case AdaptiveCompressionPolicy::Decision::kCompress:
+        break;
+      case AdaptiveCompressionPolicy::Decision::kSkipIncompressible:
+        GRPC_TRACE_LOG(compression, INFO)
+            << "Not compressing: looks incompressible";
+        global_stats().IncrementCompressionSkippedIncompressible();
+        return message;
+      case AdaptiveCompressionPolicy::Decision::kSkipCpuBusy:
+        GRPC_TRACE_LOG(compression, INFO) << "Not compressing: CPU busy";
+        global_stats().IncrementCompressionSkippedCpuBusy();
+        return message;
+    }
+  }
+  // Try to compress the payload. Only with context takeover does the call
+  // keep its compressor from one message to the next: otherwise each idle call
+  // would hold the codec's state for nothing.
+  std::unique_ptr<StreamingCompressor> compressor = std::move(args.compressor);
+  if (compressor == nullptr) {
+    MessageCompressionOptions options;
+    options.zstd_level = zstd_level_;
+    options.zstd_dictionary = args.zstd_dictionary;
+    options.context_takeover = args.context_takeover;
+    compressor = MakeStreamingCompressor(algorithm, options);
+  }
+  SliceBuffer tmp;
+  const auto start = std::chrono::steady_clock::now();
+  bool did_compress =
+      compressor != nullptr &&
+      compressor->Compress(payload->c_slice_buffer(), tmp.c_slice_buffer());
+  if (args.context_takeover) args.compressor = std::move(compressor);
+  global_stats().IncrementCompressionTime(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+  if (did_compress && payload->Length() > 0) {
+    global_stats().IncrementCompressionRatio(100 * tmp.Length() /
+                                             payload->Length());
+  }
+  if (adaptive_) {
+    args.adaptive_policy.RecordResult(did_compress &&
+                                      tmp.Length() < payload->Length());
+  }
   // If we achieved compression send it as compressed, otherwise send it as (to
   // avoid spending cycles on the receiver decompressing).
   if (did_compress) {
@@ -154,41 +298,96 @@ MessageHandle ChannelCompression::CompressMessage(
   return message;
 }
 
-absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
-    bool is_client, MessageHandle message, DecompressArgs args,
+// What a decompression on the EventEngine works on. It may outlive the call,
+// so it owns all of it.
+struct ChannelCompression::DecompressPromise::Offload {
+  SliceBuffer payload;
+  grpc_compression_algorithm algorithm;
+  // Borrowed from, and returned to, the call's DecompressArgs.
+  std::unique_ptr<StreamingDecompressor> decompressor;
+  MessageCompressionOptions options;
+  // Keeps options.zstd_dictionaries alive.
+  RefCountedPtr<ZstdDictionaries> zstd_dictionaries;
+  SliceBuffer decompressed;
+  bool ok = false;
+  WaitForCallback done;
+};
+
+Poll<absl::StatusOr<MessageHandle>>
+ChannelCompression::DecompressPromise::operator()() {
+  if (offload_ == nullptr) return std::move(*result_);
+  if (offload_->done.MakeWaitPromise()().pending()) return Pending{};
+  args_->decompressor = std::move(offload_->decompressor);
+  auto result = compression_->FinishDecompression(
+      std::move(message_), offload_->ok, offload_->decompressed,
+      offload_->algorithm, call_tracer_);
+  offload_.reset();
+  return result;
+}
+
+absl::StatusOr<bool> ChannelCompression::PrepareDecompression(
+    bool is_client, const Message& message, const DecompressArgs& args,
     CallTracerInterface* call_tracer) const {
   GRPC_TRACE_LOG(compression, INFO)
-      << "DecompressMessage: len=" << message->payload()->Length()
+      << "DecompressMessage: len=" << message.payload()->Length()
       << " max=" << args.max_recv_message_length.value_or(-1)
       << " alg=" << args.algorithm;
   if (call_tracer != nullptr) {
-    call_tracer->RecordReceivedMessage(*message);
+    call_tracer->RecordReceivedMessage(message);
   }
   // Check max message length.
   if (args.max_recv_message_length.has_value() &&
-      message->payload()->Length() >
+      message.payload()->Length() >
           static_cast<size_t>(*args.max_recv_message_length)) {
     return absl::ResourceExhaustedError(absl::StrFormat(
         "%s: Received message larger than max (%u vs. %d)",
-        is_client ? "CLIENT" : "SERVER", message->payload()->Length(),
+        is_client ? "CLIENT" : "SERVER", message.payload()->Length(),
         *args.max_recv_message_length));
   }
   // Check if decompression is enabled (if not, we can just pass the message
   // up).
-  if (!enable_decompression_ ||
-      (message->flags() & GRPC_WRITE_INTERNAL_COMPRESS) == 0) {
-    return std::move(message);
+  return enable_decompression_ &&
+         (message.flags() & GRPC_WRITE_INTERNAL_COMPRESS) != 0;
+}
+
+MessageCompressionOptions ChannelCompression::DecompressionOptions(
+    DecompressArgs& args) const {
+  MessageCompressionOptions options;
+  options.zstd_dictionaries = zstd_dictionaries_.get();
+  options.context_takeover = args.context_takeover;
+  // With context takeover, the call's decompressor, created for its first
+  // compressed message. Otherwise each message is decompressed on its own.
+  if (args.context_takeover && args.decompressor == nullptr &&
+      args.algorithm != GRPC_COMPRESS_NONE) {
+    args.decompressor = MakeStreamingDecompressor(args.algorithm, options);
   }
-  // Try to decompress the payload.
-  SliceBuffer decompressed_slices;
-  if (grpc_msg_decompress(args.algorithm, message->payload()->c_slice_buffer(),
-                          decompressed_slices.c_slice_buffer()) == 0) {
+  return options;
+}
+
+bool ChannelCompression::Decompress(grpc_compression_algorithm algorithm,
+                                    StreamingDecompressor* decompressor,
+                                    const MessageCompressionOptions& options,
+                                    SliceBuffer* payload,
+                                    SliceBuffer* decompressed) {
+  if (decompressor != nullptr) {
+    return decompressor->Decompress(payload->c_slice_buffer(),
+                                    decompressed->c_slice_buffer());
+  }
+  return grpc_msg_decompress(algorithm, options, payload->c_slice_buffer(),
+                             decompressed->c_slice_buffer()) != 0;
+}
+
+absl::StatusOr<MessageHandle> ChannelCompression::FinishDecompression(
+    MessageHandle message, bool ok, SliceBuffer& decompressed,
+    grpc_compression_algorithm algorithm,
+    CallTracerInterface* call_tracer) const {
+  if (!ok) {
     return absl::InternalError(
         absl::StrCat("Unexpected error decompressing data for algorithm ",
-                     CompressionAlgorithmAsString(args.algorithm)));
+                     CompressionAlgorithmAsString(algorithm)));
   }
   // Swap the decompressed slices into the message.
-  message->payload()->Swap(&decompressed_slices);
+  message->payload()->Swap(&decompressed);
   message->mutable_flags() &= ~GRPC_WRITE_INTERNAL_COMPRESS;
   message->mutable_flags() |= GRPC_WRITE_INTERNAL_TEST_ONLY_WAS_COMPRESSED;
   if (call_tracer != nullptr) {
@@ -197,6 +396,63 @@ absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
   return std::move(message);
 }
 
+absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
+    bool is_client, MessageHandle message, DecompressArgs& args,
+    CallTracerInterface* call_tracer) const {
+  auto needed = PrepareDecompression(is_client, *message, args, call_tracer);
+  if (!needed.ok()) return needed.status();
+  if (!*needed) return std::move(message);
+  SliceBuffer decompressed_slices;
+  const MessageCompressionOptions options = DecompressionOptions(args);
+  const bool ok = Decompress(args.algorithm, args.decompressor.get(), options,
+                             message->payload(), &decompressed_slices);
+  return FinishDecompression(std::move(message), ok, decompressed_slices,
+                             args.algorithm, call_tracer);
+}
+
+ChannelCompression::DecompressPromise
+ChannelCompression::DecompressMessageAsync(
+    bool is_client, MessageHandle message, DecompressArgs& args,
+    CallTracerInterface* call_tracer) const {
+  DecompressPromise promise;
+  if (!IsOffloadLargeDecompressionEnabled() ||
+      message->payload()->Length() < decompression_offload_threshold_) {
+    promise.result_ = DecompressMessage(is_client, std::move(message), args,
+                                        call_tracer);
+    return promise;
+  }
+  auto needed = PrepareDecompression(is_client, *message, args, call_tracer);
+  if (!needed.ok() || !*needed) {
+    promise.result_ = needed.ok() ? absl::StatusOr<MessageHandle>(
+                                        std::move(message))
+                                  : needed.status();
+    return promise;
+  }
+  GRPC_TRACE_LOG(compression, INFO)
+      << "Offloading decompression of " << message->payload()->Length()
+      << " bytes";
+  auto offload = std::make_shared<DecompressPromise::Offload>();
+  offload->options = DecompressionOptions(args);
+  offload->payload.Swap(message->payload());
+  offload->algorithm = args.algorithm;
+  offload->decompressor = std::move(args.decompressor);
+  offload->zstd_dictionaries = zstd_dictionaries_;
+  GetContext<grpc_event_engine::experimental::EventEngine>()->Run(
+      [offload, done = offload->done.MakeCallback()]() mutable {
+        offload->ok = Decompress(offload->algorithm,
+                                 offload->decompressor.get(), offload->options,
+                                 &offload->payload, &offload->decompressed);
+        offload.reset();
+        done();
+      });
+  promise.offload_ = std::move(offload);
+  promise.message_ = std::move(message);
+  promise.compression_ = this;
+  promise.args_ = &args;
+  promise.call_tracer_ = call_tracer;
+  return promise;
+}
+
 grpc_compression_algorithm ChannelCompression::HandleOutgoingMetadata(
     grpc_metadata_batch& outgoing_metadata) {
   const auto algorithm = outgoing_metadata.Take(GrpcInternalEncodingRequest())
@@ -231,8 +487,11 @@ void ClientCompressionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, ClientCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnClientInitialMetadata");
-  compression_algorithm_ =
+  compress_args_.algorithm =
       filter->compression_engine_.HandleOutgoingMetadata(md);
+  zstd_dictionary_ = filter->compression_engine_.ZstdDictionaryForPath(md);
+  filter->compression_engine_.AdvertiseZstdDictionaries(md);
+  filter->compression_engine_.OfferContextTakeover(md);
   call_tracer_ = MaybeGetContext<CallTracerInterface>();
 }
 
@@ -241,7 +500,7 @@ MessageHandle ClientCompressionFilter::Call::OnClientToServerMessage(
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnClientToServerMessage");
   return filter->compression_engine_.CompressMessage(
-      std::move(message), compression_algorithm_, call_tracer_);
+      std::move(message), compress_args_, call_tracer_);
 }
 
 void ClientCompressionFilter::Call::OnServerInitialMetadata(
@@ -249,14 +508,20 @@ void ClientCompressionFilter::Call::OnServerInitialMetadata(
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnServerInitialMetadata");
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
+  decompress_args_.context_takeover =
+      filter->compression_engine_.ContextTakeoverAccepted(md);
+  if (ChannelCompression::ZstdDictionaryAdvertised(zstd_dictionary_, md)) {
+    // Messages sent so far went without it.
+    compress_args_.zstd_dictionary = zstd_dictionary_;
+  }
 }
 
-absl::StatusOr<MessageHandle>
+ChannelCompression::DecompressPromise
 ClientCompressionFilter::Call::OnServerToClientMessage(
     MessageHandle message, ClientCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnServerToClientMessage");
-  return filter->compression_engine_.DecompressMessage(
+  return filter->compression_engine_.DecompressMessageAsync(
       /*is_client=*/true, std::move(message), decompress_args_, call_tracer_);
 }
 
@@ -265,14 +530,21 @@ void ServerCompressionFilter::Call::OnClientInitialMetadata(
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnClientInitialMetadata");
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
+  const ZstdDictionary* zstd_dictionary =
+      filter->compression_engine_.ZstdDictionaryForPath(md);
+  if (ChannelCompression::ZstdDictionaryAdvertised(zstd_dictionary, md)) {
+    compress_args_.zstd_dictionary = zstd_dictionary;
+  }
+  context_takeover_offered_ =
+      filter->compression_engine_.ContextTakeoverOffered(md);
 }
 
-absl::StatusOr<MessageHandle>
+ChannelCompression::DecompressPromise
 ServerCompressionFilter::Call::OnClientToServerMessage(
     MessageHandle message, ServerCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnClientToServerMessage");
-  return filter->compression_engine_.DecompressMessage(
+  return filter->compression_engine_.DecompressMessageAsync(
       /*is_client=*/false, std::move(message), decompress_args_,
       MaybeGetContext<CallTracerInterface>());
 }
@@ -281,8 +553,14 @@ void ServerCompressionFilter::Call::OnServerInitialMetadata(
     ServerMetadata& md, ServerCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnServerInitialMetadata");
-  compression_algorithm_ =
+  compress_args_.algorithm =
       filter->compression_engine_.HandleOutgoingMetadata(md);
+  filter->compression_engine_.AdvertiseZstdDictionaries(md);
+  if (context_takeover_offered_ &&
+      compress_args_.algorithm != GRPC_COMPRESS_NONE) {
+    filter->compression_engine_.AcceptContextTakeover(md);
+    compress_args_.context_takeover = true;
+  }
 }
 
 MessageHandle ServerCompressionFilter::Call::OnServerToClientMessage(
@@ -290,7 +568,7 @@ MessageHandle ServerCompressionFilter::Call::OnServerToClientMessage(
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnServerToClientMessage");
   return filter->compression_engine_.CompressMessage(
-      std::move(message), compression_algorithm_,
+      std::move(message), compress_args_,
       MaybeGetContext<CallTracerInterface>());
 }
 
@@ -25,6 +25,7 @@
 #include <stdint.h>
 
 #include <cstddef>
+#include <memory>
 #include <optional>
 
 #include "absl/status/statusor.h"
@@ -33,10 +34,23 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/compression/adaptive_compression.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/compression/streaming_compression.h"
+#include "src/core/lib/compression/zstd_compression.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/transport.h"
 
+// Integer. The compressed size at which a received message is decompressed
+// on an EventEngine thread rather than inline, with the
+// offload_large_decompression experiment.
+#define GRPC_ARG_DECOMPRESSION_OFFLOAD_THRESHOLD \
+  "grpc.compression.decompression_offload_threshold"
+
 namespace grpc_core {
 
 /// Compression filter for messages.
@@ -60,6 +74,19 @@ namespace grpc_core {
 /// to incorporate GRPC_WRITE_INTERNAL_COMPRESS. Otherwise, and regardless of
 /// the aforementioned 'grpc-encoding' metadata value, data will pass through
 /// uncompressed.
+///
+/// With zstd dictionaries configured, each peer advertises theirs in its
+/// initial metadata. The server only compresses with a dictionary the client
+/// advertised; the client only does once the server's initial metadata
+/// advertised it, so that its earlier messages go without.
+///
+/// Messages are compressed one by one, unless context takeover was negotiated:
+/// with GRPC_COMPRESSION_CHANNEL_CONTEXT_TAKEOVER set on both sides, the client
+/// offers context takeover in its initial metadata and the server accepts in
+/// its own; the server's messages then share one compression context, which
+/// the call keeps (as the client keeps its decompression context) until it
+/// ends. Client messages are always compressed one by one: the client cannot
+/// know the server accepted before it sends its first.
 
 class ChannelCompression {
  public:
@@ -68,6 +95,19 @@ class ChannelCompression {
   struct DecompressArgs {
     grpc_compression_algorithm algorithm;
     std::optional<uint32_t> max_recv_message_length;
+    bool context_takeover = false;
+    // With context takeover, created for the first compressed message.
+    std::unique_ptr<StreamingDecompressor> decompressor;
+  };
+
+  struct CompressArgs {
+    grpc_compression_algorithm algorithm = GRPC_COMPRESS_NONE;
+    const ZstdDictionary* zstd_dictionary = nullptr;
+    bool context_takeover = false;
+    // With context takeover, created for the first message to compress.
+    std::unique_ptr<StreamingCompressor> compressor;
+    // Only consulted with GRPC_COMPRESSION_CHANNEL_ADAPTIVE.
+    AdaptiveCompressionPolicy adaptive_policy;
   };
 
   grpc_compression_algorithm default_compression_algorithm() const {
@@ -82,14 +122,54 @@ class ChannelCompression {
       grpc_metadata_batch& outgoing_metadata);
   DecompressArgs HandleIncomingMetadata(
       const grpc_metadata_batch& incoming_metadata);
+  // zstd dictionary negotiation: each peer advertises the dictionaries it can
+  // decompress with in its initial metadata, and a sender only uses the
+  // dictionary for the call's method if the receiver advertised it.
+  void AdvertiseZstdDictionaries(grpc_metadata_batch& metadata) const;
+  const ZstdDictionary* ZstdDictionaryForPath(
+      const grpc_metadata_batch& client_metadata) const;
+  static bool ZstdDictionaryAdvertised(
+      const ZstdDictionary* dictionary,
+      const grpc_metadata_batch& peer_metadata);
+
+  // Context takeover negotiation: the client offers in its initial metadata,
+  // the server accepts in its own if it was offered and it compresses.
+  void OfferContextTakeover(grpc_metadata_batch& client_metadata) const;
+  bool ContextTakeoverOffered(const grpc_metadata_batch& client_metadata) const;
+  void AcceptContextTakeover(grpc_metadata_batch& server_metadata) const;
+  bool ContextTakeoverAccepted(
+      const grpc_metadata_batch& server_metadata) const;
 
   // Compress one message synchronously.
-  MessageHandle CompressMessage(MessageHandle message,
-                                grpc_compression_algorithm algorithm,
+  MessageHandle CompressMessage(MessageHandle message, CompressArgs& args,
                                 CallTracerInterface* call_tracer) const;
   // Decompress one message synchronously.
   absl::StatusOr<MessageHandle> DecompressMessage(
-      bool is_client, MessageHandle message, DecompressArgs args,
+      bool is_client, MessageHandle message, DecompressArgs& args,
+      CallTracerInterface* call_tracer) const;
+
+  // Resolves to what DecompressMessage() returns. Large messages may be
+  // decompressed on the EventEngine, so that they do not hold up the other
+  // calls running on this thread; args must outlive the promise.
+  class DecompressPromise {
+   public:
+    Poll<absl::StatusOr<MessageHandle>> operator()();
+
+   private:
+    friend class ChannelCompression;
+    struct Offload;
+
+    // Set unless offloaded.
+    std::optional<absl::StatusOr<MessageHandle>> result_;
+    // Set while offloaded.
+    std::shared_ptr<Offload> offload_;
+    MessageHandle message_;
+    const ChannelCompression* compression_ = nullptr;
+    DecompressArgs* args_ = nullptr;
+    CallTracerInterface* call_tracer_ = nullptr;
+  };
+  DecompressPromise DecompressMessageAsync(
+      bool is_client, MessageHandle message, DecompressArgs& args,
       CallTracerInterface* call_tracer) const;
 
   Json::Object ToJsonObject() const {
@@ -106,6 +186,15 @@ class ChannelCompression {
         std::string(enabled_compression_algorithms_.ToString()));
     object["enableCompression"] = Json::FromBool(enable_compression_);
     object["enableDecompression"] = Json::FromBool(enable_decompression_);
+    if (enabled_compression_algorithms_.IsSet(GRPC_COMPRESS_ZSTD)) {
+      object["zstdLevel"] = Json::FromNumber(zstd_level_);
+      object["zstdDictionaries"] =
+          Json::FromBool(zstd_dictionaries_ != nullptr);
+    }
+    object["contextTakeover"] = Json::FromBool(context_takeover_);
+    object["adaptive"] = Json::FromBool(adaptive_);
+    object["decompressionOffloadThreshold"] =
+        Json::FromNumber(decompression_offload_threshold_);
     return object;
   }
 
@@ -121,6 +210,33 @@ class ChannelCompression {
   bool enable_compression_;
   // Is decompression enabled?
   bool enable_decompression_;
+  // zstd compression level.
+  int zstd_level_;
+  // zstd dictionaries, if any were configured.
+  RefCountedPtr<ZstdDictionaries> zstd_dictionaries_;
+  // Their ids, as advertised to peers; empty unless zstd is enabled.
+  Slice zstd_dictionary_ids_;
+  // Is context takeover enabled?
+  bool context_takeover_;
+  // Is adaptive compression enabled?
+  bool adaptive_;
+  // Compressed size from which to decompress on the EventEngine.
+  size_t decompression_offload_threshold_;
+
+  // Error, or whether message needs decompressing at all.
+  absl::StatusOr<bool> PrepareDecompression(
+      bool is_client, const Message& message, const DecompressArgs& args,
+      CallTracerInterface* call_tracer) const;
+  // Also creates the call's decompressor, if needed.
+  MessageCompressionOptions DecompressionOptions(DecompressArgs& args) const;
+  static bool Decompress(grpc_compression_algorithm algorithm,
+                         StreamingDecompressor* decompressor,
+                         const MessageCompressionOptions& options,
+                         SliceBuffer* payload, SliceBuffer* decompressed);
+  absl::StatusOr<MessageHandle> FinishDecompression(
+      MessageHandle message, bool ok, SliceBuffer& decompressed,
+      grpc_compression_algorithm algorithm,
+      CallTracerInterface* call_tracer) const;
 };
 
 class ClientCompressionFilter final
@@ -154,7 +270,7 @@ class ClientCompressionFilter final
 
     void OnServerInitialMetadata(ServerMetadata& md,
                                  ClientCompressionFilter* filter);
-    absl::StatusOr<MessageHandle> OnServerToClientMessage(
+    ChannelCompression::DecompressPromise OnServerToClientMessage(
         MessageHandle message, ClientCompressionFilter* filter);
 
     static inline const NoInterceptor OnClientToServerHalfClose;
@@ -162,8 +278,10 @@ class ClientCompressionFilter final
     static inline const NoInterceptor OnFinalize;
 
    private:
-    grpc_compression_algorithm compression_algorithm_;
+    ChannelCompression::CompressArgs compress_args_;
     ChannelCompression::DecompressArgs decompress_args_;
+    // Used for the messages sent once the server advertised it.
+    const ZstdDictionary* zstd_dictionary_ = nullptr;
     // TODO(yashykt): Remove call_tracer_ after migration to call v3 stack. (See
     // https://github.com/grpc/grpc/pull/38729 for more information.)
     CallTracerInterface* call_tracer_ = nullptr;
@@ -199,7 +317,7 @@ class ServerCompressionFilter final
    public:
     void OnClientInitialMetadata(ClientMetadata& md,
                                  ServerCompressionFilter* filter);
-    absl::StatusOr<MessageHandle> OnClientToServerMessage(
+    ChannelCompression::DecompressPromise OnClientToServerMessage(
         MessageHandle message, ServerCompressionFilter* filter);
 
     void OnServerInitialMetadata(ServerMetadata& md,
@@ -213,7 +331,8 @@ class ServerCompressionFilter final
 
    private:
     ChannelCompression::DecompressArgs decompress_args_;
-    grpc_compression_algorithm compression_algorithm_;
+    ChannelCompression::CompressArgs compress_args_;
+    bool context_takeover_offered_ = false;
   };
 
  private:
@@ -0,0 +1,423 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/base64_simd.h"
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <initializer_list>
+
+#include "absl/log/check.h"
+
+// The x86 kernels are compiled with per-function target attributes and picked
+// at runtime, so that a baseline build still uses them on CPUs that have
+// SSSE3 or AVX2. NEON is part of the AArch64 baseline, so it needs no runtime
+// check. Other compilers and architectures only get the scalar code.
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define GRPC_BASE64_SIMD_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define GRPC_BASE64_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace grpc_core {
+namespace base64_simd {
+
+namespace {
+
+#ifdef GRPC_BASE64_SIMD_X86
+
+// The kernels below follow "Faster Base64 Encoding and Decoding using AVX2
+// Instructions" (Muła & Lemire, 2018).
+
+// Spreads the first 12 bytes of in into 16 bytes holding one 6-bit base64
+// index each.
+__attribute__((target("ssse3"))) inline __m128i EncodeSplitSsse3(__m128i in) {
+  in = _mm_shuffle_epi8(
+      in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(t1, t3);
+}
+
+// Offsets to add to an index in each range of the alphabet: A-Z, a-z, ten
+// ranges for 0-9 (one per index from 52 to 61), +, and /.
+__attribute__((target("ssse3"))) inline __m128i EncodeOffsetsSsse3() {
+  return _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19,
+                       -16, 0, 0);
+}
+
+// Maps 6-bit indices to base64 characters.
+__attribute__((target("ssse3"))) inline __m128i EncodeTranslateSsse3(
+    __m128i indices) {
+  __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  range = _mm_sub_epi8(range, _mm_cmpgt_epi8(indices, _mm_set1_epi8(25)));
+  return _mm_add_epi8(indices,
+                      _mm_shuffle_epi8(EncodeOffsetsSsse3(), range));
+}
+
+__attribute__((target("ssse3"))) size_t EncodeSsse3(const uint8_t* in,
+                                                    size_t length,
+                                                    uint8_t* out) {
+  size_t consumed = 0;
+  // Each step loads 16 bytes and encodes the first 12 of them.
+  while (length - consumed >= 16) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + consumed));
+    block = EncodeTranslateSsse3(EncodeSplitSsse3(block));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), block);
+    consumed += 12;
+    out += 16;
+  }
+  return consumed;
+}
+
+// Tables used to validate base64 characters by their low and high nibbles: a
+// character is valid iff the entries for its two nibbles share no bits.
+__attribute__((target("ssse3"))) inline __m128i DecodeLowNibbleTableSsse3() {
+  return _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                       0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+}
+__attribute__((target("ssse3"))) inline __m128i DecodeHighNibbleTableSsse3() {
+  return _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10,
+                       0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+}
+// Offsets from a character to its index, by high nibble ('/' uses entry 1).
+__attribute__((target("ssse3"))) inline __m128i DecodeOffsetsSsse3() {
+  return _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0,
+                       0);
+}
+// Moves the 3 decoded bytes of each 32-bit lane to the front of the vector.
+__attribute__((target("ssse3"))) inline __m128i DecodePackShuffleSsse3() {
+  return _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+}
+
+__attribute__((target("ssse3"))) size_t DecodeSsse3(const uint8_t* in,
+                                                    size_t length,
+                                                    uint8_t* out,
+                                                    size_t out_length) {
+  size_t consumed = 0;
+  size_t produced = 0;
+  const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+  while (length - consumed >= 16 && out_length - produced >= 12) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + consumed));
+    const __m128i high_nibbles =
+        _mm_and_si128(_mm_srli_epi32(block, 4), nibble_mask);
+    const __m128i low_nibbles = _mm_and_si128(block, nibble_mask);
+    const __m128i high =
+        _mm_shuffle_epi8(DecodeHighNibbleTableSsse3(), high_nibbles);
+    const __m128i low =
+        _mm_shuffle_epi8(DecodeLowNibbleTableSsse3(), low_nibbles);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(low, high),
+                                         _mm_setzero_si128())) != 0xffff) {
+      break;
+    }
+    const __m128i is_slash = _mm_cmpeq_epi8(block, _mm_set1_epi8('/'));
+    block = _mm_add_epi8(
+        block, _mm_shuffle_epi8(DecodeOffsetsSsse3(),
+                                _mm_add_epi8(is_slash, high_nibbles)));
+    // Merge the four 6-bit indices of each 32-bit lane into 24 bits.
+    block = _mm_maddubs_epi16(block, _mm_set1_epi32(0x01400140));
+    block = _mm_madd_epi16(block, _mm_set1_epi32(0x00011000));
+    block = _mm_shuffle_epi8(block, DecodePackShuffleSsse3());
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + produced), block);
+    const uint32_t last = static_cast<uint32_t>(
+        _mm_cvtsi128_si32(_mm_srli_si128(block, 8)));
+    memcpy(out + produced + 8, &last, sizeof(last));
+    consumed += 16;
+    produced += 12;
+  }
+  return consumed;
+}
+
+__attribute__((target("avx2"))) size_t EncodeAvx2(const uint8_t* in,
+                                                  size_t length,
+                                                  uint8_t* out) {
+  const __m256i split_shuffle = _mm256_broadcastsi128_si256(
+      _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m256i offsets = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16,
+                    0, 0));
+  size_t consumed = 0;
+  // Each step encodes 24 bytes, 12 per 128-bit lane, and loads 28.
+  while (length - consumed >= 28) {
+    const uint8_t* p = in + consumed;
+    __m256i block = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 12)), 1);
+    block = _mm256_shuffle_epi8(block, split_shuffle);
+    const __m256i t0 = _mm256_and_si256(block, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(block, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t1, t3);
+    __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    range = _mm256_sub_epi8(
+        range, _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25)));
+    block = _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), block);
+    consumed += 24;
+    out += 32;
+  }
+  return consumed;
+}
+
+__attribute__((target("avx2"))) size_t DecodeAvx2(const uint8_t* in,
+                                                  size_t length,
+                                                  uint8_t* out,
+                                                  size_t out_length) {
+  const __m256i low_table = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a,
+      0x1b, 0x1b, 0x1b, 0x1a));
+  const __m256i high_table = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x10));
+  const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0));
+  const __m256i pack_shuffle = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+  size_t consumed = 0;
+  size_t produced = 0;
+  while (length - consumed >= 32 && out_length - produced >= 24) {
+    __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + consumed));
+    const __m256i high_nibbles =
+        _mm256_and_si256(_mm256_srli_epi32(block, 4), nibble_mask);
+    const __m256i low_nibbles = _mm256_and_si256(block, nibble_mask);
+    const __m256i high = _mm256_shuffle_epi8(high_table, high_nibbles);
+    const __m256i low = _mm256_shuffle_epi8(low_table, low_nibbles);
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_and_si256(low, high), _mm256_setzero_si256())) != -1) {
+      break;
+    }
+    const __m256i is_slash = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('/'));
+    block = _mm256_add_epi8(
+        block, _mm256_shuffle_epi8(offsets,
+                                   _mm256_add_epi8(is_slash, high_nibbles)));
+    block = _mm256_maddubs_epi16(block, _mm256_set1_epi32(0x01400140));
+    block = _mm256_madd_epi16(block, _mm256_set1_epi32(0x00011000));
+    block = _mm256_shuffle_epi8(block, pack_shuffle);
+    // Close the gap between the 12 bytes of each lane.
+    block = _mm256_permutevar8x32_epi32(
+        block, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + produced),
+                     _mm256_castsi256_si128(block));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + produced + 16),
+                     _mm256_extracti128_si256(block, 1));
+    consumed += 32;
+    produced += 24;
+  }
+  return consumed;
+}
+
+#endif  // GRPC_BASE64_SIMD_X86
+
+#ifdef GRPC_BASE64_SIMD_NEON
+
+constexpr uint8_t kAlphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+size_t EncodeNeon(const uint8_t* in, size_t length, uint8_t* out) {
+  uint8x16x4_t alphabet;
+  alphabet.val[0] = vld1q_u8(kAlphabet);
+  alphabet.val[1] = vld1q_u8(kAlphabet + 16);
+  alphabet.val[2] = vld1q_u8(kAlphabet + 32);
+  alphabet.val[3] = vld1q_u8(kAlphabet + 48);
+  const uint8x16_t low_6_bits = vdupq_n_u8(0x3f);
+  size_t consumed = 0;
+  // Each step encodes 48 bytes into 64 characters.
+  while (length - consumed >= 48) {
+    const uint8x16x3_t bytes = vld3q_u8(in + consumed);
+    uint8x16x4_t indices;
+    indices.val[0] = vshrq_n_u8(bytes.val[0], 2);
+    indices.val[1] = vandq_u8(
+        vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)),
+        low_6_bits);
+    indices.val[2] = vandq_u8(
+        vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)),
+        low_6_bits);
+    indices.val[3] = vandq_u8(bytes.val[2], low_6_bits);
+    uint8x16x4_t chars;
+    for (int i = 0; i < 4; i++) {
+      chars.val[i] = vqtbl4q_u8(alphabet, indices.val[i]);
+    }
+    vst4q_u8(out, chars);
+    consumed += 48;
+    out += 64;
+  }
+  return consumed;
+}
+
+// Maps base64 characters to their 6-bit indices, and sets every bit of
+// *invalid for lanes that do not hold a base64 character.
+inline uint8x16_t DecodeCharsNeon(uint8x16_t c, uint8x16_t* invalid) {
+  const uint8x16_t upper =
+      vcltq_u8(vsubq_u8(c, vdupq_n_u8('A')), vdupq_n_u8(26));
+  const uint8x16_t lower =
+      vcltq_u8(vsubq_u8(c, vdupq_n_u8('a')), vdupq_n_u8(26));
+  const uint8x16_t digit =
+      vcltq_u8(vsubq_u8(c, vdupq_n_u8('0')), vdupq_n_u8(10));
+  const uint8x16_t plus = vceqq_u8(c, vdupq_n_u8('+'));
+  const uint8x16_t slash = vceqq_u8(c, vdupq_n_u8('/'));
+  uint8x16_t index = vandq_u8(upper, vsubq_u8(c, vdupq_n_u8('A')));
+  index = vorrq_u8(index, vandq_u8(lower, vsubq_u8(c, vdupq_n_u8('a' - 26))));
+  index = vorrq_u8(index, vandq_u8(digit, vaddq_u8(c, vdupq_n_u8(52 - '0'))));
+  index = vorrq_u8(index, vandq_u8(plus, vdupq_n_u8(62)));
+  index = vorrq_u8(index, vandq_u8(slash, vdupq_n_u8(63)));
+  const uint8x16_t valid = vorrq_u8(
+      vorrq_u8(vorrq_u8(upper, lower), vorrq_u8(digit, plus)), slash);
+  *invalid = vorrq_u8(*invalid, vmvnq_u8(valid));
+  return index;
+}
+
+size_t DecodeNeon(const uint8_t* in, size_t length, uint8_t* out,
+                  size_t out_length) {
+  size_t consumed = 0;
+  size_t produced = 0;
+  // Each step decodes 64 characters into 48 bytes.
+  while (length - consumed >= 64 && out_length - produced >= 48) {
+    const uint8x16x4_t chars = vld4q_u8(in + consumed);
+    uint8x16_t invalid = vdupq_n_u8(0);
+    const uint8x16_t a = DecodeCharsNeon(chars.val[0], &invalid);
+    const uint8x16_t b = DecodeCharsNeon(chars.val[1], &invalid);
+    const uint8x16_t c = DecodeCharsNeon(chars.val[2], &invalid);
+    const uint8x16_t d = DecodeCharsNeon(chars.val[3], &invalid);
+    if (vmaxvq_u8(invalid) != 0) break;
+    uint8x16x3_t bytes;
+    bytes.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+    bytes.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+    bytes.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+    vst3q_u8(out + produced, bytes);
+    consumed += 64;
+    produced += 48;
+  }
+  return consumed;
+}
+
+#endif  // GRPC_BASE64_SIMD_NEON
+
+std::atomic<Kernel>& ActiveKernelStorage() {
+  static std::atomic<Kernel> kernel{BestKernel()};
+  return kernel;
+}
+
+}  // namespace
+
+bool KernelSupported(Kernel kernel) {
+  switch (kernel) {
+    case Kernel::kNone:
+      return true;
+    case Kernel::kSsse3:
+#ifdef GRPC_BASE64_SIMD_X86
+      return __builtin_cpu_supports("ssse3");
+#else
+      return false;
+#endif
+    case Kernel::kAvx2:
+#ifdef GRPC_BASE64_SIMD_X86
+      return __builtin_cpu_supports("avx2");
+#else
+      return false;
+#endif
+    case Kernel::kNeon:
+#ifdef GRPC_BASE64_SIMD_NEON
+      return true;
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+Kernel BestKernel() {
+  static const Kernel kernel = [] {
+    for (Kernel k : {Kernel::kAvx2, Kernel::kNeon, Kernel::kSsse3}) {
+      if (KernelSupported(k)) return k;
+    }
+    return Kernel::kNone;
+  }();
+  return kernel;
+}
+
+Kernel ActiveKernel() {
+  return ActiveKernelStorage().load(std::memory_order_relaxed);
+}
+
+void SetKernelForTesting(Kernel kernel) {
+  CHECK(KernelSupported(kernel));
+  ActiveKernelStorage().store(kernel, std::memory_order_relaxed);
+}
+
+const char* KernelName(Kernel kernel) {
+  switch (kernel) {
+    case Kernel::kNone:
+      return "none";
+    case Kernel::kSsse3:
+      return "ssse3";
+    case Kernel::kAvx2:
+      return "avx2";
+    case Kernel::kNeon:
+      return "neon";
+  }
+  return "unknown";
+}
+
+size_t Encode(Kernel kernel, const uint8_t* in, size_t length, uint8_t* out) {
+  switch (kernel) {
+#ifdef GRPC_BASE64_SIMD_X86
+    case Kernel::kSsse3:
+      return EncodeSsse3(in, length, out);
+    case Kernel::kAvx2:
+      return EncodeAvx2(in, length, out);
+#endif
+#ifdef GRPC_BASE64_SIMD_NEON
+    case Kernel::kNeon:
+      return EncodeNeon(in, length, out);
+#endif
+    default:
+      return 0;
+  }
+}
+
+size_t Decode(Kernel kernel, const uint8_t* in, size_t length, uint8_t* out,
+              size_t out_length) {
+  switch (kernel) {
+#ifdef GRPC_BASE64_SIMD_X86
+    case Kernel::kSsse3:
+      return DecodeSsse3(in, length, out, out_length);
+    case Kernel::kAvx2:
+      return DecodeAvx2(in, length, out, out_length);
+#endif
+#ifdef GRPC_BASE64_SIMD_NEON
+    case Kernel::kNeon:
+      return DecodeNeon(in, length, out, out_length);
+#endif
+    default:
+      return 0;
+  }
+}
+
+}  // namespace base64_simd
+}  // namespace grpc_core
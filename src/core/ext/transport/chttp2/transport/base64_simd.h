@@ -0,0 +1,78 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_BASE64_SIMD_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_BASE64_SIMD_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Vectorized kernels for the bulk of base64 encoding and decoding of -bin
+// metadata. The kernels only handle whole blocks in the middle of the input;
+// bin_encoder.cc and bin_decoder.cc finish the tail, padding and error
+// reporting with their scalar loops, so the output is identical to the scalar
+// code for every input.
+
+namespace grpc_core {
+namespace base64_simd {
+
+enum class Kernel {
+  // No vector kernel: the callers' scalar loops do all the work.
+  kNone,
+  // 16 bytes of base64 per step, x86 with SSSE3.
+  kSsse3,
+  // 32 bytes of base64 per step, x86 with AVX2.
+  kAvx2,
+  // 64 bytes of base64 per step, AArch64 with NEON.
+  kNeon,
+};
+
+// Returns whether `kernel` was compiled in and can run on this CPU.
+bool KernelSupported(Kernel kernel);
+
+// Returns the fastest kernel this CPU supports. Detected once per process.
+Kernel BestKernel();
+
+// Returns the kernel used by bin_encoder.cc and bin_decoder.cc: BestKernel(),
+// unless SetKernelForTesting() picked another one.
+Kernel ActiveKernel();
+
+// Overrides ActiveKernel(), e.g. to compare kernels in benchmarks. `kernel`
+// must be supported.
+void SetKernelForTesting(Kernel kernel);
+
+const char* KernelName(Kernel kernel);
+
+// The functions below must only be passed kernels for which KernelSupported()
+// returns true. Kernel::kNone consumes nothing.
+
+// Encodes a prefix of in[0, length) as unpadded base64 into out, and returns
+// the number of input bytes consumed, which is always a multiple of 3. out
+// receives 4 characters for every 3 bytes consumed, and must have room for
+// the whole encoding of the input.
+size_t Encode(Kernel kernel, const uint8_t* in, size_t length, uint8_t* out);
+
+// Decodes a prefix of in[0, length) into out[0, out_length), and returns the
+// number of input characters consumed, which is always a multiple of 4. out
+// receives 3 bytes for every 4 characters consumed. Stops before the first
+// block that contains anything other than the 64 base64 characters (padding
+// included), so that the caller can deal with it.
+size_t Decode(Kernel kernel, const uint8_t* in, size_t length, uint8_t* out,
+              size_t out_length);
+
+}  // namespace base64_simd
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_BASE64_SIMD_H
@@ -24,6 +24,7 @@
 #include "absl/base/attributes.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "src/core/ext/transport/chttp2/transport/base64_simd.h"
 #include "src/core/lib/slice/slice.h"
 
 static uint8_t decode_table[] = {
@@ -106,6 +107,15 @@ bool grpc_base64_decode_partial(struct grpc_base64_decode_context* ctx) {
     return false;
   }
 
+  // Let the vector kernel decode as many blocks as it can. It stops at the
+  // first block with invalid or padding characters, which are handled below.
+  size_t simd_length = grpc_core::base64_simd::Decode(
+      grpc_core::base64_simd::ActiveKernel(), ctx->input_cur,
+      static_cast<size_t>(ctx->input_end - ctx->input_cur), ctx->output_cur,
+      static_cast<size_t>(ctx->output_end - ctx->output_cur));
+  ctx->input_cur += simd_length;
+  ctx->output_cur += simd_length / 4 * 3;
+
   // Process a block of 4 input characters and 3 output bytes
   while (ctx->input_end >= ctx->input_cur + 4 &&
          ctx->output_end >= ctx->output_cur + 3) {
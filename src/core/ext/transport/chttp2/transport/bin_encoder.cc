@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include "absl/log/check.h"
+#include "src/core/ext/transport/chttp2/transport/base64_simd.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 
 static const char alphabet[] =
@@ -57,8 +58,15 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   char* out = reinterpret_cast<char*> GRPC_SLICE_START_PTR(output);
   size_t i;
 
-  // encode full triplets
-  for (i = 0; i < input_triplets; i++) {
+  // let the vector kernel encode as many full triplets as it can
+  size_t simd_length = grpc_core::base64_simd::Encode(
+      grpc_core::base64_simd::ActiveKernel(), in, input_length,
+      reinterpret_cast<uint8_t*>(out));
+  in += simd_length;
+  out += simd_length / 3 * 4;
+
+  // encode the remaining full triplets
+  for (i = simd_length / 3; i < input_triplets; i++) {
     out[0] = alphabet[in[0] >> 2];
     out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
     out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
@@ -109,17 +117,28 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   out = GRPC_SLICE_START_PTR(output);
   for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
        ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*in];
+    temp = (temp << sym.length) | sym.bits;
+    temp_length += sym.length;
+
+    // flush 32 bits at a time: codes are at most 30 bits long, so temp never
+    // holds more than 61 pending bits
+    if (temp_length >= 32) {
+      temp_length -= 32;
+      const uint32_t word = static_cast<uint32_t>(temp >> temp_length);
+      out[0] = static_cast<uint8_t>(word >> 24);
+      out[1] = static_cast<uint8_t>(word >> 16);
+      out[2] = static_cast<uint8_t>(word >> 8);
+      out[3] = static_cast<uint8_t>(word);
+      out += 4;
     }
   }
 
+  while (temp_length >= 8) {
+    temp_length -= 8;
+    *out++ = static_cast<uint8_t>(temp >> temp_length);
+  }
+
   if (temp_length) {
     // NB: the following integer arithmetic operation needs to be in its
     // expanded form due to the "integral promotion" performed (see section
@@ -157,6 +157,11 @@ static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                              grpc_error_handle error);
 static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void write_coalescing_timer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void resume_held_write(grpc_chttp2_transport* t);
+static void control_frame_timer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
 
 static void read_action(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                         grpc_error_handle error);
@@ -164,6 +169,10 @@ static void read_action_locked(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                                grpc_error_handle error);
 static void continue_read_action_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t);
+static void read_ahead(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
+                       grpc_error_handle error);
+static void read_ahead_locked(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
+                              grpc_error_handle error);
 
 static void close_from_api(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
                            grpc_error_handle error, bool tarpit);
@@ -184,6 +193,11 @@ static void destructive_reclaimer_locked(
 static void post_benign_reclaimer(grpc_chttp2_transport* t);
 static void post_destructive_reclaimer(grpc_chttp2_transport* t);
 
+static void schedule_idle_compaction(grpc_chttp2_transport* t);
+static void cancel_idle_compaction(grpc_chttp2_transport* t);
+static void idle_compaction_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+
 static void close_transport_locked(grpc_chttp2_transport* t,
                                    grpc_error_handle error);
 static void end_all_the_calls(grpc_chttp2_transport* t,
@@ -450,6 +464,61 @@ static void read_channel_args(grpc_chttp2_transport* t,
             .value_or(g_default_server_keepalive_permit_without_calls);
   }
 
+  const auto idle_compaction_period =
+      channel_args.GetDurationFromIntMillis(GRPC_ARG_HTTP2_IDLE_COMPACTION_MS);
+  if (idle_compaction_period.has_value() &&
+      *idle_compaction_period > grpc_core::Duration::Zero()) {
+    t->idle_compaction_period = *idle_compaction_period;
+  }
+
+  const auto write_coalescing_max_delay =
+      channel_args.GetDurationFromIntMillis(
+          GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_DELAY_MS);
+  if (write_coalescing_max_delay.has_value() &&
+      *write_coalescing_max_delay > grpc_core::Duration::Zero()) {
+    t->write_coalescing_policy = grpc_core::Chttp2WriteCoalescingPolicy(
+        *write_coalescing_max_delay,
+        std::max(0,
+                 channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_BYTES)
+                     .value_or(0)),
+        std::max(
+            0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_FRAMES)
+                   .value_or(64)));
+  }
+
+  t->read_ahead_enabled =
+      channel_args.GetBool(GRPC_ARG_HTTP2_READ_AHEAD).value_or(false);
+
+  t->control_frame_max_delay = std::max(
+      grpc_core::Duration::Zero(),
+      channel_args
+          .GetDurationFromIntMillis(GRPC_ARG_HTTP2_CONTROL_FRAME_MAX_DELAY_MS)
+          .value_or(grpc_core::Duration::Zero()));
+
+  const std::optional<absl::string_view> window_policy =
+      channel_args.GetString(GRPC_ARG_HTTP2_FLOW_CONTROL_WINDOW_POLICY);
+  if (window_policy.has_value()) {
+    const auto policy = grpc_core::chttp2::ParseWindowPolicy(*window_policy);
+    if (policy.has_value()) {
+      t->flow_control.set_window_policy(*policy);
+    } else {
+      LOG(ERROR) << "Invalid " << GRPC_ARG_HTTP2_FLOW_CONTROL_WINDOW_POLICY
+                 << " '" << *window_policy << "', using the default";
+    }
+  }
+
+  const int stream_write_quantum =
+      channel_args.GetInt(GRPC_ARG_HTTP2_STREAM_WRITE_QUANTUM_BYTES)
+          .value_or(0);
+  if (stream_write_quantum > 0) {
+    // Smaller turns would split DATA frames into many tiny ones.
+    t->stream_write_quantum =
+        static_cast<uint32_t>(std::max(stream_write_quantum, 1024));
+  }
+  t->accept_stream_priority =
+      channel_args.GetBool(GRPC_ARG_HTTP2_ACCEPT_STREAM_PRIORITY)
+          .value_or(false);
+
   t->settings_timeout =
       channel_args.GetDurationFromIntMillis(GRPC_ARG_SETTINGS_TIMEOUT)
           .value_or(std::max(t->keepalive_timeout * 2,
@@ -794,6 +863,7 @@ grpc_chttp2_transport::grpc_chttp2_transport(
 
   grpc_chttp2_initiate_write(this, GRPC_CHTTP2_INITIATE_WRITE_INITIAL_WRITE);
   post_benign_reclaimer(this);
+  schedule_idle_compaction(this);
   if (grpc_core::test_only_init_callback != nullptr) {
     grpc_core::test_only_init_callback();
   }
@@ -837,6 +907,8 @@ static void close_transport_locked(grpc_chttp2_transport* t,
       }
       t->close_transport_on_writes_finished =
           grpc_error_add_child(t->close_transport_on_writes_finished, error);
+      // Don't wait for a write held for coalescing: flush it now.
+      resume_held_write(t);
       return;
     }
     CHECK(!error.ok());
@@ -859,6 +931,18 @@ static void close_transport_locked(grpc_chttp2_transport* t,
         t->event_engine->Cancel(t->next_bdp_ping_timer_handle)) {
       t->next_bdp_ping_timer_handle = TaskHandle::kInvalid;
     }
+    if (t->idle_compaction_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->idle_compaction_timer_handle)) {
+      t->idle_compaction_timer_handle = TaskHandle::kInvalid;
+    }
+    if (t->write_coalescing_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->write_coalescing_timer_handle)) {
+      t->write_coalescing_timer_handle = TaskHandle::kInvalid;
+    }
+    if (t->control_frame_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->control_frame_timer_handle)) {
+      t->control_frame_timer_handle = TaskHandle::kInvalid;
+    }
     switch (t->keepalive_state) {
       case GRPC_CHTTP2_KEEPALIVE_STATE_WAITING:
         if (t->keepalive_ping_timer_handle != TaskHandle::kInvalid &&
@@ -878,6 +962,9 @@ static void close_transport_locked(grpc_chttp2_transport* t,
         break;
     }
 
+    // bytes read ahead of the parser will not be parsed anymore
+    t->read_ahead.Discard();
+
     // flush writable stream list to avoid dangling references
     grpc_chttp2_stream* s;
     while (grpc_chttp2_list_pop_writable_stream(t, &s)) {
@@ -954,6 +1041,7 @@ grpc_chttp2_stream::grpc_chttp2_stream(grpc_chttp2_transport* t,
     *t->accepting_stream = this;
     t->stream_map.emplace(id, this);
     post_destructive_reclaimer(t);
+    cancel_idle_compaction(t);
   }
 
   grpc_slice_buffer_init(&frame_storage);
@@ -1103,12 +1191,84 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
     case GRPC_CHTTP2_WRITE_STATE_WRITING:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE,
                       grpc_chttp2_initiate_write_reason_string(reason));
+      // If the current write is being held for coalescing, gather the new
+      // frames into it (and let the policy decide if it's time to flush).
+      resume_held_write(t);
       break;
     case GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE:
       break;
   }
 }
 
+void grpc_chttp2_initiate_write_soon(
+    grpc_chttp2_transport* t, grpc_chttp2_initiate_write_reason reason) {
+  if (t->control_frame_max_delay == grpc_core::Duration::Zero()) {
+    grpc_chttp2_initiate_write(t, reason);
+    return;
+  }
+  // A write already queued up will gather the frames: nothing to wait for.
+  if (t->write_state == GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE) return;
+  if (t->control_frame_timer_handle != TaskHandle::kInvalid) return;
+  GRPC_TRACE_LOG(http, INFO)
+      << "transport " << t << " delaying write for "
+      << grpc_chttp2_initiate_write_reason_string(reason) << " by up to "
+      << t->control_frame_max_delay;
+  t->control_frame_timer_handle = t->event_engine->RunAfter(
+      t->control_frame_max_delay, [t = t->Ref()]() mutable {
+        grpc_core::ExecCtx exec_ctx;
+        auto* tp = t.get();
+        tp->combiner->Run(
+            grpc_core::InitTransportClosure<control_frame_timer_locked>(
+                std::move(t), &tp->control_frame_timer_locked),
+            absl::OkStatus());
+      });
+}
+
+static void control_frame_timer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  DCHECK(error.ok());
+  t->control_frame_timer_handle = TaskHandle::kInvalid;
+  if (!t->closed_with_error.ok()) return;
+  grpc_chttp2_initiate_write(t.get(),
+                             GRPC_CHTTP2_INITIATE_WRITE_DELAYED_CONTROL_FRAMES);
+}
+
+static void resume_held_write(grpc_chttp2_transport* t) {
+  if (!std::exchange(t->write_held, false)) return;
+  t->combiner->FinallyRun(
+      grpc_core::InitTransportClosure<write_action_begin_locked>(
+          t->Ref(), &t->write_action_begin_locked),
+      absl::OkStatus());
+}
+
+static void write_coalescing_timer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  DCHECK(error.ok());
+  t->write_coalescing_timer_handle = TaskHandle::kInvalid;
+  resume_held_write(t.get());
+}
+
+// Holds the write gathered into outbuf until more frames are gathered into
+// it, or until `deadline`.
+static void hold_write(grpc_chttp2_transport* t,
+                       grpc_core::Timestamp deadline) {
+  t->write_held = true;
+  set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
+                  "hold write for coalescing");
+  if (t->write_coalescing_timer_handle != TaskHandle::kInvalid) return;
+  t->write_coalescing_timer_handle = t->event_engine->RunAfter(
+      deadline - grpc_core::Timestamp::Now(), [t = t->Ref()]() mutable {
+        grpc_core::ExecCtx exec_ctx;
+        auto* tp = t.get();
+        tp->combiner->Run(
+            grpc_core::InitTransportClosure<write_coalescing_timer_locked>(
+                std::move(t), &tp->write_coalescing_timer_locked),
+            absl::OkStatus());
+      });
+}
+
 void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
                                       grpc_chttp2_stream* s) {
   if (t->closed_with_error.ok() && grpc_chttp2_list_add_writable_stream(t, s)) {
@@ -1116,6 +1276,25 @@ void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
   }
 }
 
+void grpc_chttp2_set_stream_write_priority(grpc_chttp2_transport* t,
+                                           grpc_chttp2_stream* s,
+                                           const grpc_metadata_batch& md) {
+  if (!t->is_client && !t->accept_stream_priority) return;
+  std::string buffer;
+  std::optional<absl::string_view> value =
+      md.GetStringValue(grpc_core::Http2StreamPriority::kMetadataKey, &buffer);
+  if (!value.has_value()) return;
+  std::optional<grpc_core::Http2StreamPriority> priority =
+      grpc_core::Http2StreamPriority::Parse(*value);
+  if (!priority.has_value()) {
+    GRPC_TRACE_LOG(http, INFO)
+        << "ignoring invalid " << grpc_core::Http2StreamPriority::kMetadataKey
+        << " value: " << *value;
+    return;
+  }
+  s->write_priority = *priority;
+}
+
 static const char* begin_writing_desc(bool partial) {
   if (partial) {
     return "begin partial write in background";
@@ -1134,8 +1313,31 @@ static void write_action_begin_locked(
     r.writing = false;
   } else {
     r = grpc_chttp2_begin_write(t.get());
+    // The write gathered every control frame that was waiting for one.
+    if (t->control_frame_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->control_frame_timer_handle)) {
+      t->control_frame_timer_handle = TaskHandle::kInvalid;
+    }
   }
   if (r.writing) {
+    if (!r.partial && !r.urgent && t->close_transport_on_writes_finished.ok()) {
+      const bool was_holding = t->write_coalescing_policy.holding();
+      auto hold_until = t->write_coalescing_policy.HoldUntil(
+          t->outbuf.Length(), t->num_frames_in_next_write,
+          t->write_size_policy.WriteTargetSize());
+      if (hold_until.has_value()) {
+        if (!was_holding) {
+          grpc_core::global_stats().IncrementHttp2WritesCoalesced();
+        }
+        hold_write(t.get(), *hold_until);
+        return;
+      }
+    }
+    t->write_coalescing_policy.Flush();
+    if (t->write_coalescing_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->write_coalescing_timer_handle)) {
+      t->write_coalescing_timer_handle = TaskHandle::kInvalid;
+    }
     set_write_state(t.get(),
                     r.partial ? GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE
                               : GRPC_CHTTP2_WRITE_STATE_WRITING,
@@ -1188,6 +1390,9 @@ static void write_action(grpc_chttp2_transport* t) {
       << (t->is_client ? "CLIENT" : "SERVER") << "[" << t << "]: Write "
       << t->outbuf.Length() << " bytes";
   t->write_size_policy.BeginWrite(t->outbuf.Length());
+  grpc_core::global_stats().IncrementHttp2BytesPerWrite(t->outbuf.Length());
+  grpc_core::global_stats().IncrementHttp2FramesPerWrite(
+      t->num_frames_in_next_write);
   t->http2_ztrace_collector.Append(grpc_core::H2BeginEndpointWrite{
       static_cast<uint32_t>(t->outbuf.Length())});
   grpc_endpoint_write(t->ep.get(), t->outbuf.c_slice_buffer(),
@@ -1370,6 +1575,7 @@ static void maybe_start_some_streams(grpc_chttp2_transport* t) {
 
     t->stream_map.emplace(s->id, s);
     post_destructive_reclaimer(t);
+    cancel_idle_compaction(t);
     grpc_chttp2_mark_stream_writable(t, s);
     grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM);
   }
@@ -1503,6 +1709,9 @@ static void send_initial_metadata_locked(
   if (contains_non_ok_status(s->send_initial_metadata)) {
     s->seen_error = true;
   }
+  if (t->is_client) {
+    grpc_chttp2_set_stream_write_priority(t, s, *s->send_initial_metadata);
+  }
   if (!s->write_closed) {
     if (t->is_client) {
       if (t->closed_with_error.ok()) {
@@ -2324,6 +2533,7 @@ static grpc_chttp2_transport::RemovedStreamHandle remove_stream(
 
   if (t->stream_map.empty()) {
     post_benign_reclaimer(t);
+    schedule_idle_compaction(t);
     if (t->sent_goaway_state == GRPC_CHTTP2_FINAL_GOAWAY_SENT) {
       close_transport_locked(
           t, GRPC_ERROR_CREATE_REFERENCING(
@@ -2775,6 +2985,10 @@ static void WithUrgency(grpc_chttp2_transport* t,
       break;
     case grpc_core::chttp2::FlowControlAction::Urgency::UPDATE_IMMEDIATELY:
       grpc_chttp2_initiate_write(t, reason);
+      action();
+      break;
+    case grpc_core::chttp2::FlowControlAction::Urgency::UPDATE_SOON:
+      grpc_chttp2_initiate_write_soon(t, reason);
       [[fallthrough]];
     case grpc_core::chttp2::FlowControlAction::Urgency::QUEUE_UPDATE:
       action();
@@ -2934,6 +3148,42 @@ static void read_action_parse_loop_locked(
   }
 }
 
+static void read_ahead(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+                       grpc_error_handle error) {
+  auto* tp = t.get();
+  tp->combiner->Run(grpc_core::InitTransportClosure<read_ahead_locked>(
+                        std::move(t), &tp->read_ahead_locked),
+                    error);
+}
+
+static void read_ahead_locked(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+                              grpc_error_handle error) {
+  if (t->read_ahead.OnReadDone(error, &t->read_buffer)) {
+    read_action_locked(std::move(t), std::move(error));
+    return;
+  }
+  // The transport closed while the read was in flight: nothing will parse it.
+  if (!t->closed_with_error.ok()) t->read_ahead.Discard();
+}
+
+// Starts the next endpoint read before the bytes of the current one are
+// parsed. The parser still runs under the combiner, one read at a time.
+static void maybe_start_read_ahead_locked(grpc_chttp2_transport* t) {
+  if (!t->read_ahead_enabled || !t->closed_with_error.ok() ||
+      t->read_ahead.state() != grpc_core::Chttp2ReadAhead::State::kIdle ||
+      t->reading_paused_on_pending_induced_frames ||
+      // Unparsed bytes would only add to the memory pressure.
+      t->memory_owner.GetPressureInfo().pressure_control_value >= 0.8) {
+    return;
+  }
+  // How many bytes the parser needs to make progress is only known once the
+  // current read is parsed.
+  grpc_endpoint_read(t->ep.get(), t->read_ahead.Start(),
+                     grpc_core::InitTransportClosure<read_ahead>(
+                         t->Ref(), &t->read_ahead_locked),
+                     !t->goaway_error.ok(), /*min_progress_size=*/1);
+}
+
 static void read_action_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
@@ -2951,6 +3201,8 @@ static void read_action_locked(
   grpc_error_handle err = error;
   if (!err.ok()) {
     err = GRPC_ERROR_CREATE_REFERENCING("Endpoint read failed", &err, 1);
+  } else {
+    maybe_start_read_ahead_locked(t.get());
   }
   std::swap(err, error);
   read_action_parse_loop_locked(std::move(t), std::move(err));
@@ -2958,6 +3210,16 @@ static void read_action_locked(
 
 static void continue_read_action_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t) {
+  grpc_error_handle error;
+  switch (t->read_ahead.OnParsed(&t->read_buffer, &error)) {
+    case grpc_core::Chttp2ReadAhead::Next::kRead:
+      break;
+    case grpc_core::Chttp2ReadAhead::Next::kWait:
+      return;
+    case grpc_core::Chttp2ReadAhead::Next::kParse:
+      read_action_locked(std::move(t), std::move(error));
+      return;
+  }
   const bool urgent = !t->goaway_error.ok();
   auto* tp = t.get();
   grpc_endpoint_read(tp->ep.get(), &tp->read_buffer,
@@ -3256,6 +3518,80 @@ void grpc_chttp2_transport::SetPollsetSet(grpc_stream* /*gs*/,
   if (ep != nullptr) grpc_endpoint_add_to_pollset_set(ep.get(), pollset_set);
 }
 
+//
+// IDLE COMPACTION
+//
+
+static void schedule_idle_compaction(grpc_chttp2_transport* t) {
+  if (t->idle_compaction_period == grpc_core::Duration::Infinity() ||
+      t->idle_compaction_timer_handle != TaskHandle::kInvalid ||
+      t->compacted_header_table_size.has_value() ||
+      !t->closed_with_error.ok()) {
+    return;
+  }
+  t->idle_compaction_timer_handle = t->event_engine->RunAfter(
+      t->idle_compaction_period, [t = t->Ref()]() mutable {
+        grpc_core::ExecCtx exec_ctx;
+        auto* tp = t.get();
+        tp->combiner->Run(
+            grpc_core::InitTransportClosure<idle_compaction_locked>(
+                std::move(t), &tp->idle_compaction_locked),
+            absl::OkStatus());
+      });
+}
+
+// Called when a stream starts: stops the idle timer, and if the transport
+// was compacted, advertises the original header table size again so that
+// the peer can resume using its HPACK dynamic table.
+static void cancel_idle_compaction(grpc_chttp2_transport* t) {
+  if (t->idle_compaction_timer_handle != TaskHandle::kInvalid &&
+      t->event_engine->Cancel(t->idle_compaction_timer_handle)) {
+    t->idle_compaction_timer_handle = TaskHandle::kInvalid;
+  }
+  if (t->compacted_header_table_size.has_value()) {
+    t->settings.mutable_local().SetHeaderTableSize(
+        *std::exchange(t->compacted_header_table_size, std::nullopt));
+    grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+  }
+}
+
+static void idle_compaction_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  DCHECK(error.ok());
+  t->idle_compaction_timer_handle = TaskHandle::kInvalid;
+  if (!t->closed_with_error.ok() || !t->stream_map.empty() ||
+      t->compacted_header_table_size.has_value()) {
+    return;
+  }
+  GRPC_TRACE_LOG(http, INFO)
+      << "HTTP2: " << t->peer_string.as_string_view()
+      << " - compacting transport after " << t->idle_compaction_period
+      << " without streams";
+  grpc_core::global_stats().IncrementHttp2IdleCompactions();
+  // The stream map keeps the capacity it grew to for the busiest period of
+  // the connection.
+  decltype(t->stream_map)().swap(t->stream_map);
+  // The outgoing buffers are only touched by writes, so they can be
+  // released if no write is in progress. read_buffer is handed to the
+  // endpoint for the pending read, and stays as it is.
+  if (t->write_state == GRPC_CHTTP2_WRITE_STATE_IDLE) {
+    if (t->outbuf.Length() == 0) t->outbuf = grpc_core::SliceBuffer();
+    if (t->qbuf.length == 0) {
+      grpc_slice_buffer_destroy(&t->qbuf);
+      grpc_slice_buffer_init(&t->qbuf);
+    }
+  }
+  // Advertising a zero sized header table lets the peer's encoder stop
+  // indexing, and our HPACK table frees its entries once the peer acks.
+  t->compacted_header_table_size = t->settings.local().header_table_size();
+  if (*t->compacted_header_table_size != 0) {
+    t->settings.mutable_local().SetHeaderTableSize(0);
+    grpc_chttp2_initiate_write(t.get(),
+                               GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+  }
+}
+
 //
 // RESOURCE QUOTAS
 //
@@ -3407,6 +3743,8 @@ const char* grpc_chttp2_initiate_write_reason_string(
       return "PING_RESPONSE";
     case GRPC_CHTTP2_INITIATE_WRITE_FORCE_RST_STREAM:
       return "FORCE_RST_STREAM";
+    case GRPC_CHTTP2_INITIATE_WRITE_DELAYED_CONTROL_FRAMES:
+      return "DELAYED_CONTROL_FRAMES";
   }
   GPR_UNREACHABLE_CODE(return "unknown");
 }
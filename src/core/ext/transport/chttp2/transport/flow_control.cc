@@ -48,14 +48,30 @@ namespace {
 
 constexpr const int64_t kMaxWindowUpdateSize = (1u << 31) - 1;
 
+// Window advertised by the BBR policy before the first BDP ping completes,
+// and the least it ever advertises without memory pressure.
+constexpr const double kMinBbrWindow = 256.0 * 1024.0;
+// While the bandwidth still grows, BBR's startup gain (2/ln2) lets the window
+// keep up with a doubling delivery rate.
+constexpr const double kBbrStartupGain = 2.885;
+constexpr const double kBbrSteadyGain = 2.0;
+
 }  // namespace
 
+std::optional<WindowPolicy> ParseWindowPolicy(absl::string_view name) {
+  if (name == "bdp") return WindowPolicy::kBdp;
+  if (name == "bbr") return WindowPolicy::kBbr;
+  return std::nullopt;
+}
+
 const char* FlowControlAction::UrgencyString(Urgency u) {
   switch (u) {
     case Urgency::NO_ACTION_NEEDED:
       return "no-action";
     case Urgency::UPDATE_IMMEDIATELY:
       return "now";
+    case Urgency::UPDATE_SOON:
+      return "soon";
     case Urgency::QUEUE_UPDATE:
       return "queue";
     default:
@@ -165,16 +181,29 @@ FlowControlAction TransportFlowControl::UpdateAction(FlowControlAction action) {
   // round up so that one byte targets are sent.
   const int64_t send_threshold = (target + 1) / 2;
   if (announced_window_ < send_threshold) {
+    // Until the peer is down to its last quarter of the window, the update
+    // can wait to go out along with other frames.
     action.set_send_transport_update(
-        FlowControlAction::Urgency::UPDATE_IMMEDIATELY);
+        announced_window_ < (target + 3) / 4
+            ? FlowControlAction::Urgency::UPDATE_IMMEDIATELY
+            : FlowControlAction::Urgency::UPDATE_SOON);
   }
   return action;
 }
 
+double TransportFlowControl::BbrTargetWindow() const {
+  const double gain = bdp_estimator_.BandwidthPlateaued() ? kBbrSteadyGain
+                                                          : kBbrStartupGain;
+  return std::max(kMinBbrWindow, gain * bdp_estimator_.MaxBandwidth() *
+                                     bdp_estimator_.MinRttSeconds());
+}
+
 double
 TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
     const {
-  const double bdp = bdp_estimator_.EstimateBdp() * 2.0;
+  const double bdp = window_policy_ == WindowPolicy::kBbr
+                         ? BbrTargetWindow()
+                         : bdp_estimator_.EstimateBdp() * 2.0;
   const double memory_pressure =
       memory_owner_->GetPressureInfo().pressure_control_value;
   // Linear interpolation between two values.
@@ -212,7 +241,10 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   const double kAnythingGoesPressure = 0.2;
   const double kAdjustedToBdpPressure = 0.5;
   const double kOneMegabyte = 1024.0 * 1024.0;
-  const double kAnythingGoesWindow = std::max(4.0 * kOneMegabyte, bdp);
+  // The BBR policy trusts its model, and so skips the 4MB floor.
+  const double kAnythingGoesWindow = window_policy_ == WindowPolicy::kBbr
+                                         ? bdp
+                                         : std::max(4.0 * kOneMegabyte, bdp);
   if (memory_pressure < kAnythingGoesPressure) {
     return kAnythingGoesWindow;
   } else if (memory_pressure < kAdjustedToBdpPressure) {
@@ -366,6 +398,11 @@ FlowControlAction StreamFlowControl::UpdateAction(FlowControlAction action) {
     const int64_t hurry_up_size = std::max(
         static_cast<int64_t>(tfc_->queued_init_window()) / 2, int64_t{8192});
     if (desired_announce_size > hurry_up_size) {
+      urgency = FlowControlAction::Urgency::UPDATE_SOON;
+    }
+    // Past three quarters of the window the peer is about to stall: don't
+    // wait for other frames to go out with.
+    if (desired_announce_size > hurry_up_size + hurry_up_size / 2) {
       urgency = FlowControlAction::Urgency::UPDATE_IMMEDIATELY;
     }
     // min_progress_size_ > 0 means we have a reader ready to read.
@@ -66,6 +66,19 @@ class StreamFlowControl;
 
 enum class StallEdge { kNoChange, kStalled, kUnstalled };
 
+// How the transport sizes the initial window it advertises to its peer.
+enum class WindowPolicy : uint8_t {
+  // Twice the BDP estimate, but at least 4MB while memory is plentiful.
+  kBdp,
+  // A BBR style model: a gain times the highest bandwidth and the lowest round
+  // trip time measured by the recent BDP pings.
+  kBbr,
+};
+
+// Parses the value of GRPC_ARG_HTTP2_FLOW_CONTROL_WINDOW_POLICY: "bdp" or
+// "bbr".
+std::optional<WindowPolicy> ParseWindowPolicy(absl::string_view name);
+
 // Encapsulates a collections of actions the transport needs to take with
 // regard to flow control. Each action comes with urgencies that tell the
 // transport how quickly the action must take place.
@@ -76,6 +89,9 @@ class GRPC_MUST_USE_RESULT FlowControlAction {
     NO_ACTION_NEEDED = 0,
     // Initiate a write to update the initial window immediately.
     UPDATE_IMMEDIATELY,
+    // The peer still has window to spare: the update may wait a little for a
+    // write to piggyback on, but must go out within a bounded delay.
+    UPDATE_SOON,
     // Push the flow control update into a send buffer, to be sent
     // out the next time a write is initiated.
     QUEUE_UPDATE,
@@ -169,6 +185,9 @@ class TransportFlowControl final {
 
   bool bdp_probe() const { return enable_bdp_probe_; }
 
+  WindowPolicy window_policy() const { return window_policy_; }
+  void set_window_policy(WindowPolicy policy) { window_policy_ = policy; }
+
   // returns an announce if we should send a transport update to our peer,
   // else returns zero; writing_anyway indicates if a write would happen
   // regardless of the send - if it is false and this function returns non-zero,
@@ -348,6 +367,7 @@ class TransportFlowControl final {
 
  private:
   double TargetInitialWindowSizeBasedOnMemoryPressureAndBdp() const;
+  double BbrTargetWindow() const;
   static void UpdateSetting(absl::string_view name, int64_t* desired_value,
                             uint32_t new_desired_value,
                             FlowControlAction* action,
@@ -370,6 +390,7 @@ class TransportFlowControl final {
 
   /// should we probe bdp?
   const bool enable_bdp_probe_;
+  WindowPolicy window_policy_ = WindowPolicy::kBdp;
 
   // bdp estimation
   BdpEstimator bdp_estimator_;
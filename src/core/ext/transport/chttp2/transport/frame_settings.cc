@@ -138,8 +138,8 @@ grpc_error_handle grpc_chttp2_settings_parser_parse(void* p,
             *parser->target_settings = *parser->incoming_settings;
             t->num_pending_induced_frames++;
             grpc_slice_buffer_add(&t->qbuf, grpc_chttp2_settings_ack_create());
-            grpc_chttp2_initiate_write(t,
-                                       GRPC_CHTTP2_INITIATE_WRITE_SETTINGS_ACK);
+            grpc_chttp2_initiate_write_soon(
+                t, GRPC_CHTTP2_INITIATE_WRITE_SETTINGS_ACK);
             if (t->notify_on_receive_settings != nullptr) {
               if (t->interested_parties_until_recv_settings != nullptr) {
                 grpc_endpoint_delete_from_pollset_set(
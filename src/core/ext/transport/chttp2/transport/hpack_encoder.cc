@@ -24,15 +24,21 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/match.h"
+#include "absl/strings/strip.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder_table.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/ext/transport/chttp2/transport/varint.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/surface/validate_metadata.h"
 #include "src/core/lib/transport/timeout_encoding.h"
 #include "src/core/util/crash.h"
@@ -314,6 +320,26 @@ void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
   output_.Append(emit.data());
 }
 
+void Encoder::EmitLitHdrWithBinaryStringKeyNeverIdx(Slice key_slice,
+                                                    Slice value_slice) {
+  StringKey key(std::move(key_slice));
+  key.WritePrefix(0x10, output_.AddTiny(key.prefix_length()));
+  output_.Append(key.key());
+  BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_);
+  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
+  output_.Append(emit.data());
+}
+
+void Encoder::EmitLitHdrWithNonBinaryStringKeyNeverIdx(Slice key_slice,
+                                                       Slice value_slice) {
+  StringKey key(std::move(key_slice));
+  key.WritePrefix(0x10, output_.AddTiny(key.prefix_length()));
+  output_.Append(key.key());
+  NonBinaryStringValue emit(std::move(value_slice));
+  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
+  output_.Append(emit.data());
+}
+
 void Encoder::AdvertiseTableSizeChange() {
   VarintWriter<3> w(compressor_->table_.max_size());
   w.Write(0x20, output_.AddTiny(w.length()));
@@ -363,7 +389,116 @@ void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
   values_.emplace_back(value.Ref(), index);
 }
 
+bool UnknownMetadataIndex::IsSensitiveKey(absl::string_view key) {
+  absl::ConsumeSuffix(&key, "-bin");
+  return key == "authorization" || key == "proxy-authorization" ||
+         key == "cookie" || key == "set-cookie" ||
+         absl::EndsWith(key, "-token") || absl::EndsWith(key, "-key");
+}
+
+void UnknownMetadataIndex::EmitTo(const Slice& key, const Slice& value,
+                                  Encoder* encoder) {
+  const bool is_binary = absl::EndsWith(key.as_string_view(), "-bin");
+  if (IsSensitiveKey(key.as_string_view())) {
+    if (is_binary) {
+      encoder->EmitLitHdrWithBinaryStringKeyNeverIdx(key.Ref(), value.Ref());
+    } else {
+      encoder->EmitLitHdrWithNonBinaryStringKeyNeverIdx(key.Ref(),
+                                                        value.Ref());
+    }
+    return;
+  }
+  const size_t entry_size =
+      hpack_constants::SizeForEntry(key.length(), value.length());
+  if (entry_size <= kMaxTrackedEntrySize) {
+    auto it = keys_.find(key.as_string_view());
+    if (it == keys_.end()) {
+      Track(key, value, entry_size);
+    } else {
+      auto value_it = std::find_if(
+          it->second.begin(), it->second.end(),
+          [&value](const ValueIndex& v) { return v.value == value; });
+      if (value_it == it->second.end()) {
+        Track(key, value, entry_size);
+      } else {
+        // Saturate rather than wrap on very long lived connections.
+        if (value_it->hits != std::numeric_limits<uint32_t>::max()) {
+          ++value_it->hits;
+        }
+        auto& table = encoder->hpack_table();
+        if (table.ConvertibleToDynamicIndex(value_it->index)) {
+          encoder->EmitIndexed(table.DynamicIndex(value_it->index));
+          return;
+        }
+        if (value_it->hits >= kAdmitAfterHits) {
+          value_it->index =
+              is_binary ? encoder->EmitLitHdrWithBinaryStringKeyIncIdx(
+                              key.Ref(), value.Ref())
+                        : encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(
+                              key.Ref(), value.Ref());
+          return;
+        }
+      }
+    }
+  }
+  if (is_binary) {
+    encoder->EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+  } else {
+    encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+  }
+}
+
+void UnknownMetadataIndex::Track(const Slice& key, const Slice& value,
+                                 size_t entry_size) {
+  if (tracked_bytes_ + entry_size > kMaxTrackedBytes) Decay();
+  if (tracked_bytes_ + entry_size > kMaxTrackedBytes) return;
+  std::vector<ValueIndex>& values = keys_[key.as_string_view()];
+  if (values.size() >= kMaxValuesPerKey) {
+    // Make room by replacing the least sent value, but only if it was sent
+    // once: otherwise a key with many distinct values could evict the ones
+    // that actually repeat.
+    auto coldest = std::min_element(
+        values.begin(), values.end(),
+        [](const ValueIndex& a, const ValueIndex& b) {
+          return a.hits < b.hits;
+        });
+    if (coldest->hits > 1) return;
+    tracked_bytes_ -= hpack_constants::SizeForEntry(key.length(),
+                                                    coldest->value.length());
+    *coldest = ValueIndex(value.Ref(), 1);
+  } else {
+    values.emplace_back(value.Ref(), 1);
+  }
+  tracked_bytes_ += entry_size;
+}
+
+void UnknownMetadataIndex::Decay() {
+  for (auto it = keys_.begin(); it != keys_.end();) {
+    std::vector<ValueIndex>& values = it->second;
+    for (size_t i = 0; i < values.size();) {
+      values[i].hits /= 2;
+      if (values[i].hits == 0) {
+        tracked_bytes_ -= hpack_constants::SizeForEntry(
+            it->first.length(), values[i].value.length());
+        values[i] = std::move(values.back());
+        values.pop_back();
+      } else {
+        ++i;
+      }
+    }
+    if (values.empty()) {
+      keys_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
 void Encoder::Encode(const Slice& key, const Slice& value) {
+  if (IsHpackIndexUnknownMetadataEnabled()) {
+    compressor_->unknown_metadata_index_.EmitTo(key, value, this);
+    return;
+  }
   if (absl::EndsWith(key.as_string_view(), "-bin")) {
     EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
   } else {
@@ -24,9 +24,11 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -72,6 +74,10 @@ class Encoder {
                                            Slice value_slice);
   void EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                               Slice value_slice);
+  void EmitLitHdrWithBinaryStringKeyNeverIdx(Slice key_slice,
+                                             Slice value_slice);
+  void EmitLitHdrWithNonBinaryStringKeyNeverIdx(Slice key_slice,
+                                                Slice value_slice);
 
   void EncodeAlwaysIndexed(uint32_t* index, absl::string_view key, Slice value,
                            size_t transport_length);
@@ -266,6 +272,52 @@ class SliceIndex {
   std::vector<ValueIndex> values_;
 };
 
+// Index for metadata without compression traits (i.e. custom metadata that
+// is not declared in metadata_batch.h).
+// Counts how often each key/value pair is sent on the connection, and adds
+// pairs to the HPACK table once they have been seen kAdmitAfterHits times, so
+// that later sends can be indexed. Pairs that are seen once, like request ids,
+// are sent as literals and never take up table space.
+// The memory used to track pairs is bounded by kMaxTrackedBytes: when full,
+// all counts are halved and pairs whose count drops to zero are forgotten.
+// Credentials (see IsSensitiveKey) are never tracked, and are sent as never
+// indexed literals so that intermediaries do not index them either.
+class UnknownMetadataIndex {
+ public:
+  void EmitTo(const Slice& key, const Slice& value, Encoder* encoder);
+
+  // Returns true for keys whose values are likely to be secrets, which must
+  // not be added to the HPACK table: a peer sharing the connection could
+  // otherwise probe for them by watching how well its own headers compress.
+  static bool IsSensitiveKey(absl::string_view key);
+
+  size_t test_only_tracked_bytes() const { return tracked_bytes_; }
+
+ private:
+  // Number of sends of a pair before it is added to the HPACK table.
+  static constexpr uint32_t kAdmitAfterHits = 2;
+  // Maximum number of values tracked per key.
+  static constexpr size_t kMaxValuesPerKey = 16;
+  // Maximum hpack entry size of all tracked pairs.
+  static constexpr size_t kMaxTrackedBytes = 16 * 1024;
+  // Larger pairs are never tracked.
+  static constexpr size_t kMaxTrackedEntrySize = kMaxTrackedBytes / 4;
+
+  struct ValueIndex {
+    ValueIndex(Slice value, uint32_t hits)
+        : value(std::move(value)), hits(hits) {}
+    Slice value;
+    uint32_t hits;
+    uint32_t index = 0;
+  };
+
+  void Track(const Slice& key, const Slice& value, size_t entry_size);
+  void Decay();
+
+  absl::flat_hash_map<std::string, std::vector<ValueIndex>> keys_;
+  size_t tracked_bytes_ = 0;
+};
+
 template <typename MetadataTrait>
 class Compressor<MetadataTrait, SmallSetOfValuesCompressor> {
  public:
@@ -347,6 +399,9 @@ class HPackCompressor {
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
   }
+  size_t test_only_unknown_metadata_tracked_bytes() const {
+    return unknown_metadata_index_.test_only_tracked_bytes();
+  }
 
   struct EncodeHeaderOptions {
     uint32_t stream_id;
@@ -393,6 +448,7 @@ class HPackCompressor {
 
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
       compression_state_;
+  hpack_encoder_detail::UnknownMetadataIndex unknown_metadata_index_;
 };
 
 namespace hpack_encoder_detail {
@@ -0,0 +1,108 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/hpack_interned_slices.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+namespace {
+
+class Shard {
+ public:
+  Slice Intern(absl::string_view value) {
+    MutexLock lock(&mu_);
+    auto it = slices_.find(value);
+    if (it != slices_.end()) return it->second.Ref();
+    if (slices_.size() >= HPackInternedSlices::kMaxEntriesPerShard) {
+      // Sweeping is linear in the shard size: when every value is in use,
+      // only try again after a few more misses.
+      if (skip_sweeps_ > 0) {
+        --skip_sweeps_;
+        return Slice::FromCopiedString(value);
+      }
+      DropUnused();
+      if (slices_.size() >= HPackInternedSlices::kMaxEntriesPerShard) {
+        skip_sweeps_ = kSkipSweepsWhenFull;
+        return Slice::FromCopiedString(value);
+      }
+    }
+    Slice slice = Slice::FromCopiedString(value);
+    // The key points into the slice we store alongside it, which is
+    // refcounted and so never moves.
+    slices_.emplace(slice.as_string_view(), slice.Ref());
+    return slice;
+  }
+
+  size_t size() {
+    MutexLock lock(&mu_);
+    return slices_.size();
+  }
+
+ private:
+  // Drops the slices that only the cache refers to. No new ref can be taken
+  // while we hold the lock, so a unique slice stays unique.
+  void DropUnused() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    absl::erase_if(slices_, [](const auto& entry) {
+      return entry.second.c_slice().refcount->IsUnique();
+    });
+  }
+
+  static constexpr int kSkipSweepsWhenFull = 32;
+
+  Mutex mu_;
+  int skip_sweeps_ ABSL_GUARDED_BY(mu_) = 0;
+  absl::flat_hash_map<absl::string_view, Slice> slices_ ABSL_GUARDED_BY(mu_);
+};
+
+struct Shards {
+  Shard shards[HPackInternedSlices::kNumShards];
+};
+
+Shard* GetShards() {
+  static NoDestruct<Shards> shards;
+  return shards->shards;
+}
+
+Shard& ShardFor(absl::string_view value) {
+  return GetShards()[absl::HashOf(value) % HPackInternedSlices::kNumShards];
+}
+
+}  // namespace
+
+Slice HPackInternedSlices::Intern(absl::string_view value) {
+  if (value.size() < kMinInternedLength || value.size() > kMaxInternedLength) {
+    return Slice::FromCopiedString(value);
+  }
+  return ShardFor(value).Intern(value);
+}
+
+size_t HPackInternedSlices::TestOnlySize() {
+  size_t size = 0;
+  for (size_t i = 0; i < kNumShards; i++) {
+    size += GetShards()[i].size();
+  }
+  return size;
+}
+
+}  // namespace grpc_core
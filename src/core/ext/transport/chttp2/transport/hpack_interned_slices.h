@@ -0,0 +1,58 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HPACK_INTERNED_SLICES_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HPACK_INTERNED_SLICES_H
+
+#include <grpc/slice.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include "absl/strings/string_view.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_core {
+
+// Process wide cache of the values of HPACK dynamic table entries.
+// Every connection keeps its own HPACK dynamic table, and so its own parsed
+// copy of values like :path, :authority or user-agent that are the same on
+// most connections to a server. Interning those values lets all connections
+// share one refcounted buffer per distinct value, instead of each table entry
+// owning a heap allocation.
+// The cache holds a ref to every interned slice. It is bounded: once a shard
+// is full, values that no connection uses any more are dropped, and if that
+// does not free up space the value is copied instead of interned.
+class HPackInternedSlices {
+ public:
+  // Values no longer than this fit inline in a grpc_slice, so copying them
+  // does not allocate and they are never interned.
+  static constexpr size_t kMinInternedLength = GRPC_SLICE_INLINED_SIZE + 1;
+  // Longer values are unlikely to repeat (tokens, trace contexts) and are
+  // never interned.
+  static constexpr size_t kMaxInternedLength = 256;
+  static constexpr size_t kNumShards = 16;
+  static constexpr size_t kMaxEntriesPerShard = 256;
+
+  // Returns a slice with the contents of `value`. If the value is interned,
+  // the slice shares its buffer with all other slices interned with the same
+  // contents, and must be treated as immutable.
+  static Slice Intern(absl::string_view value);
+
+  // Number of values currently in the cache.
+  static size_t TestOnlySize();
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HPACK_INTERNED_SLICES_H
@@ -42,9 +42,11 @@
 #include "src/core/call/parsed_metadata.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_interned_slices.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/lib/surface/validate_metadata.h"
@@ -994,11 +996,19 @@ class HPackParser::Parser {
         }
       }
     }
-    auto value_slice = value.value.Take();
+    // Values that will live in the dynamic table are interned, so that
+    // connections share them. Interned slices are exactly sized and owned by
+    // the cache, so there's no need to take a unique copy of them.
+    const bool intern_value =
+        state_.add_to_table && IsHpackInternDynamicTableValuesEnabled();
+    auto value_slice =
+        intern_value ? HPackInternedSlices::Intern(value.value.string_view())
+                     : value.value.Take();
     const auto transport_size =
         key_string.size() + value.wire_size + hpack_constants::kEntryOverhead;
     auto md = grpc_metadata_batch::Parse(
-        key_string, std::move(value_slice), state_.add_to_table, transport_size,
+        key_string, std::move(value_slice),
+        state_.add_to_table && !intern_value, transport_size,
         [key_string, this](absl::string_view message, const Slice&) {
           if (!state_.field_error.ok()) return;
           input_->SetErrorAndContinueParsing(
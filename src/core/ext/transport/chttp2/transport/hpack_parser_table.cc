@@ -101,6 +101,13 @@ void HPackTable::MementoRingBuffer::Rebuild(uint32_t max_entries) {
   entries_.swap(entries);
 }
 
+void HPackTable::MementoRingBuffer::ReleaseStorageIfEmpty() {
+  if (num_entries_ != 0) return;
+  first_entry_ = 0;
+  timestamp_index_ = kNoTimestamp;
+  std::vector<Memento>().swap(entries_);
+}
+
 template <typename F>
 void HPackTable::MementoRingBuffer::ForEach(F f) const {
   uint32_t index = 0;
@@ -132,6 +139,9 @@ void HPackTable::SetMaxBytes(uint32_t max_bytes) {
   while (mem_used_ > max_bytes) {
     EvictOne();
   }
+  // A table that was shrunk down to nothing (e.g. while the connection is
+  // idle) should not hold on to the storage for its old entries.
+  entries_.ReleaseStorageIfEmpty();
   max_bytes_ = max_bytes;
 }
 
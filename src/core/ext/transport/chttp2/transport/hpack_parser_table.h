@@ -112,6 +112,9 @@ class HPackTable {
     // Rebuild this buffer with a new max_entries_ size.
     void Rebuild(uint32_t max_entries);
 
+    // Free the storage of the buffer if it holds no entries.
+    void ReleaseStorageIfEmpty();
+
     // Put a new memento.
     // REQUIRES: num_entries < max_entries
     void Put(Memento m);
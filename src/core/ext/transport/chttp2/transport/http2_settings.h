@@ -180,6 +180,8 @@ class Http2SettingsManager {
 
   std::optional<Http2SettingsFrame> MaybeSendUpdate();
   GRPC_MUST_USE_RESULT bool AckLastSend();
+  // Returns true if local settings changed since they were last sent.
+  bool HasUnsentUpdate() const { return local_ != sent_; }
 
  private:
   enum class UpdateState : uint8_t {
@@ -57,6 +57,8 @@
 #include "src/core/ext/transport/chttp2/transport/ping_abuse_policy.h"
 #include "src/core/ext/transport/chttp2/transport/ping_callbacks.h"
 #include "src/core/ext/transport/chttp2/transport/ping_rate_policy.h"
+#include "src/core/ext/transport/chttp2/transport/read_ahead.h"
+#include "src/core/ext/transport/chttp2/transport/stream_priority.h"
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
@@ -93,9 +95,13 @@
 // streams are kept in various linked lists depending on what things need to
 // happen to them... this enum labels each list
 typedef enum {
-  // If a stream is in the following two lists, an explicit ref is associated
-  // with the stream
+  // If a stream is in the following lists, an explicit ref is associated with
+  // the stream.
+  // Writable streams are kept in one list per priority class; a stream is in
+  // at most one of them. GRPC_CHTTP2_LIST_WRITABLE holds the normal class.
+  GRPC_CHTTP2_LIST_WRITABLE_HIGH_PRIORITY,
   GRPC_CHTTP2_LIST_WRITABLE,
+  GRPC_CHTTP2_LIST_WRITABLE_LOW_PRIORITY,
   GRPC_CHTTP2_LIST_WRITING,
   // No additional ref is taken for the following refs. Make sure to remove the
   // stream from these lists when the stream is removed.
@@ -148,6 +154,7 @@ typedef enum {
   GRPC_CHTTP2_INITIATE_WRITE_TRANSPORT_FLOW_CONTROL_UNSTALLED,
   GRPC_CHTTP2_INITIATE_WRITE_PING_RESPONSE,
   GRPC_CHTTP2_INITIATE_WRITE_FORCE_RST_STREAM,
+  GRPC_CHTTP2_INITIATE_WRITE_DELAYED_CONTROL_FRAMES,
 } grpc_chttp2_initiate_write_reason;
 
 const char* grpc_chttp2_initiate_write_reason_string(
@@ -351,6 +358,13 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   /// incoming read bytes
   grpc_slice_buffer read_buffer;
 
+  /// With read-ahead, the next endpoint read is started as soon as a read
+  /// completes, so that the endpoint (e.g. TLS decryption) reads on another
+  /// thread while read_buffer is being parsed.
+  bool read_ahead_enabled = false;
+  grpc_core::Chttp2ReadAhead read_ahead;
+  grpc_closure read_ahead_locked;
+
   /// address to place a newly accepted stream - set and unset by
   /// grpc_chttp2_parsing_accept_stream; used by init_stream to
   /// publish the accepted server stream
@@ -483,6 +497,21 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
       next_bdp_ping_timer_handle =
           grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
 
+  // idle compaction support
+  /// how long the transport must have no streams before it is compacted
+  /// (infinity if idle compaction is disabled)
+  grpc_core::Duration idle_compaction_period =
+      grpc_core::Duration::Infinity();
+  /// Closure to compact an idle transport
+  grpc_closure idle_compaction_locked;
+  /// timer to compact the transport once it has been idle for long enough
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      idle_compaction_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  /// header table size to advertise again once a compacted transport starts
+  /// a stream (unset while the transport is not compacted)
+  std::optional<uint32_t> compacted_header_table_size;
+
   // keep-alive ping support
   /// Closure to initialize a keepalive ping
   grpc_closure init_keepalive_ping_locked;
@@ -510,6 +539,7 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode> channelz_socket;
   std::unique_ptr<ChannelzDataSource> channelz_data_source;
   uint32_t num_messages_in_next_write = 0;
+  uint32_t num_frames_in_next_write = 0;
   /// The number of pending induced frames (SETTINGS_ACK, PINGS_ACK and
   /// RST_STREAM) in the outgoing buffer (t->qbuf). If this number goes beyond
   /// DEFAULT_MAX_PENDING_INDUCED_FRAMES, we pause reading new frames. We would
@@ -534,6 +564,37 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// policy for how much data we're willing to put into one http2 write
   grpc_core::Chttp2WriteSizePolicy write_size_policy;
+  /// bytes a writable stream of weight 1 may write before yielding to the
+  /// other writable streams of its priority class; 0 means no limit
+  uint32_t stream_write_quantum = 0;
+  /// picks the priority class the next writable stream is popped from
+  grpc_core::Http2WritableClassScheduler writable_class_scheduler;
+  /// does the server schedule its responses with the grpc-stream-priority the
+  /// client sent?
+  bool accept_stream_priority = false;
+  /// policy for how long we may hold a small write back to coalesce it with
+  /// frames from streams that become writable shortly afterwards
+  grpc_core::Chttp2WriteCoalescingPolicy write_coalescing_policy;
+  /// Closure to flush a held write once the coalescing policy's deadline
+  /// passes
+  grpc_closure write_coalescing_timer_locked;
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      write_coalescing_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  /// is a gathered write (in outbuf) being held back for coalescing?
+  bool write_held = false;
+  /// has grpc_chttp2_begin_write gathered a write that grpc_chttp2_end_write
+  /// has not finished yet? A held write is gathered by several calls to
+  /// begin_write, but ends once.
+  bool write_cycle_open = false;
+  /// how long flow control updates that are not urgent yet and SETTINGS acks
+  /// may wait for a write to piggyback on; zero writes them right away
+  grpc_core::Duration control_frame_max_delay;
+  /// Closure to write the control frames still waiting once that delay passes
+  grpc_closure control_frame_timer_locked;
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      control_frame_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
 
   bool reading_paused_on_pending_induced_frames = false;
   /// Based on channel args, preferred_rx_crypto_frame_sizes are advertised to
@@ -660,6 +721,8 @@ struct grpc_chttp2_stream {
   bool eos_sent = false;
 
   grpc_core::BitSet<STREAM_LIST_COUNT> included;
+  /// how this stream's DATA frames are scheduled against other streams
+  grpc_core::Http2StreamPriority write_priority;
 
   /// the error that resulted in this stream being read-closed
   grpc_error_handle read_closed_error;
@@ -759,6 +822,11 @@ struct grpc_chttp2_stream {
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason);
 
+/// Like grpc_chttp2_initiate_write(), for control frames that may wait up to
+/// t->control_frame_max_delay for another write to go out with.
+void grpc_chttp2_initiate_write_soon(grpc_chttp2_transport* t,
+                                     grpc_chttp2_initiate_write_reason reason);
+
 struct grpc_chttp2_begin_write_result {
   /// are we writing?
   bool writing;
@@ -766,6 +834,9 @@ struct grpc_chttp2_begin_write_result {
   bool partial;
   /// did we queue any completions as part of beginning the write
   bool early_results_scheduled;
+  /// did we gather frames the peer is waiting on (SETTINGS, pings, acks,
+  /// RST_STREAM, GOAWAY), which should not be held back for coalescing
+  bool urgent;
 };
 grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     grpc_chttp2_transport* t);
@@ -869,6 +940,12 @@ void grpc_chttp2_reset_ping_clock(grpc_chttp2_transport* t);
 void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
                                       grpc_chttp2_stream* s);
 
+/// set the write priority of a stream from the grpc-stream-priority metadata
+/// in \a md, if any; servers ignore it unless accept_stream_priority is set
+void grpc_chttp2_set_stream_write_priority(grpc_chttp2_transport* t,
+                                           grpc_chttp2_stream* s,
+                                           const grpc_metadata_batch& md);
+
 void grpc_chttp2_cancel_stream(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
                                grpc_error_handle due_to_error, bool tarpit);
 
@@ -21,4 +21,43 @@
 
 #define GRPC_ARG_PING_TIMEOUT_MS "grpc.http2.ping_timeout_ms"
 
+// How long a small write may be held back so that frames from other streams
+// can be coalesced into the same endpoint write. Milliseconds; 0 (the default)
+// disables coalescing.
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_DELAY_MS \
+  "grpc.http2.write_coalescing_max_delay_ms"
+// A held write is flushed once it reaches this many bytes. Defaults to the
+// adaptive write target size.
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_BYTES \
+  "grpc.http2.write_coalescing_max_bytes"
+// A held write is flushed once it reaches this many frames. Defaults to 64;
+// 0 means no limit.
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_FRAMES \
+  "grpc.http2.write_coalescing_max_frames"
+// Bytes a writable stream may write before yielding to the other writable
+// streams of the same priority class; streams with a grpc-stream-priority
+// weight get that multiple of it. 0 (the default) lets a stream write all it
+// can each time it is scheduled; other values are raised to at least 1024.
+#define GRPC_ARG_HTTP2_STREAM_WRITE_QUANTUM_BYTES \
+  "grpc.http2.stream_write_quantum_bytes"
+// If true, a server schedules its responses with the grpc-stream-priority
+// metadata the client sent. Defaults to false, so that clients cannot move
+// their calls ahead of other clients' calls unless the server allows it.
+#define GRPC_ARG_HTTP2_ACCEPT_STREAM_PRIORITY \
+  "grpc.http2.accept_stream_priority"
+// If true, the transport starts the next endpoint read while it parses the
+// bytes of the previous one, so that reading (and decrypting) the connection
+// overlaps with frame parsing. Defaults to false.
+#define GRPC_ARG_HTTP2_READ_AHEAD "grpc.http2.read_ahead"
+// How the transport sizes the flow control window it advertises when BDP
+// probing is enabled: "bdp" (the default) or "bbr", which sizes it from the
+// bandwidth and round trip time measured by BDP pings.
+#define GRPC_ARG_HTTP2_FLOW_CONTROL_WINDOW_POLICY \
+  "grpc.http2.flow_control_window_policy"
+// Longest time, in milliseconds, that a WINDOW_UPDATE the peer does not need
+// urgently yet, or a SETTINGS ack, may wait for another write to go out with.
+// Defaults to 0: they are written right away.
+#define GRPC_ARG_HTTP2_CONTROL_FRAME_MAX_DELAY_MS \
+  "grpc.http2.control_frame_max_delay_ms"
+
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_INTERNAL_CHANNEL_ARG_NAMES_H
@@ -895,6 +895,11 @@ static grpc_error_handle init_settings_frame_parser(grpc_chttp2_transport* t) {
     }
     t->hpack_parser.hpack_table()->SetMaxBytes(
         t->settings.acked().header_table_size());
+    // Settings changed while the last ones were in flight (e.g. by idle
+    // compaction) could not be sent until now.
+    if (t->settings.HasUnsentUpdate()) {
+      grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+    }
     grpc_chttp2_act_on_flowctl_action(
         t->flow_control.SetAckedInitialWindow(
             t->settings.acked().initial_window_size()),
@@ -1005,6 +1010,10 @@ grpc_error_handle grpc_chttp2_header_parser_parse(void* hpack_parser,
         if (s->header_frames_received == 2) {
           return GRPC_ERROR_CREATE("Too many trailer frames");
         }
+        if (!t->is_client && s->header_frames_received == 0) {
+          grpc_chttp2_set_stream_write_priority(t, s,
+                                                s->initial_metadata_buffer);
+        }
         s->published_metadata[s->header_frames_received] =
             GRPC_METADATA_PUBLISHED_FROM_WIRE;
         maybe_complete_funcs[s->header_frames_received](t, s);
@@ -0,0 +1,75 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/read_ahead.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+
+namespace grpc_core {
+
+Chttp2ReadAhead::Chttp2ReadAhead() { grpc_slice_buffer_init(&buffer_); }
+
+Chttp2ReadAhead::~Chttp2ReadAhead() { grpc_slice_buffer_destroy(&buffer_); }
+
+grpc_slice_buffer* Chttp2ReadAhead::Start() {
+  CHECK(state_ == State::kIdle);
+  state_ = State::kPending;
+  return &buffer_;
+}
+
+bool Chttp2ReadAhead::OnReadDone(grpc_error_handle error,
+                                 grpc_slice_buffer* read_buffer) {
+  if (state_ == State::kWaiting) {
+    state_ = State::kIdle;
+    grpc_slice_buffer_swap(read_buffer, &buffer_);
+    return true;
+  }
+  CHECK(state_ == State::kPending);
+  state_ = State::kDone;
+  error_ = std::move(error);
+  return false;
+}
+
+Chttp2ReadAhead::Next Chttp2ReadAhead::OnParsed(grpc_slice_buffer* read_buffer,
+                                                grpc_error_handle* error) {
+  switch (state_) {
+    case State::kIdle:
+      return Next::kRead;
+    case State::kPending:
+      state_ = State::kWaiting;
+      return Next::kWait;
+    case State::kDone:
+      state_ = State::kIdle;
+      grpc_slice_buffer_swap(read_buffer, &buffer_);
+      *error = std::exchange(error_, absl::OkStatus());
+      return Next::kParse;
+    case State::kWaiting:
+      break;
+  }
+  GPR_UNREACHABLE_CODE(return Next::kWait);
+}
+
+void Chttp2ReadAhead::Discard() {
+  if (state_ != State::kDone) return;
+  state_ = State::kIdle;
+  grpc_slice_buffer_reset_and_unref(&buffer_);
+  error_ = absl::OkStatus();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,92 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_READ_AHEAD_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_READ_AHEAD_H
+
+#include <grpc/slice_buffer.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include "src/core/lib/iomgr/error.h"
+
+namespace grpc_core {
+
+// The endpoint read that a chttp2 transport starts before it has parsed the
+// bytes of the previous read, so that reading (and decrypting) the connection
+// overlaps with frame parsing.
+//
+// At most one read-ahead is in flight. Its bytes are handed to the parser only
+// once the previous read is fully parsed, so that frames stay in order. Bytes
+// that arrive before then are not reserved again: the endpoint allocates its
+// read slices from the transport's memory quota, and they stay charged to it
+// until they are freed.
+class Chttp2ReadAhead {
+ public:
+  enum class State : uint8_t {
+    // No read-ahead in flight.
+    kIdle,
+    // The endpoint read is in flight, the previous read is still being parsed.
+    kPending,
+    // The previous read has been parsed, and the parser waits for the
+    // endpoint read.
+    kWaiting,
+    // The endpoint read completed before the previous read was parsed.
+    kDone,
+  };
+
+  // What the transport does once it parsed a read.
+  enum class Next {
+    // No read-ahead was started: read from the endpoint.
+    kRead,
+    // The read-ahead is still in flight: its completion resumes parsing.
+    kWait,
+    // The read-ahead completed: parse its bytes.
+    kParse,
+  };
+
+  Chttp2ReadAhead();
+  ~Chttp2ReadAhead();
+  Chttp2ReadAhead(const Chttp2ReadAhead&) = delete;
+  Chttp2ReadAhead& operator=(const Chttp2ReadAhead&) = delete;
+
+  State state() const { return state_; }
+
+  // Marks a read-ahead as started, and returns the buffer to read into.
+  grpc_slice_buffer* Start();
+
+  // Called when the endpoint read completes with \a error. Returns true if the
+  // parser was waiting for it: its bytes were then moved to \a read_buffer,
+  // to be parsed with \a error. Otherwise they are kept until OnParsed() hands
+  // them over.
+  bool OnReadDone(grpc_error_handle error, grpc_slice_buffer* read_buffer);
+
+  // Called once the previous read has been parsed. On kParse, the read-ahead
+  // bytes were moved to \a read_buffer, and are to be parsed with \a *error.
+  Next OnParsed(grpc_slice_buffer* read_buffer, grpc_error_handle* error);
+
+  // Drops bytes that were read ahead but not handed over yet, once the
+  // transport is closed and will not parse them. Does nothing while the read
+  // is in flight.
+  void Discard();
+
+ private:
+  State state_ = State::kIdle;
+  grpc_slice_buffer buffer_;
+  grpc_error_handle error_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_READ_AHEAD_H
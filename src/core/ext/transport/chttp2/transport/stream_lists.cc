@@ -20,6 +20,9 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <array>
+#include <optional>
+
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
@@ -30,8 +33,12 @@
 
 static const char* stream_list_id_string(grpc_chttp2_stream_list_id id) {
   switch (id) {
+    case GRPC_CHTTP2_LIST_WRITABLE_HIGH_PRIORITY:
+      return "writable_high_priority";
     case GRPC_CHTTP2_LIST_WRITABLE:
       return "writable";
+    case GRPC_CHTTP2_LIST_WRITABLE_LOW_PRIORITY:
+      return "writable_low_priority";
     case GRPC_CHTTP2_LIST_WRITING:
       return "writing";
     case GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT:
@@ -139,20 +146,62 @@ static bool stream_list_add(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 
 // wrappers for specializations
 
+// writable streams live in the list of their priority class, and the
+// transport's writable class scheduler picks the class each one is popped from
+static constexpr grpc_chttp2_stream_list_id kWritableLists[] = {
+    GRPC_CHTTP2_LIST_WRITABLE_HIGH_PRIORITY,
+    GRPC_CHTTP2_LIST_WRITABLE,
+    GRPC_CHTTP2_LIST_WRITABLE_LOW_PRIORITY,
+};
+
+static grpc_chttp2_stream_list_id writable_list_for(grpc_chttp2_stream* s) {
+  switch (s->write_priority.priority_class) {
+    case grpc_core::Http2StreamPriority::Class::kHigh:
+      return GRPC_CHTTP2_LIST_WRITABLE_HIGH_PRIORITY;
+    case grpc_core::Http2StreamPriority::Class::kNormal:
+      return GRPC_CHTTP2_LIST_WRITABLE;
+    case grpc_core::Http2StreamPriority::Class::kLow:
+      return GRPC_CHTTP2_LIST_WRITABLE_LOW_PRIORITY;
+  }
+  GPR_UNREACHABLE_CODE(return GRPC_CHTTP2_LIST_WRITABLE);
+}
+
+static bool is_writable(grpc_chttp2_stream* s) {
+  for (grpc_chttp2_stream_list_id id : kWritableLists) {
+    if (s->included.is_set(id)) return true;
+  }
+  return false;
+}
+
 bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream* s) {
   CHECK_NE(s->id, 0u);
-  return stream_list_add(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  if (is_writable(s)) return false;
+  return stream_list_add(t, s, writable_list_for(s));
 }
 
 bool grpc_chttp2_list_pop_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream** s) {
-  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  std::array<bool, grpc_core::Http2StreamPriority::kNumClasses> writable;
+  for (size_t i = 0; i < writable.size(); ++i) {
+    writable[i] = !stream_list_empty(t, kWritableLists[i]);
+  }
+  const std::optional<grpc_core::Http2StreamPriority::Class> priority_class =
+      t->writable_class_scheduler.Next(writable);
+  if (!priority_class.has_value()) {
+    *s = nullptr;
+    return false;
+  }
+  return stream_list_pop(t, s,
+                         kWritableLists[static_cast<size_t>(*priority_class)]);
 }
 
 bool grpc_chttp2_list_remove_writable_stream(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s) {
-  return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  for (grpc_chttp2_stream_list_id id : kWritableLists) {
+    if (stream_list_maybe_remove(t, s, id)) return true;
+  }
+  return false;
 }
 
 bool grpc_chttp2_list_add_writing_stream(grpc_chttp2_transport* t,
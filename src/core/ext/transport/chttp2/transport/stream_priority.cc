@@ -0,0 +1,93 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/stream_priority.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <limits>
+#include <utility>
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
+
+namespace grpc_core {
+
+std::optional<Http2StreamPriority> Http2StreamPriority::Parse(
+    absl::string_view value) {
+  Http2StreamPriority priority;
+  bool first = true;
+  for (absl::string_view part : absl::StrSplit(value, ';')) {
+    part = absl::StripAsciiWhitespace(part);
+    if (first) {
+      first = false;
+      if (part == "high") {
+        priority.priority_class = Class::kHigh;
+      } else if (part == "normal") {
+        priority.priority_class = Class::kNormal;
+      } else if (part == "low") {
+        priority.priority_class = Class::kLow;
+      } else {
+        return std::nullopt;
+      }
+      continue;
+    }
+    std::pair<absl::string_view, absl::string_view> param =
+        absl::StrSplit(part, absl::MaxSplits('=', 1));
+    if (absl::StripAsciiWhitespace(param.first) != "weight") {
+      return std::nullopt;
+    }
+    uint32_t weight;
+    if (!absl::SimpleAtoi(absl::StripAsciiWhitespace(param.second), &weight) ||
+        weight == 0 || weight > kMaxWeight) {
+      return std::nullopt;
+    }
+    priority.weight = weight;
+  }
+  return priority;
+}
+
+uint32_t Http2StreamPriority::WriteBudget(uint32_t quantum) const {
+  if (quantum == 0) return std::numeric_limits<uint32_t>::max();
+  const uint64_t budget = static_cast<uint64_t>(quantum) * weight;
+  if (budget > std::numeric_limits<uint32_t>::max()) {
+    return std::numeric_limits<uint32_t>::max();
+  }
+  return static_cast<uint32_t>(budget);
+}
+
+std::optional<Http2StreamPriority::Class> Http2WritableClassScheduler::Next(
+    const std::array<bool, Http2StreamPriority::kNumClasses>& writable) {
+  std::optional<size_t> next;
+  for (size_t i = 0; i < writable.size(); ++i) {
+    if (!writable[i]) continue;
+    if (!next.has_value()) next = i;
+    if (turns_skipped_[i] >= kMaxTurnsSkipped) {
+      next = i;
+      break;
+    }
+  }
+  if (!next.has_value()) return std::nullopt;
+  for (size_t i = 0; i < writable.size(); ++i) {
+    if (i == *next || !writable[i]) {
+      turns_skipped_[i] = 0;
+    } else {
+      ++turns_skipped_[i];
+    }
+  }
+  return static_cast<Http2StreamPriority::Class>(*next);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,85 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_STREAM_PRIORITY_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_STREAM_PRIORITY_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// How the chttp2 transport schedules the DATA frames of one stream against
+// the other writable streams on the same connection.
+//
+// Writable streams are served in order of their priority class (see
+// Http2WritableClassScheduler). Within a class streams take turns, each
+// writing up to weight * quantum bytes per turn, where the quantum is
+// configured per transport.
+//
+// Clients pick the priority of a call by sending the
+// "grpc-stream-priority" metadata, e.g. "low" or "high; weight=4". Servers
+// only schedule their responses with the priority the client asked for when
+// configured to accept it.
+struct Http2StreamPriority {
+  enum class Class : uint8_t { kHigh, kNormal, kLow };
+  static constexpr size_t kNumClasses = 3;
+
+  static constexpr absl::string_view kMetadataKey = "grpc-stream-priority";
+  static constexpr uint32_t kMaxWeight = 64;
+
+  Class priority_class = Class::kNormal;
+  uint32_t weight = 1;
+
+  // Parses a "grpc-stream-priority" metadata value: a class name ("high",
+  // "normal" or "low"), optionally followed by "; weight=N". Returns nullopt
+  // if the value is malformed.
+  static std::optional<Http2StreamPriority> Parse(absl::string_view value);
+
+  // Number of bytes a stream may write in one turn given the transport's
+  // quantum. A quantum of zero means turns are unbounded.
+  uint32_t WriteBudget(uint32_t quantum) const;
+
+  bool operator==(const Http2StreamPriority& other) const {
+    return priority_class == other.priority_class && weight == other.weight;
+  }
+};
+
+// Picks the priority class that the next writable stream is taken from.
+//
+// Classes are served highest first, except that a class which had writable
+// streams but was passed over kMaxTurnsSkipped times in a row is served next.
+// Lower classes are slowed down by higher ones, but never starved.
+class Http2WritableClassScheduler {
+ public:
+  static constexpr uint32_t kMaxTurnsSkipped = 8;
+
+  // \a writable tells, for each class in Class order, whether it has
+  // writable streams. Returns nullopt if none has.
+  std::optional<Http2StreamPriority::Class> Next(
+      const std::array<bool, Http2StreamPriority::kNumClasses>& writable);
+
+ private:
+  std::array<uint32_t, Http2StreamPriority::kNumClasses> turns_skipped_{};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_STREAM_PRIORITY_H
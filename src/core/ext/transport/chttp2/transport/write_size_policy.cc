@@ -17,6 +17,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
+#include <utility>
 
 #include "absl/log/check.h"
 
@@ -57,4 +58,23 @@ void Chttp2WriteSizePolicy::EndWrite(bool success) {
   }
 }
 
+std::optional<Timestamp> Chttp2WriteCoalescingPolicy::HoldUntil(
+    size_t bytes, size_t frames, size_t write_target_size) {
+  if (!enabled()) return std::nullopt;
+  if (bytes >= (max_bytes_ == 0 ? write_target_size : max_bytes_)) {
+    return std::nullopt;
+  }
+  if (max_frames_ != 0 && frames >= max_frames_) return std::nullopt;
+  const Timestamp now = Timestamp::Now();
+  if (held_since_ == Timestamp::InfFuture()) held_since_ = now;
+  const Timestamp deadline = held_since_ + max_delay_;
+  if (now >= deadline) return std::nullopt;
+  return deadline;
+}
+
+Duration Chttp2WriteCoalescingPolicy::Flush() {
+  if (held_since_ == Timestamp::InfFuture()) return Duration::Zero();
+  return Timestamp::Now() - std::exchange(held_since_, Timestamp::InfFuture());
+}
+
 }  // namespace grpc_core
@@ -19,6 +19,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <optional>
+
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -60,6 +62,42 @@ class Chttp2WriteSizePolicy {
   int8_t state_ = 0;
 };
 
+// Decides whether a gathered write may be held back for a little while, so
+// that frames from streams that become writable shortly afterwards go out in
+// the same endpoint write instead of many small ones.
+// A held write is flushed once it reaches max_bytes or max_frames, or once it
+// has been held for max_delay.
+class Chttp2WriteCoalescingPolicy {
+ public:
+  // Default constructed policies never hold writes.
+  Chttp2WriteCoalescingPolicy() = default;
+  // max_bytes == 0 means: use the write target size of the write size policy.
+  // max_frames == 0 means: no limit on the number of frames.
+  Chttp2WriteCoalescingPolicy(Duration max_delay, size_t max_bytes,
+                              size_t max_frames)
+      : max_delay_(max_delay), max_bytes_(max_bytes), max_frames_(max_frames) {}
+
+  bool enabled() const { return max_delay_ > Duration::Zero(); }
+  // Is a write currently being held?
+  bool holding() const { return held_since_ != Timestamp::InfFuture(); }
+
+  // A write of `bytes` bytes in `frames` frames has been gathered. Returns the
+  // time until which it may be held, or nullopt if it should be written now.
+  std::optional<Timestamp> HoldUntil(size_t bytes, size_t frames,
+                                     size_t write_target_size);
+  // Notify the policy that the gathered write is being written. Returns how
+  // long it was held.
+  Duration Flush();
+
+ private:
+  Duration max_delay_ = Duration::Zero();
+  size_t max_bytes_ = 0;
+  size_t max_frames_ = 0;
+  // When the write currently being held was first held, or InfFuture if no
+  // write is held.
+  Timestamp held_since_ = Timestamp::InfFuture();
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_SIZE_POLICY_H
@@ -113,19 +113,22 @@ static grpc_core::Duration NextAllowedPingInterval(grpc_chttp2_transport* t) {
   return grpc_core::Duration::Zero();
 }
 
-static void maybe_initiate_ping(grpc_chttp2_transport* t) {
+// Returns true if a ping was written to outbuf.
+static bool maybe_initiate_ping(grpc_chttp2_transport* t) {
   if (!t->ping_callbacks.ping_requested()) {
     // no ping needed: wait
-    return;
+    return false;
   }
   // InvalidateNow to avoid getting stuck re-initializing the ping timer
   // in a loop while draining the currently-held combiner. Also see
   // https://github.com/grpc/grpc/issues/26079.
   grpc_core::ExecCtx::Get()->InvalidateNow();
+  bool sent = false;
   Match(
       t->ping_rate_policy.RequestSendPing(NextAllowedPingInterval(t),
                                           t->ping_callbacks.pings_inflight()),
-      [t](grpc_core::Chttp2PingRatePolicy::SendGranted) {
+      [t, &sent](grpc_core::Chttp2PingRatePolicy::SendGranted) {
+        sent = true;
         t->ping_rate_policy.SentPing();
         grpc_core::SharedBitGen g;
         const uint64_t id = t->ping_callbacks.StartPing(g);
@@ -186,6 +189,7 @@ static void maybe_initiate_ping(grpc_chttp2_transport* t) {
               });
         }
       });
+  return sent;
 }
 
 static bool update_list(grpc_chttp2_transport* t, int64_t send_bytes,
@@ -257,7 +261,8 @@ namespace {
 
 class WriteContext {
  public:
-  explicit WriteContext(grpc_chttp2_transport* t) : t_(t) {
+  WriteContext(grpc_chttp2_transport* t, bool continuing_held_write) : t_(t) {
+    if (continuing_held_write) return;
     t->http2_stats.IncrementHttp2WritesBegun();
     t->http2_stats.IncrementHttp2WriteTargetSize(target_write_size_);
   }
@@ -284,11 +289,19 @@ class WriteContext {
       }
       t_->flow_control.FlushedSettings();
       grpc_core::global_stats().IncrementHttp2SettingsWrites();
+      ++control_frames_;
+      result_.urgent = true;
     }
   }
 
   void FlushQueuedBuffers() {
     // simple writes are queued to qbuf, and flushed here
+    if (t_->qbuf.length > 0) {
+      // qbuf holds acks, RST_STREAMs and GOAWAYs: the peer is waiting for
+      // those.
+      control_frames_ += std::max<uint32_t>(t_->num_pending_induced_frames, 1);
+      result_.urgent = true;
+    }
     grpc_slice_buffer_move_into(&t_->qbuf, t_->outbuf.c_slice_buffer());
     t_->num_pending_induced_frames = 0;
     CHECK_EQ(t_->qbuf.count, 0u);
@@ -304,6 +317,7 @@ class WriteContext {
           t_->outbuf.c_slice_buffer(),
           grpc_chttp2_window_update_create(0, transport_announce, nullptr));
       grpc_chttp2_reset_ping_clock(t_);
+      ++control_frames_;
     }
   }
 
@@ -318,6 +332,8 @@ class WriteContext {
       grpc_slice_buffer_add(t_->outbuf.c_slice_buffer(),
                             grpc_chttp2_ping_create(true, t_->ping_acks[i]));
     }
+    control_frames_ += t_->ping_ack_count;
+    result_.urgent = true;
     t_->ping_ack_count = 0;
   }
 
@@ -358,6 +374,16 @@ class WriteContext {
   void IncTrailingMetadataWrites() { ++trailing_metadata_writes_; }
 
   void NoteScheduledResults() { result_.early_results_scheduled = true; }
+  void NotePingSent() {
+    ++control_frames_;
+    result_.urgent = true;
+  }
+
+  // Number of frames written to outbuf so far.
+  uint32_t frames() const {
+    return control_frames_ + flow_control_writes_ + initial_metadata_writes_ +
+           trailing_metadata_writes_ + message_writes_;
+  }
 
   grpc_chttp2_transport* transport() const { return t_; }
 
@@ -378,7 +404,8 @@ class WriteContext {
   int initial_metadata_writes_ = 0;
   int trailing_metadata_writes_ = 0;
   int message_writes_ = 0;
-  grpc_chttp2_begin_write_result result_ = {false, false, false};
+  uint32_t control_frames_ = 0;
+  grpc_chttp2_begin_write_result result_ = {false, false, false, false};
 };
 
 class DataSendContext {
@@ -388,7 +415,9 @@ class DataSendContext {
       : write_context_(write_context),
         t_(t),
         s_(s),
-        sending_bytes_before_(s_->sending_bytes) {}
+        sending_bytes_before_(s_->sending_bytes),
+        write_budget_(
+            s_->write_priority.WriteBudget(t_->stream_write_quantum)) {}
 
   uint32_t stream_remote_window() const {
     return static_cast<uint32_t>(std::max(
@@ -405,7 +434,12 @@ class DataSendContext {
              static_cast<int64_t>(write_context_->target_write_size()) -
                  (grpc_core::IsChttp2BoundWriteSizeEnabled()
                       ? static_cast<int64_t>(t_->outbuf.Length())
-                      : static_cast<int64_t>(0))}),
+                      : static_cast<int64_t>(0)),
+             // Once the stream used up its turn, it goes to the back of its
+             // priority class' writable list.
+             static_cast<int64_t>(write_budget_) -
+                 static_cast<int64_t>(s_->sending_bytes -
+                                      sending_bytes_before_)}),
         0, std::numeric_limits<uint32_t>::max());
   }
 
@@ -444,6 +478,7 @@ class DataSendContext {
   grpc_core::chttp2::StreamFlowControl::OutgoingUpdateContext sfc_upd_{
       &s_->flow_control};
   const size_t sending_bytes_before_;
+  const uint32_t write_budget_;
   bool is_last_frame_ = false;
 };
 
@@ -556,6 +591,7 @@ class StreamWriteContext {
     while (s_->flow_controlled_buffer.length > 0 &&
            data_send_context.max_outgoing() > 0) {
       data_send_context.FlushBytes();
+      write_context_->IncMessageWrites();
     }
     grpc_chttp2_reset_ping_clock(t_);
     if (data_send_context.is_last_frame()) {
@@ -567,7 +603,6 @@ class StreamWriteContext {
       GRPC_CHTTP2_STREAM_REF(s_, "chttp2_writing:fork");
       grpc_chttp2_list_add_writable_stream(t_, s_);
     }
-    write_context_->IncMessageWrites();
   }
 
   void FlushTrailingMetadata() {
@@ -676,11 +711,17 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     grpc_chttp2_transport* t) {
   GRPC_LATENT_SEE_INNER_SCOPE("grpc_chttp2_begin_write");
 
-  int64_t outbuf_relative_start_pos = 0;
-  WriteContext ctx(t);
+  // A write held back for coalescing is still in outbuf, and gathering more
+  // frames into it continues the write cycle that it began: end_write is
+  // called once for the whole write.
+  const bool continuing_held_write = t->write_cycle_open;
+  int64_t outbuf_relative_start_pos = t->outbuf.Length();
+  WriteContext ctx(t, continuing_held_write);
 
-  t->http2_ztrace_collector.Append(grpc_core::H2BeginWriteCycle{
-      static_cast<uint32_t>(ctx.target_write_size())});
+  if (!continuing_held_write) {
+    t->http2_ztrace_collector.Append(grpc_core::H2BeginWriteCycle{
+        static_cast<uint32_t>(ctx.target_write_size())});
+  }
 
   ctx.FlushSettings();
   ctx.FlushPingAcks();
@@ -732,17 +773,23 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
 
   ctx.FlushWindowUpdates();
 
-  maybe_initiate_ping(t);
+  if (maybe_initiate_ping(t)) ctx.NotePingSent();
+  t->num_frames_in_next_write += ctx.frames();
 
-  t->write_flow.Begin(GRPC_LATENT_SEE_METADATA("write"));
+  grpc_chttp2_begin_write_result result = ctx.Result();
+  if (result.writing && !continuing_held_write) {
+    t->write_cycle_open = true;
+    t->write_flow.Begin(GRPC_LATENT_SEE_METADATA("write"));
+  }
 
-  return ctx.Result();
+  return result;
 }
 
 void grpc_chttp2_end_write(grpc_chttp2_transport* t, grpc_error_handle error) {
   GRPC_LATENT_SEE_INNER_SCOPE("grpc_chttp2_end_write");
   grpc_chttp2_stream* s;
 
+  t->write_cycle_open = false;
   t->write_flow.End();
   t->http2_ztrace_collector.Append(grpc_core::H2EndWriteCycle{});
 
@@ -750,6 +797,7 @@ void grpc_chttp2_end_write(grpc_chttp2_transport* t, grpc_error_handle error) {
     t->channelz_socket->RecordMessagesSent(t->num_messages_in_next_write);
   }
   t->num_messages_in_next_write = 0;
+  t->num_frames_in_next_write = 0;
 
   if (t->ping_callbacks.started_new_ping_without_setting_timeout() &&
       t->keepalive_timeout != grpc_core::Duration::Infinity()) {
@@ -276,6 +276,29 @@ struct FilterCallData {
       Derived*, filters_detail::CallHasChannelAccess<Derived>()>::Type channel;
 };
 
+// Message interceptors returning a promise may resolve to either
+// ServerMetadataOrHandle<Message> or absl::StatusOr<MessageHandle>: errors
+// are latched, and the message dropped.
+template <typename Derived>
+std::optional<MessageHandle> TakeMessageOrLatchError(
+    FilterCallData<Derived>* call_data, ServerMetadataOrHandle<Message> msg) {
+  if (!msg.ok()) {
+    call_data->error_latch.Set(std::move(msg).TakeMetadata());
+    return std::nullopt;
+  }
+  return std::move(msg).TakeValue();
+}
+
+template <typename Derived>
+std::optional<MessageHandle> TakeMessageOrLatchError(
+    FilterCallData<Derived>* call_data, absl::StatusOr<MessageHandle> msg) {
+  if (msg.ok()) return std::move(*msg);
+  if (!call_data->error_latch.is_set()) {
+    call_data->error_latch.Set(ServerMetadataFromStatus(msg.status()));
+  }
+  return std::nullopt;
+}
+
 template <typename Promise>
 auto MapResult(const NoInterceptor*, Promise x, void*) {
   return x;
@@ -717,13 +740,8 @@ class InterceptClientToServerMessageHandler<Derived, R (Call::*)(MessageHandle),
   auto operator()() {
     return [call_data = call_data_](MessageHandle msg) {
       return Map(call_data->call.OnClientToServerMessage(std::move(msg)),
-                 [call_data](ServerMetadataOrHandle<Message> md)
-                     -> std::optional<MessageHandle> {
-                   if (!md.ok()) {
-                     call_data->error_latch.Set(std::move(md).TakeMetadata());
-                     return std::nullopt;
-                   }
-                   return std::move(md).TakeValue();
+                 [call_data](auto md) {
+                   return TakeMessageOrLatchError(call_data, std::move(md));
                  });
     };
   }
@@ -746,13 +764,8 @@ class InterceptClientToServerMessageHandler<
     return [call_data = call_data_](MessageHandle msg) {
       return Map(call_data->call.OnClientToServerMessage(std::move(msg),
                                                          call_data->channel),
-                 [call_data](ServerMetadataOrHandle<Message> md)
-                     -> std::optional<MessageHandle> {
-                   if (!md.ok()) {
-                     call_data->error_latch.Set(std::move(md).TakeMetadata());
-                     return std::nullopt;
-                   }
-                   return std::move(md).TakeValue();
+                 [call_data](auto md) {
+                   return TakeMessageOrLatchError(call_data, std::move(md));
                  });
     };
   }
@@ -1037,13 +1050,8 @@ struct InterceptServerToClientMessage<Derived, R (Call::*)(MessageHandle),
         [call_data](MessageHandle msg) {
           return Map(
               call_data->call.OnServerToClientMessage(std::move(msg)),
-              [call_data](ServerMetadataOrHandle<Message> msg)
-                  -> std::optional<MessageHandle> {
-                if (!msg.ok()) {
-                  call_data->error_latch.Set(std::move(msg).TakeMetadata());
-                  return std::nullopt;
-                }
-                return std::move(msg).TakeValue();
+              [call_data](auto msg) {
+                return TakeMessageOrLatchError(call_data, std::move(msg));
               });
         });
   }
@@ -1061,13 +1069,8 @@ struct InterceptServerToClientMessage<
           return Map(
               call_data->call.OnServerToClientMessage(std::move(msg),
                                                       call_data->channel),
-              [call_data](ServerMetadataOrHandle<Message> msg)
-                  -> std::optional<MessageHandle> {
-                if (!msg.ok()) {
-                  call_data->error_latch.Set(std::move(msg).TakeMetadata());
-                  return std::nullopt;
-                }
-                return std::move(msg).TakeValue();
+              [call_data](auto msg) {
+                return TakeMessageOrLatchError(call_data, std::move(msg));
               });
         });
   }
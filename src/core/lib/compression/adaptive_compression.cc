@@ -0,0 +1,139 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/compression/adaptive_compression.h"
+
+#include <grpc/slice.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+#ifdef GPR_POSIX_TIME
+#include <time.h>
+#endif
+
+namespace grpc_core {
+
+namespace {
+
+constexpr int64_t kCpuSamplePeriodNanos = 100 * 1000 * 1000;
+
+// CPU time used by the process so far, or -1 if unknown.
+int64_t ProcessCpuNanos() {
+#if defined(GPR_POSIX_TIME) && defined(CLOCK_PROCESS_CPUTIME_ID)
+  timespec ts;
+  if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0) return -1;
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#else
+  return -1;
+#endif
+}
+
+}  // namespace
+
+double EstimateEntropy(const grpc_slice_buffer* input) {
+  constexpr size_t kRunLength = 64;
+  const size_t length = input->length;
+  // Distance between the starts of successive runs: small inputs are read
+  // whole.
+  const size_t stride =
+      length <= kEntropySampleSize
+          ? kRunLength
+          : length / (kEntropySampleSize / kRunLength);
+  uint32_t counts[256] = {};
+  size_t sampled = 0;
+  size_t slice = 0;
+  // Offset of input->slices[slice] in input.
+  size_t slice_offset = 0;
+  for (size_t start = 0; start < length && sampled < kEntropySampleSize;
+       start += stride) {
+    size_t position = start;
+    size_t remaining = std::min(kRunLength, length - start);
+    while (remaining > 0) {
+      while (position >=
+             slice_offset + GRPC_SLICE_LENGTH(input->slices[slice])) {
+        slice_offset += GRPC_SLICE_LENGTH(input->slices[slice]);
+        ++slice;
+      }
+      const grpc_slice& s = input->slices[slice];
+      const uint8_t* p = GRPC_SLICE_START_PTR(s) + (position - slice_offset);
+      const size_t n = std::min(
+          remaining, slice_offset + GRPC_SLICE_LENGTH(s) - position);
+      for (size_t i = 0; i < n; i++) ++counts[p[i]];
+      position += n;
+      remaining -= n;
+      sampled += n;
+    }
+  }
+  if (sampled == 0) return 0;
+  double entropy = 0;
+  for (uint32_t count : counts) {
+    if (count == 0) continue;
+    const double p = static_cast<double>(count) / sampled;
+    entropy -= p * std::log2(p);
+  }
+  return entropy;
+}
+
+double ProcessCpuUtilization() {
+  static std::atomic<int64_t> last_wall_nanos{0};
+  static std::atomic<int64_t> last_cpu_nanos{-1};
+  static std::atomic<int> utilization_permille{0};
+  const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+  int64_t last = last_wall_nanos.load(std::memory_order_relaxed);
+  // One caller per period takes the sample; the rest use the last one.
+  if (now - last >= kCpuSamplePeriodNanos &&
+      last_wall_nanos.compare_exchange_strong(last, now,
+                                              std::memory_order_relaxed)) {
+    const int64_t cpu = ProcessCpuNanos();
+    const int64_t last_cpu =
+        last_cpu_nanos.exchange(cpu, std::memory_order_relaxed);
+    if (cpu >= 0 && last_cpu >= 0) {
+      const double capacity =
+          static_cast<double>(now - last) * gpr_cpu_num_cores();
+      utilization_permille.store(
+          static_cast<int>(std::min(1.0, (cpu - last_cpu) / capacity) * 1000),
+          std::memory_order_relaxed);
+    }
+  }
+  return utilization_permille.load(std::memory_order_relaxed) / 1000.0;
+}
+
+AdaptiveCompressionPolicy::Decision AdaptiveCompressionPolicy::Decide(
+    const grpc_slice_buffer* payload) {
+  if (cpu_utilization_() > kMaxCpuUtilization) return Decision::kSkipCpuBusy;
+  if (misses_ >= kMaxMisses) {
+    if (++skipped_ < kProbeInterval) return Decision::kSkipIncompressible;
+    // Try again, in case the call's messages changed.
+    skipped_ = 0;
+  }
+  if (payload->length >= kMinSampledLength &&
+      EstimateEntropy(payload) > kMaxEntropy) {
+    return Decision::kSkipIncompressible;
+  }
+  return Decision::kCompress;
+}
+
+void AdaptiveCompressionPolicy::RecordResult(bool shrank) {
+  misses_ = shrank ? 0 : misses_ + 1;
+}
+
+}  // namespace grpc_core
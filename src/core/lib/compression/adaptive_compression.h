@@ -0,0 +1,74 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_COMPRESSION_ADAPTIVE_COMPRESSION_H
+#define GRPC_SRC_CORE_LIB_COMPRESSION_ADAPTIVE_COMPRESSION_H
+
+#include <grpc/slice_buffer.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+namespace grpc_core {
+
+// Shannon entropy of input in bits per byte, from 0 (one repeated byte) to 8
+// (uniformly random). Estimated from at most kEntropySampleSize bytes, taken
+// in runs spread over the whole input.
+inline constexpr size_t kEntropySampleSize = 4096;
+double EstimateEntropy(const grpc_slice_buffer* input);
+
+// The share of all cores this process used since the previous sample, from 0
+// to 1. Samples are taken at most every 100ms; until there are two, and on
+// platforms without a process CPU clock, returns 0.
+double ProcessCpuUtilization();
+
+// Decides, message by message, whether compressing a call's messages is worth
+// the CPU. Skips messages that look incompressible (already compressed media,
+// ciphertext), calls whose messages keep not shrinking, and everything while
+// the process is short of CPU.
+class AdaptiveCompressionPolicy {
+ public:
+  enum class Decision { kCompress, kSkipIncompressible, kSkipCpuBusy };
+
+  // Messages above this many bits per byte are not worth compressing.
+  static constexpr double kMaxEntropy = 7.5;
+  // Messages shorter than this are compressed without sampling: the codec
+  // gives up on them as cheaply as sampling would.
+  static constexpr size_t kMinSampledLength = 256;
+  // Attempts in a row that did not shrink before the call stops trying...
+  static constexpr int kMaxMisses = 3;
+  // ...but for one message in every kProbeInterval.
+  static constexpr int kProbeInterval = 16;
+  // Process CPU utilization above which nothing is compressed.
+  static constexpr double kMaxCpuUtilization = 0.9;
+
+  // cpu_utilization is for tests.
+  explicit AdaptiveCompressionPolicy(
+      double (*cpu_utilization)() = ProcessCpuUtilization)
+      : cpu_utilization_(cpu_utilization) {}
+
+  Decision Decide(const grpc_slice_buffer* payload);
+  // Reports whether the message Decide() last allowed shrank.
+  void RecordResult(bool shrank);
+
+ private:
+  double (*cpu_utilization_)();
+  // Attempts in a row that did not shrink.
+  int misses_ = 0;
+  // Messages skipped since the last attempt, while misses_ >= kMaxMisses.
+  int skipped_ = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_COMPRESSION_ADAPTIVE_COMPRESSION_H
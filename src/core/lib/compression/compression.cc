@@ -71,8 +71,9 @@ grpc_compression_algorithm grpc_compression_algorithm_for_level(
 
 void grpc_compression_options_init(grpc_compression_options* opts) {
   memset(opts, 0, sizeof(*opts));
-  // all enabled by default
-  opts->enabled_algorithms_bitset = (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1;
+  // all supported algorithms enabled by default
+  opts->enabled_algorithms_bitset =
+      grpc_core::CompressionAlgorithmSet::Supported().ToLegacyBitmask();
 }
 
 void grpc_compression_options_enable_algorithm(
@@ -30,6 +30,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_split.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/compression/zstd_compression.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -45,6 +46,8 @@ const char* CompressionAlgorithmAsString(grpc_compression_algorithm algorithm) {
       return "deflate";
     case GRPC_COMPRESS_GZIP:
       return "gzip";
+    case GRPC_COMPRESS_ZSTD:
+      return "zstd";
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
     default:
       return nullptr;
@@ -85,7 +88,7 @@ class CommaSeparatedLists {
  private:
   static constexpr size_t kNumLists = 1 << GRPC_COMPRESS_ALGORITHMS_COUNT;
   // Experimentally determined (tweak things until it runs).
-  static constexpr size_t kTextBufferSize = 86;
+  static constexpr size_t kTextBufferSize = 218;
   absl::string_view lists_[kNumLists];
   char text_buffer_[kTextBufferSize];
 };
@@ -101,6 +104,8 @@ std::optional<grpc_compression_algorithm> ParseCompressionAlgorithm(
     return GRPC_COMPRESS_DEFLATE;
   } else if (algorithm == "gzip") {
     return GRPC_COMPRESS_GZIP;
+  } else if (algorithm == "zstd") {
+    return GRPC_COMPRESS_ZSTD;
   } else {
     return std::nullopt;
   }
@@ -127,6 +132,8 @@ CompressionAlgorithmSet::CompressionAlgorithmForLevel(
   absl::InlinedVector<grpc_compression_algorithm,
                       GRPC_COMPRESS_ALGORITHMS_COUNT>
       algos;
+  // zstd is only ever used when asked for by name: mapping levels to it would
+  // change what existing level users send to peers that accept it.
   for (auto algo : {GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE}) {
     if (set_.is_set(algo)) {
       algos.push_back(algo);
@@ -163,12 +170,18 @@ CompressionAlgorithmSet CompressionAlgorithmSet::FromUint32(uint32_t value) {
 
 CompressionAlgorithmSet CompressionAlgorithmSet::FromChannelArgs(
     const ChannelArgs& args) {
-  CompressionAlgorithmSet set;
-  static const uint32_t kEverything =
-      (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1;
+  const uint32_t supported = Supported().ToLegacyBitmask();
   return CompressionAlgorithmSet::FromUint32(
       args.GetInt(GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET)
-          .value_or(kEverything));
+          .value_or(supported) &
+      supported);
+}
+
+CompressionAlgorithmSet CompressionAlgorithmSet::Supported() {
+  CompressionAlgorithmSet set{GRPC_COMPRESS_NONE, GRPC_COMPRESS_DEFLATE,
+                              GRPC_COMPRESS_GZIP};
+  if (kZstdSupported) set.Set(GRPC_COMPRESS_ZSTD);
+  return set;
 }
 
 CompressionAlgorithmSet::CompressionAlgorithmSet() = default;
@@ -51,8 +51,11 @@ class CompressionAlgorithmSet {
   // Construct from a uint32_t bitmask - bit 0 => algorithm 0, bit 1 =>
   // algorithm 1, etc.
   static CompressionAlgorithmSet FromUint32(uint32_t value);
-  // Locate in channel args and construct from the found value.
+  // Locate in channel args and construct from the found value, leaving out
+  // algorithms this build does not support.
   static CompressionAlgorithmSet FromChannelArgs(const ChannelArgs& args);
+  // The algorithms this build can compress and decompress with.
+  static CompressionAlgorithmSet Supported();
   // Parse a string of comma-separated compression algorithms.
   static CompressionAlgorithmSet FromString(absl::string_view str);
   // Construct an empty set.
@@ -25,8 +25,12 @@
 #include <zconf.h>
 #include <zlib.h>
 
+#include <algorithm>
+#include <memory>
+
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/string_view.h"
 #include "src/core/lib/slice/slice.h"
 
 #define OUTPUT_BLOCK_SIZE 1024
@@ -149,6 +153,7 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
 }
 
 static int compress_inner(grpc_compression_algorithm algorithm,
+                          const grpc_core::MessageCompressionOptions& options,
                           grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
@@ -159,6 +164,9 @@ static int compress_inner(grpc_compression_algorithm algorithm,
       return zlib_compress(input, output, 0);
     case GRPC_COMPRESS_GZIP:
       return zlib_compress(input, output, 1);
+    case GRPC_COMPRESS_ZSTD:
+      return grpc_core::ZstdCompress(input, output, options.zstd_level,
+                                     options.zstd_dictionary);
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -168,7 +176,14 @@ static int compress_inner(grpc_compression_algorithm algorithm,
 
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+  return grpc_msg_compress(algorithm, grpc_core::MessageCompressionOptions(),
+                           input, output);
+}
+
+int grpc_msg_compress(grpc_compression_algorithm algorithm,
+                      const grpc_core::MessageCompressionOptions& options,
+                      grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  if (!compress_inner(algorithm, options, input, output)) {
     copy(input, output);
     return 0;
   }
@@ -177,6 +192,13 @@ int grpc_msg_compress(grpc_compression_algorithm algorithm,
 
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  return grpc_msg_decompress(algorithm, grpc_core::MessageCompressionOptions(),
+                             input, output);
+}
+
+int grpc_msg_decompress(grpc_compression_algorithm algorithm,
+                        const grpc_core::MessageCompressionOptions& options,
+                        grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
       return copy(input, output);
@@ -184,9 +206,191 @@ int grpc_msg_decompress(grpc_compression_algorithm algorithm,
       return zlib_decompress(input, output, 0);
     case GRPC_COMPRESS_GZIP:
       return zlib_decompress(input, output, 1);
+    case GRPC_COMPRESS_ZSTD:
+      return grpc_core::ZstdDecompress(input, output,
+                                       options.zstd_dictionaries);
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
   LOG(ERROR) << "invalid compression algorithm " << algorithm;
   return 0;
 }
+
+namespace grpc_core {
+namespace {
+
+class ZlibCompressor final : public StreamingCompressor {
+ public:
+  ZlibCompressor(bool gzip, bool context_takeover)
+      : context_takeover_(context_takeover) {
+    memset(&zs_, 0, sizeof(zs_));
+    zs_.zalloc = zalloc_gpr;
+    zs_.zfree = zfree_gpr;
+    int r = deflateInit2(&zs_, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                         15 | (gzip ? 16 : 0), 8, Z_DEFAULT_STRATEGY);
+    CHECK(r == Z_OK);
+  }
+
+  ~ZlibCompressor() override { deflateEnd(&zs_); }
+
+  bool Compress(const grpc_slice_buffer* input,
+                grpc_slice_buffer* output) override {
+    if (broken_) return false;
+    if (!context_takeover_ && started_) deflateReset(&zs_);
+    started_ = true;
+    // A sync flush ends each message on a byte boundary without ending the
+    // stream.
+    const int last = context_takeover_ ? Z_SYNC_FLUSH : Z_FINISH;
+    // Even an empty message needs its flush.
+    const size_t steps = std::max<size_t>(input->count, 1);
+    for (size_t i = 0; i < steps; i++) {
+      zs_.next_in = nullptr;
+      zs_.avail_in = 0;
+      if (i < input->count) {
+        CHECK(GRPC_SLICE_LENGTH(input->slices[i]) <= ~uInt{0});
+        zs_.next_in = GRPC_SLICE_START_PTR(input->slices[i]);
+        zs_.avail_in = static_cast<uInt>(GRPC_SLICE_LENGTH(input->slices[i]));
+      }
+      const int flush = i + 1 == steps ? last : Z_NO_FLUSH;
+      int r;
+      do {
+        const size_t available = writer_.available();
+        zs_.next_out = writer_.data();
+        zs_.avail_out = static_cast<uInt>(available);
+        r = deflate(&zs_, flush);
+        writer_.Commit(available - zs_.avail_out);
+        if (r < 0 && r != Z_BUF_ERROR /* not fatal */) {
+          VLOG(2) << "zlib error (" << r << ")";
+          writer_.Abandon();
+          broken_ = context_takeover_;
+          return false;
+        }
+        if (!context_takeover_ && writer_.written() >= input->length) {
+          writer_.Abandon();
+          return false;
+        }
+      } while (flush == Z_FINISH ? r != Z_STREAM_END : zs_.avail_out == 0);
+    }
+    writer_.Finish(output);
+    return true;
+  }
+
+ private:
+  z_stream zs_;
+  const bool context_takeover_;
+  bool started_ = false;
+  bool broken_ = false;
+  PooledSliceWriter writer_;
+};
+
+class ZlibDecompressor final : public StreamingDecompressor {
+ public:
+  ZlibDecompressor(bool gzip, bool context_takeover)
+      : context_takeover_(context_takeover) {
+    memset(&zs_, 0, sizeof(zs_));
+    zs_.zalloc = zalloc_gpr;
+    zs_.zfree = zfree_gpr;
+    int r = inflateInit2(&zs_, 15 | (gzip ? 16 : 0));
+    CHECK(r == Z_OK);
+  }
+
+  ~ZlibDecompressor() override { inflateEnd(&zs_); }
+
+  bool Decompress(const grpc_slice_buffer* input,
+                  grpc_slice_buffer* output) override {
+    if (broken_) return false;
+    if (!context_takeover_ && started_) inflateReset(&zs_);
+    started_ = true;
+    int r = Z_OK;
+    bool output_full = false;
+    for (size_t i = 0; i < input->count; i++) {
+      CHECK(GRPC_SLICE_LENGTH(input->slices[i]) <= ~uInt{0});
+      zs_.next_in = GRPC_SLICE_START_PTR(input->slices[i]);
+      zs_.avail_in = static_cast<uInt>(GRPC_SLICE_LENGTH(input->slices[i]));
+      while (zs_.avail_in > 0) {
+        if (r == Z_STREAM_END) return Fail("trailing data");
+        if (!Step(&r, &output_full)) return false;
+        if (r == Z_BUF_ERROR && !output_full) return Fail("stuck");
+      }
+    }
+    // zlib may hold output it had no room for.
+    while (output_full && r != Z_STREAM_END) {
+      if (!Step(&r, &output_full)) return false;
+    }
+    if (!context_takeover_ && r != Z_STREAM_END) return Fail("truncated");
+    writer_.Finish(output);
+    return true;
+  }
+
+ private:
+  bool Step(int* r, bool* output_full) {
+    const size_t available = writer_.available();
+    zs_.next_out = writer_.data();
+    zs_.avail_out = static_cast<uInt>(available);
+    *r = inflate(&zs_, Z_NO_FLUSH);
+    writer_.Commit(available - zs_.avail_out);
+    if (*r < 0 && *r != Z_BUF_ERROR /* not fatal */) return Fail("error");
+    *output_full = zs_.avail_out == 0;
+    return true;
+  }
+
+  bool Fail(absl::string_view why) {
+    VLOG(2) << "zlib: " << why;
+    writer_.Abandon();
+    broken_ = context_takeover_;
+    return false;
+  }
+
+  z_stream zs_;
+  const bool context_takeover_;
+  bool started_ = false;
+  bool broken_ = false;
+  PooledSliceWriter writer_;
+};
+
+}  // namespace
+
+std::unique_ptr<StreamingCompressor> MakeStreamingCompressor(
+    grpc_compression_algorithm algorithm,
+    const MessageCompressionOptions& options) {
+  switch (algorithm) {
+    case GRPC_COMPRESS_NONE:
+      return nullptr;
+    case GRPC_COMPRESS_DEFLATE:
+      return std::make_unique<ZlibCompressor>(false, options.context_takeover);
+    case GRPC_COMPRESS_GZIP:
+      return std::make_unique<ZlibCompressor>(true, options.context_takeover);
+    case GRPC_COMPRESS_ZSTD:
+      return MakeZstdStreamingCompressor(options.zstd_level,
+                                         options.zstd_dictionary,
+                                         options.context_takeover);
+    case GRPC_COMPRESS_ALGORITHMS_COUNT:
+      break;
+  }
+  LOG(ERROR) << "invalid compression algorithm " << algorithm;
+  return nullptr;
+}
+
+std::unique_ptr<StreamingDecompressor> MakeStreamingDecompressor(
+    grpc_compression_algorithm algorithm,
+    const MessageCompressionOptions& options) {
+  switch (algorithm) {
+    case GRPC_COMPRESS_NONE:
+      return nullptr;
+    case GRPC_COMPRESS_DEFLATE:
+      return std::make_unique<ZlibDecompressor>(false,
+                                                options.context_takeover);
+    case GRPC_COMPRESS_GZIP:
+      return std::make_unique<ZlibDecompressor>(true,
+                                                options.context_takeover);
+    case GRPC_COMPRESS_ZSTD:
+      return MakeZstdStreamingDecompressor(options.zstd_dictionaries,
+                                           options.context_takeover);
+    case GRPC_COMPRESS_ALGORITHMS_COUNT:
+      break;
+  }
+  LOG(ERROR) << "invalid compression algorithm " << algorithm;
+  return nullptr;
+}
+
+}  // namespace grpc_core
@@ -23,6 +23,11 @@
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 
+#include <memory>
+
+#include "src/core/lib/compression/streaming_compression.h"
+#include "src/core/lib/compression/zstd_compression.h"
+
 // compress 'input' to 'output' using 'algorithm'.
 // On success, appends compressed slices to output and returns 1.
 // On failure, appends uncompressed slices to output and returns 0.
@@ -35,4 +40,37 @@ int grpc_msg_compress(grpc_compression_algorithm algorithm,
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+namespace grpc_core {
+
+// Settings for the algorithms that take any; the defaults are what the
+// functions above use.
+struct MessageCompressionOptions {
+  int zstd_level = kDefaultZstdCompressionLevel;
+  // Dictionary to compress with, if any.
+  const ZstdDictionary* zstd_dictionary = nullptr;
+  // Dictionaries incoming zstd frames may refer to, if any.
+  const ZstdDictionaries* zstd_dictionaries = nullptr;
+  // Streaming codecs only: whether to keep the context across messages.
+  bool context_takeover = false;
+};
+
+// Per-call codecs for algorithm, or null for GRPC_COMPRESS_NONE and for
+// algorithms this build lacks.
+std::unique_ptr<StreamingCompressor> MakeStreamingCompressor(
+    grpc_compression_algorithm algorithm,
+    const MessageCompressionOptions& options);
+std::unique_ptr<StreamingDecompressor> MakeStreamingDecompressor(
+    grpc_compression_algorithm algorithm,
+    const MessageCompressionOptions& options);
+
+}  // namespace grpc_core
+
+int grpc_msg_compress(grpc_compression_algorithm algorithm,
+                      const grpc_core::MessageCompressionOptions& options,
+                      grpc_slice_buffer* input, grpc_slice_buffer* output);
+
+int grpc_msg_decompress(grpc_compression_algorithm algorithm,
+                        const grpc_core::MessageCompressionOptions& options,
+                        grpc_slice_buffer* input, grpc_slice_buffer* output);
+
 #endif  // GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
@@ -0,0 +1,94 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/compression/streaming_compression.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_core {
+
+PooledSliceWriter::~PooledSliceWriter() {
+  Abandon();
+  CSliceUnref(block_);
+}
+
+uint8_t* PooledSliceWriter::data() {
+  if (used_ == GRPC_SLICE_LENGTH(block_)) NextBlock();
+  return GRPC_SLICE_START_PTR(block_) + used_;
+}
+
+size_t PooledSliceWriter::available() {
+  if (used_ == GRPC_SLICE_LENGTH(block_)) NextBlock();
+  return GRPC_SLICE_LENGTH(block_) - used_;
+}
+
+void PooledSliceWriter::NextBlock() {
+  if (used_ > start_) {
+    pending_.push_back(grpc_slice_sub(block_, start_, used_));
+    pending_length_ += used_ - start_;
+  }
+  CSliceUnref(block_);
+  block_ = grpc_slice_malloc_large(next_block_size_);
+  next_block_size_ = std::min(next_block_size_ * 2, kMaxBlockSize);
+  used_ = 0;
+  start_ = 0;
+}
+
+void PooledSliceWriter::Finish(grpc_slice_buffer* output) {
+  for (const grpc_slice& slice : pending_) {
+    grpc_slice_buffer_add(output, slice);
+  }
+  pending_.clear();
+  pending_length_ = 0;
+  if (used_ > start_) {
+    const size_t length = used_ - start_;
+    if (GRPC_SLICE_LENGTH(block_) > kMinBlockSize &&
+        2 * length < GRPC_SLICE_LENGTH(block_)) {
+      grpc_slice_buffer_add(
+          output, grpc_slice_from_copied_buffer(
+                      reinterpret_cast<const char*>(
+                          GRPC_SLICE_START_PTR(block_) + start_),
+                      length));
+    } else {
+      grpc_slice_buffer_add(output, grpc_slice_sub(block_, start_, used_));
+    }
+    start_ = used_;
+  }
+  MaybeReleaseBlock();
+}
+
+void PooledSliceWriter::Abandon() {
+  for (const grpc_slice& slice : pending_) {
+    CSliceUnref(slice);
+  }
+  pending_.clear();
+  pending_length_ = 0;
+  used_ = start_;
+  MaybeReleaseBlock();
+}
+
+void PooledSliceWriter::MaybeReleaseBlock() {
+  if (GRPC_SLICE_LENGTH(block_) <= kMinBlockSize) return;
+  CSliceUnref(block_);
+  block_ = grpc_empty_slice();
+  used_ = 0;
+  start_ = 0;
+  next_block_size_ = kMinBlockSize;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,112 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_COMPRESSION_STREAMING_COMPRESSION_H
+#define GRPC_SRC_CORE_LIB_COMPRESSION_STREAMING_COMPRESSION_H
+
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace grpc_core {
+
+// Compresses the successive messages of one call. The codec is set up once and
+// reset between messages instead of being rebuilt for each.
+//
+// With context takeover, messages are not reset between: each is flushed at a
+// byte boundary and compressed against the history of those before it, so
+// only a decompressor in the same mode that has seen every earlier message
+// can decompress it.
+class StreamingCompressor {
+ public:
+  virtual ~StreamingCompressor() = default;
+
+  // Compresses input, reading it slice by slice, and appends the result to
+  // output. Without context takeover, returns false and leaves output
+  // untouched when the result would not be smaller than the input. With it,
+  // only fails on codec errors, after which the compressor is unusable.
+  virtual bool Compress(const grpc_slice_buffer* input,
+                        grpc_slice_buffer* output) = 0;
+};
+
+class StreamingDecompressor {
+ public:
+  virtual ~StreamingDecompressor() = default;
+
+  // Decompresses input, reading it slice by slice, and appends the result to
+  // output. On failure returns false and leaves output untouched; with context
+  // takeover the decompressor is unusable afterwards.
+  virtual bool Decompress(const grpc_slice_buffer* input,
+                          grpc_slice_buffer* output) = 0;
+};
+
+// Output space for codecs, carved from blocks shared by successive outputs:
+// what one message produces is appended as sub-slices of the blocks, so small
+// messages do not each cost an allocation. Blocks start small and double as
+// they fill, up to kMaxBlockSize.
+//
+// Only kMinBlockSize blocks are shared between outputs. A larger block holds
+// the end of one large output and is let go once it is finished, so that a
+// small output kept around (e.g. queued on a slow stream) cannot pin it; if
+// that end uses less than half of the block, it is copied out of it instead.
+class PooledSliceWriter {
+ public:
+  static constexpr size_t kMinBlockSize = 1024;
+  static constexpr size_t kMaxBlockSize = 64 * 1024;
+
+  PooledSliceWriter() = default;
+  ~PooledSliceWriter();
+
+  PooledSliceWriter(const PooledSliceWriter&) = delete;
+  PooledSliceWriter& operator=(const PooledSliceWriter&) = delete;
+
+  // Room to write into: never empty.
+  uint8_t* data();
+  size_t available();
+  // Records that n bytes were written at data().
+  void Commit(size_t n) { used_ += n; }
+  // Bytes written since the last Finish() or Abandon().
+  size_t written() const { return pending_length_ + (used_ - start_); }
+
+  // Appends what was written since the last Finish() or Abandon() to output.
+  void Finish(grpc_slice_buffer* output);
+  // Drops what was written since the last Finish() or Abandon().
+  void Abandon();
+
+  // Size of the block outputs are being carved from, 0 if none.
+  size_t block_size() const { return GRPC_SLICE_LENGTH(block_); }
+
+ private:
+  void NextBlock();
+  // Lets go of a block larger than kMinBlockSize, once no output is written
+  // to it.
+  void MaybeReleaseBlock();
+
+  grpc_slice block_ = grpc_empty_slice();
+  // Bytes of block_ in use, and where the current output starts in it.
+  size_t used_ = 0;
+  size_t start_ = 0;
+  size_t next_block_size_ = kMinBlockSize;
+  // Parts of the current output in earlier blocks.
+  std::vector<grpc_slice> pending_;
+  size_t pending_length_ = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_COMPRESSION_STREAMING_COMPRESSION_H
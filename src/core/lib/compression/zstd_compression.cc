@@ -0,0 +1,565 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/compression/zstd_compression.h"
+
+#include <grpc/slice.h>
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "absl/log/log.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/str_split.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/load_file.h"
+
+#ifdef GRPC_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace grpc_core {
+
+namespace {
+
+// Dictionaries in zstd's format start with this, then their id.
+constexpr uint32_t kZstdDictionaryMagic = 0xEC30A437;
+
+uint32_t ReadLittleEndian32(const char* p) {
+  const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+  return static_cast<uint32_t>(u[0]) | (static_cast<uint32_t>(u[1]) << 8) |
+         (static_cast<uint32_t>(u[2]) << 16) |
+         (static_cast<uint32_t>(u[3]) << 24);
+}
+
+#ifdef GRPC_HAVE_ZSTD
+
+// Large enough for any frame header.
+constexpr size_t kMaxFrameHeaderSize = 18;
+// Cap on the first output block, whatever the frame header claims.
+constexpr size_t kMaxInitialOutputBlockSize = 1024 * 1024;
+constexpr size_t kMinOutputBlockSize = 64;
+
+// Contexts are expensive to set up and are reset before every use, so each
+// thread keeps one of each.
+ZSTD_CCtx* ThreadCompressionContext() {
+  struct Deleter {
+    void operator()(ZSTD_CCtx* cctx) const { ZSTD_freeCCtx(cctx); }
+  };
+  static thread_local std::unique_ptr<ZSTD_CCtx, Deleter> cctx(
+      ZSTD_createCCtx());
+  return cctx.get();
+}
+
+ZSTD_DCtx* ThreadDecompressionContext() {
+  struct Deleter {
+    void operator()(ZSTD_DCtx* dctx) const { ZSTD_freeDCtx(dctx); }
+  };
+  static thread_local std::unique_ptr<ZSTD_DCtx, Deleter> dctx(
+      ZSTD_createDCtx());
+  return dctx.get();
+}
+
+// The frame header, which names the dictionary, may be split across slices.
+size_t CopyFrameHeader(const grpc_slice_buffer* input,
+                       char (&header)[kMaxFrameHeaderSize]) {
+  size_t header_length = 0;
+  for (size_t i = 0; i < input->count && header_length < sizeof(header); i++) {
+    const size_t n = std::min(GRPC_SLICE_LENGTH(input->slices[i]),
+                              sizeof(header) - header_length);
+    memcpy(header + header_length, GRPC_SLICE_START_PTR(input->slices[i]), n);
+    header_length += n;
+  }
+  return header_length;
+}
+
+// Readies dctx for the frame that starts with header, with the dictionary it
+// was compressed with.
+bool ResetForFrame(ZSTD_DCtx* dctx, const char* header, size_t header_length,
+                   const ZstdDictionaries* dictionaries) {
+  ZSTD_DCtx_reset(dctx, ZSTD_reset_session_and_parameters);
+  const uint32_t dictionary_id =
+      ZSTD_getDictID_fromFrame(header, header_length);
+  if (dictionary_id == 0) return true;
+  const ZstdDictionary* dictionary =
+      dictionaries == nullptr ? nullptr : dictionaries->ForId(dictionary_id);
+  if (dictionary == nullptr) {
+    VLOG(2) << "zstd: unknown dictionary " << dictionary_id;
+    return false;
+  }
+  ZSTD_DCtx_refDDict(dctx, dictionary->DecompressionDictionary());
+  return true;
+}
+
+class ZstdStreamingCompressor final : public StreamingCompressor {
+ public:
+  ZstdStreamingCompressor(int level, const ZstdDictionary* dictionary,
+                          bool context_takeover)
+      : cctx_(ZSTD_createCCtx()), context_takeover_(context_takeover) {
+    const ZSTD_CDict* cdict = dictionary == nullptr
+                                  ? nullptr
+                                  : dictionary->CompressionDictionary(level);
+    if (cdict != nullptr) {
+      ZSTD_CCtx_refCDict(cctx_, cdict);
+    } else {
+      ZSTD_CCtx_setParameter(cctx_, ZSTD_c_compressionLevel, level);
+    }
+  }
+
+  ~ZstdStreamingCompressor() override { ZSTD_freeCCtx(cctx_); }
+
+  bool Compress(const grpc_slice_buffer* input,
+                grpc_slice_buffer* output) override {
+    if (broken_) return false;
+    if (!context_takeover_) {
+      // A new frame for every message; the level and dictionary stay.
+      ZSTD_CCtx_reset(cctx_, ZSTD_reset_session_only);
+      ZSTD_CCtx_setPledgedSrcSize(cctx_, input->length);
+    }
+    const ZSTD_EndDirective last =
+        context_takeover_ ? ZSTD_e_flush : ZSTD_e_end;
+    // Even an empty message needs its flush.
+    const size_t steps = std::max<size_t>(input->count, 1);
+    for (size_t i = 0; i < steps; i++) {
+      ZSTD_inBuffer in = {nullptr, 0, 0};
+      if (i < input->count) {
+        in = {GRPC_SLICE_START_PTR(input->slices[i]),
+              GRPC_SLICE_LENGTH(input->slices[i]), 0};
+      }
+      const ZSTD_EndDirective mode = i + 1 == steps ? last : ZSTD_e_continue;
+      bool done;
+      do {
+        ZSTD_outBuffer out = {writer_.data(), writer_.available(), 0};
+        const size_t r = ZSTD_compressStream2(cctx_, &out, &in, mode);
+        writer_.Commit(out.pos);
+        if (ZSTD_isError(r)) {
+          VLOG(2) << "zstd error: " << ZSTD_getErrorName(r);
+          writer_.Abandon();
+          broken_ = context_takeover_;
+          return false;
+        }
+        if (!context_takeover_ && writer_.written() >= input->length) {
+          writer_.Abandon();
+          return false;
+        }
+        done = mode == ZSTD_e_continue ? in.pos == in.size : r == 0;
+      } while (!done);
+    }
+    writer_.Finish(output);
+    return true;
+  }
+
+ private:
+  ZSTD_CCtx* const cctx_;
+  const bool context_takeover_;
+  bool broken_ = false;
+  PooledSliceWriter writer_;
+};
+
+class ZstdStreamingDecompressor final : public StreamingDecompressor {
+ public:
+  ZstdStreamingDecompressor(const ZstdDictionaries* dictionaries,
+                            bool context_takeover)
+      : dctx_(ZSTD_createDCtx()),
+        dictionaries_(dictionaries),
+        context_takeover_(context_takeover) {}
+
+  ~ZstdStreamingDecompressor() override { ZSTD_freeDCtx(dctx_); }
+
+  bool Decompress(const grpc_slice_buffer* input,
+                  grpc_slice_buffer* output) override {
+    if (broken_) return false;
+    // With context takeover the whole call is one frame.
+    if (!context_takeover_ || !started_) {
+      char header[kMaxFrameHeaderSize];
+      const size_t header_length = CopyFrameHeader(input, header);
+      if (!ResetForFrame(dctx_, header, header_length, dictionaries_)) {
+        return Fail("no dictionary");
+      }
+      started_ = true;
+    }
+    ZSTD_inBuffer in = {nullptr, 0, 0};
+    size_t next_slice = 0;
+    // Non-zero until the end of the frame.
+    size_t remaining = 1;
+    bool output_full = false;
+    while (true) {
+      if (in.pos == in.size) {
+        if (next_slice == input->count) break;
+        in = {GRPC_SLICE_START_PTR(input->slices[next_slice]),
+              GRPC_SLICE_LENGTH(input->slices[next_slice]), 0};
+        ++next_slice;
+        continue;
+      }
+      if (remaining == 0 && !context_takeover_) return Fail("trailing data");
+      if (!Step(&in, &remaining, &output_full)) return false;
+    }
+    // zstd may hold output it had no room for.
+    while (output_full) {
+      if (!Step(&in, &remaining, &output_full)) return false;
+    }
+    if (remaining != 0 && !context_takeover_) return Fail("truncated frame");
+    writer_.Finish(output);
+    return true;
+  }
+
+ private:
+  bool Step(ZSTD_inBuffer* in, size_t* remaining, bool* output_full) {
+    ZSTD_outBuffer out = {writer_.data(), writer_.available(), 0};
+    *remaining = ZSTD_decompressStream(dctx_, &out, in);
+    writer_.Commit(out.pos);
+    if (ZSTD_isError(*remaining)) return Fail(ZSTD_getErrorName(*remaining));
+    *output_full = out.pos == out.size;
+    return true;
+  }
+
+  bool Fail(absl::string_view why) {
+    VLOG(2) << "zstd: " << why;
+    writer_.Abandon();
+    broken_ = context_takeover_;
+    return false;
+  }
+
+  ZSTD_DCtx* const dctx_;
+  const ZstdDictionaries* const dictionaries_;
+  const bool context_takeover_;
+  bool started_ = false;
+  bool broken_ = false;
+  PooledSliceWriter writer_;
+};
+
+void RestoreOutput(grpc_slice_buffer* output, size_t count_before,
+                   size_t length_before) {
+  for (size_t i = count_before; i < output->count; i++) {
+    CSliceUnref(output->slices[i]);
+  }
+  output->count = count_before;
+  output->length = length_before;
+}
+
+#endif  // GRPC_HAVE_ZSTD
+
+}  // namespace
+
+//
+// ZstdDictionary
+//
+
+absl::StatusOr<std::unique_ptr<ZstdDictionary>> ZstdDictionary::Create(
+    std::string data) {
+  if (data.size() < 8 ||
+      ReadLittleEndian32(data.data()) != kZstdDictionaryMagic) {
+    return absl::InvalidArgumentError(
+        "not a zstd dictionary (raw content dictionaries are not supported)");
+  }
+  const uint32_t id = ReadLittleEndian32(data.data() + 4);
+  if (id == 0) {
+    return absl::InvalidArgumentError("zstd dictionary has no id");
+  }
+  auto dictionary =
+      std::unique_ptr<ZstdDictionary>(new ZstdDictionary(std::move(data), id));
+#ifdef GRPC_HAVE_ZSTD
+  dictionary->ddict_ =
+      ZSTD_createDDict(dictionary->data_.data(), dictionary->data_.size());
+  if (dictionary->ddict_ == nullptr) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("failed to load zstd dictionary ", id));
+  }
+#endif
+  return dictionary;
+}
+
+ZstdDictionary::ZstdDictionary(std::string data, uint32_t id)
+    : data_(std::move(data)), id_(id) {}
+
+ZstdDictionary::~ZstdDictionary() {
+#ifdef GRPC_HAVE_ZSTD
+  ZSTD_freeDDict(ddict_);
+  for (auto& p : cdicts_) ZSTD_freeCDict(p.second);
+#endif
+}
+
+const ZSTD_CDict_s* ZstdDictionary::CompressionDictionary(int level) const {
+#ifdef GRPC_HAVE_ZSTD
+  MutexLock lock(&mu_);
+  ZSTD_CDict*& cdict = cdicts_[level];
+  if (cdict == nullptr) {
+    cdict = ZSTD_createCDict(data_.data(), data_.size(), level);
+  }
+  return cdict;
+#else
+  (void)level;
+  return nullptr;
+#endif
+}
+
+//
+// ZstdDictionaries
+//
+
+absl::StatusOr<RefCountedPtr<ZstdDictionaries>> ZstdDictionaries::FromConfig(
+    absl::string_view config) {
+  auto dictionaries = MakeRefCounted<ZstdDictionaries>();
+  for (absl::string_view entry : absl::StrSplit(config, ',')) {
+    entry = absl::StripAsciiWhitespace(entry);
+    if (entry.empty()) continue;
+    std::pair<absl::string_view, absl::string_view> prefix_and_file =
+        absl::StrSplit(entry, absl::MaxSplits('=', 1));
+    const bool has_prefix = !prefix_and_file.second.empty();
+    const std::string filename(has_prefix ? prefix_and_file.second
+                                          : prefix_and_file.first);
+    auto contents = LoadFile(filename, /*add_null_terminator=*/false);
+    if (!contents.ok()) return contents.status();
+    std::string data(contents->as_string_view());
+    absl::Status status =
+        has_prefix ? dictionaries->Add(prefix_and_file.first, std::move(data))
+                   : dictionaries->AddForDecompression(std::move(data));
+    if (!status.ok()) {
+      return absl::InvalidArgumentError(
+          absl::StrCat(filename, ": ", status.message()));
+    }
+  }
+  return dictionaries;
+}
+
+absl::StatusOr<const ZstdDictionary*> ZstdDictionaries::Insert(
+    std::string data) {
+  auto dictionary = ZstdDictionary::Create(std::move(data));
+  if (!dictionary.ok()) return dictionary.status();
+  auto it = by_id_.find((*dictionary)->id());
+  if (it != by_id_.end()) {
+    if (it->second->data() != (*dictionary)->data()) {
+      return absl::AlreadyExistsError(absl::StrCat(
+          "another zstd dictionary has id ", (*dictionary)->id()));
+    }
+    return it->second.get();
+  }
+  const ZstdDictionary* result = dictionary->get();
+  by_id_.emplace(result->id(), std::move(*dictionary));
+  return result;
+}
+
+absl::Status ZstdDictionaries::Add(absl::string_view path_prefix,
+                                   std::string data) {
+  for (const auto& p : by_prefix_) {
+    if (p.first == path_prefix) {
+      return absl::AlreadyExistsError(absl::StrCat(
+          "a zstd dictionary is already assigned to \"", path_prefix, "\""));
+    }
+  }
+  auto dictionary = Insert(std::move(data));
+  if (!dictionary.ok()) return dictionary.status();
+  by_prefix_.emplace_back(std::string(path_prefix), *dictionary);
+  std::stable_sort(by_prefix_.begin(), by_prefix_.end(),
+                   [](const auto& a, const auto& b) {
+                     return a.first.size() > b.first.size();
+                   });
+  return absl::OkStatus();
+}
+
+absl::Status ZstdDictionaries::AddForDecompression(std::string data) {
+  return Insert(std::move(data)).status();
+}
+
+const ZstdDictionary* ZstdDictionaries::ForPath(absl::string_view path) const {
+  for (const auto& p : by_prefix_) {
+    if (absl::StartsWith(path, p.first)) return p.second;
+  }
+  return nullptr;
+}
+
+const ZstdDictionary* ZstdDictionaries::ForId(uint32_t id) const {
+  auto it = by_id_.find(id);
+  if (it == by_id_.end()) return nullptr;
+  return it->second.get();
+}
+
+std::string ZstdDictionaries::IdList() const {
+  std::vector<uint32_t> ids;
+  ids.reserve(by_id_.size());
+  for (const auto& p : by_id_) ids.push_back(p.first);
+  std::sort(ids.begin(), ids.end());
+  return absl::StrJoin(ids, ",");
+}
+
+bool ZstdDictionaries::IdListContains(absl::string_view id_list, uint32_t id) {
+  for (absl::string_view entry : absl::StrSplit(id_list, ',')) {
+    uint32_t listed;
+    if (absl::SimpleAtoi(absl::StripAsciiWhitespace(entry), &listed) &&
+        listed == id) {
+      return true;
+    }
+  }
+  return false;
+}
+
+//
+// Compression
+//
+
+bool ZstdCompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                  int level, const ZstdDictionary* dictionary) {
+#ifdef GRPC_HAVE_ZSTD
+  // Anything but a strictly smaller frame is not worth sending, so that is all
+  // the room zstd gets.
+  if (input->length < 2) return false;
+  ZSTD_CCtx* cctx = ThreadCompressionContext();
+  ZSTD_CCtx_reset(cctx, ZSTD_reset_session_and_parameters);
+  const ZSTD_CDict* cdict = dictionary == nullptr
+                                ? nullptr
+                                : dictionary->CompressionDictionary(level);
+  if (cdict != nullptr) {
+    ZSTD_CCtx_refCDict(cctx, cdict);
+  } else {
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, level);
+  }
+  ZSTD_CCtx_setPledgedSrcSize(cctx, input->length);
+  grpc_slice outbuf = grpc_slice_malloc_large(input->length - 1);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf),
+                        0};
+  for (size_t i = 0; i < input->count; i++) {
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    const ZSTD_EndDirective mode =
+        i == input->count - 1 ? ZSTD_e_end : ZSTD_e_continue;
+    bool done;
+    do {
+      const size_t r = ZSTD_compressStream2(cctx, &out, &in, mode);
+      if (ZSTD_isError(r)) {
+        VLOG(2) << "zstd error: " << ZSTD_getErrorName(r);
+        CSliceUnref(outbuf);
+        return false;
+      }
+      done = mode == ZSTD_e_end ? r == 0 : in.pos == in.size;
+      if (!done && out.pos == out.size) {
+        // Too big to be worth it.
+        CSliceUnref(outbuf);
+        return false;
+      }
+    } while (!done);
+  }
+  outbuf.data.refcounted.length = out.pos;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  return true;
+#else
+  (void)input;
+  (void)output;
+  (void)level;
+  (void)dictionary;
+  return false;
+#endif
+}
+
+bool ZstdDecompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                    const ZstdDictionaries* dictionaries) {
+#ifdef GRPC_HAVE_ZSTD
+  char header[kMaxFrameHeaderSize];
+  const size_t header_length = CopyFrameHeader(input, header);
+  ZSTD_DCtx* dctx = ThreadDecompressionContext();
+  if (!ResetForFrame(dctx, header, header_length, dictionaries)) return false;
+  size_t block_size = ZSTD_DStreamOutSize();
+  const unsigned long long content_size =
+      ZSTD_getFrameContentSize(header, header_length);
+  if (content_size != ZSTD_CONTENTSIZE_UNKNOWN &&
+      content_size != ZSTD_CONTENTSIZE_ERROR) {
+    block_size = static_cast<size_t>(
+        std::clamp<unsigned long long>(content_size, kMinOutputBlockSize,
+                                       kMaxInitialOutputBlockSize));
+  }
+  const size_t count_before = output->count;
+  const size_t length_before = output->length;
+  grpc_slice outbuf = grpc_slice_malloc_large(block_size);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf),
+                        0};
+  auto next_block = [&]() {
+    grpc_slice_buffer_add_indexed(output, outbuf);
+    outbuf = grpc_slice_malloc_large(ZSTD_DStreamOutSize());
+    out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf), 0};
+  };
+  auto fail = [&](absl::string_view why) {
+    VLOG(2) << "zstd: " << why;
+    CSliceUnref(outbuf);
+    RestoreOutput(output, count_before, length_before);
+    return false;
+  };
+  ZSTD_inBuffer in = {nullptr, 0, 0};
+  size_t next_slice = 0;
+  // Non-zero until the end of the frame.
+  size_t remaining = 1;
+  while (true) {
+    if (in.pos == in.size) {
+      if (next_slice == input->count) break;
+      in = {GRPC_SLICE_START_PTR(input->slices[next_slice]),
+            GRPC_SLICE_LENGTH(input->slices[next_slice]), 0};
+      ++next_slice;
+      continue;
+    }
+    if (remaining == 0) return fail("trailing data");
+    if (out.pos == out.size) next_block();
+    remaining = ZSTD_decompressStream(dctx, &out, &in);
+    if (ZSTD_isError(remaining)) return fail(ZSTD_getErrorName(remaining));
+  }
+  // All input is consumed; zstd may still hold output it had no room for.
+  while (remaining != 0) {
+    if (out.pos < out.size) return fail("truncated frame");
+    next_block();
+    remaining = ZSTD_decompressStream(dctx, &out, &in);
+    if (ZSTD_isError(remaining)) return fail(ZSTD_getErrorName(remaining));
+  }
+  if (out.pos == 0) {
+    CSliceUnref(outbuf);
+  } else {
+    outbuf.data.refcounted.length = out.pos;
+    grpc_slice_buffer_add_indexed(output, outbuf);
+  }
+  return true;
+#else
+  (void)input;
+  (void)output;
+  (void)dictionaries;
+  return false;
+#endif
+}
+
+std::unique_ptr<StreamingCompressor> MakeZstdStreamingCompressor(
+    int level, const ZstdDictionary* dictionary, bool context_takeover) {
+#ifdef GRPC_HAVE_ZSTD
+  return std::make_unique<ZstdStreamingCompressor>(level, dictionary,
+                                                   context_takeover);
+#else
+  (void)level;
+  (void)dictionary;
+  (void)context_takeover;
+  return nullptr;
+#endif
+}
+
+std::unique_ptr<StreamingDecompressor> MakeZstdStreamingDecompressor(
+    const ZstdDictionaries* dictionaries, bool context_takeover) {
+#ifdef GRPC_HAVE_ZSTD
+  return std::make_unique<ZstdStreamingDecompressor>(dictionaries,
+                                                     context_takeover);
+#else
+  (void)dictionaries;
+  (void)context_takeover;
+  return nullptr;
+#endif
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,156 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_COMPRESSION_ZSTD_COMPRESSION_H
+#define GRPC_SRC_CORE_LIB_COMPRESSION_ZSTD_COMPRESSION_H
+
+#include <grpc/slice_buffer.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/compression/streaming_compression.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/useful.h"
+
+// zstd is an optional dependency: builds that link libzstd
+// (gRPC_ZSTD_PROVIDER=package with CMake, --config=zstd with Bazel) define
+// GRPC_HAVE_ZSTD. Without it zstd is never advertised in
+// grpc-accept-encoding, compressing with it falls back to sending the message
+// uncompressed, and decompressing fails.
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace grpc_core {
+
+#ifdef GRPC_HAVE_ZSTD
+inline constexpr bool kZstdSupported = true;
+#else
+inline constexpr bool kZstdSupported = false;
+#endif
+
+// zstd's own default level.
+inline constexpr int kDefaultZstdCompressionLevel = 3;
+
+// A pre-trained dictionary, as produced by `zstd --train`.
+class ZstdDictionary {
+ public:
+  // Fails on raw-content dictionaries: the receiver finds the dictionary by
+  // the id recorded in each frame, and those have no id.
+  static absl::StatusOr<std::unique_ptr<ZstdDictionary>> Create(
+      std::string data);
+
+  ~ZstdDictionary();
+
+  ZstdDictionary(const ZstdDictionary&) = delete;
+  ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+
+  uint32_t id() const { return id_; }
+  absl::string_view data() const { return data_; }
+
+  // The dictionary digested for compressing at the given level, built on
+  // first use. Null without GRPC_HAVE_ZSTD.
+  const ZSTD_CDict_s* CompressionDictionary(int level) const;
+  // Null without GRPC_HAVE_ZSTD.
+  const ZSTD_DDict_s* DecompressionDictionary() const { return ddict_; }
+
+ private:
+  ZstdDictionary(std::string data, uint32_t id);
+
+  const std::string data_;
+  const uint32_t id_;
+  ZSTD_DDict_s* ddict_ = nullptr;
+  mutable Mutex mu_;
+  mutable absl::flat_hash_map<int, ZSTD_CDict_s*> cdicts_ ABSL_GUARDED_BY(mu_);
+};
+
+// The dictionaries a channel uses. Each is assigned to the methods whose path
+// starts with a prefix, normally "/package.Service/", and the longest matching
+// prefix wins. Incoming messages can use any of them, whatever the prefix.
+// Populate before sharing: Add() is not thread safe.
+class ZstdDictionaries : public RefCounted<ZstdDictionaries> {
+ public:
+  // Parses the value of GRPC_ARG_ZSTD_DICTIONARIES: a comma separated list of
+  // path_prefix=filename pairs.
+  static absl::StatusOr<RefCountedPtr<ZstdDictionaries>> FromConfig(
+      absl::string_view config);
+
+  // Adds a dictionary for methods under path_prefix. An empty prefix matches
+  // every method; a dictionary with no prefix at all can be added with
+  // AddForDecompression().
+  absl::Status Add(absl::string_view path_prefix, std::string data);
+  absl::Status AddForDecompression(std::string data);
+
+  // The dictionary to compress messages of the method at path with, or null.
+  const ZstdDictionary* ForPath(absl::string_view path) const;
+  // The dictionary a frame refers to, or null.
+  const ZstdDictionary* ForId(uint32_t id) const;
+
+  // Peers only compress with dictionaries the receiver advertised, in a comma
+  // separated list of decimal ids. IdList() lists the ids of all of these.
+  std::string IdList() const;
+  static bool IdListContains(absl::string_view id_list, uint32_t id);
+
+  bool empty() const { return by_id_.empty(); }
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.zstd_dictionaries";
+  }
+  static int ChannelArgsCompare(const ZstdDictionaries* a,
+                                const ZstdDictionaries* b) {
+    return QsortCompare(a, b);
+  }
+
+ private:
+  absl::StatusOr<const ZstdDictionary*> Insert(std::string data);
+
+  absl::flat_hash_map<uint32_t, std::unique_ptr<ZstdDictionary>> by_id_;
+  // Sorted by descending prefix length.
+  std::vector<std::pair<std::string, const ZstdDictionary*>> by_prefix_;
+};
+
+// Compresses input into output as a single zstd frame. Returns false, leaving
+// output untouched, if zstd is unavailable or the frame would not be smaller
+// than the input.
+bool ZstdCompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                  int level, const ZstdDictionary* dictionary);
+
+// Decompresses the zstd frame in input into output. Frames compressed with a
+// dictionary need it in dictionaries. Returns false, leaving output untouched,
+// on failure.
+bool ZstdDecompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                    const ZstdDictionaries* dictionaries);
+
+// Streaming counterparts of the above, or null without GRPC_HAVE_ZSTD. With
+// context takeover a call's messages form a single frame.
+std::unique_ptr<StreamingCompressor> MakeZstdStreamingCompressor(
+    int level, const ZstdDictionary* dictionary, bool context_takeover);
+std::unique_ptr<StreamingDecompressor> MakeZstdStreamingDecompressor(
+    const ZstdDictionaries* dictionaries, bool context_takeover);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_COMPRESSION_ZSTD_COMPRESSION_H
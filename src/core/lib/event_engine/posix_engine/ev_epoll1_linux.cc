@@ -19,7 +19,9 @@
 #include <grpc/support/sync.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "absl/log/check.h"
@@ -30,6 +32,7 @@
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/time_util.h"
 #include "src/core/lib/iomgr/port.h"
+#include "src/core/telemetry/stats.h"
 #include "src/core/util/crash.h"
 
 // This polling engine is only relevant on linux kernels supporting epoll
@@ -437,6 +440,26 @@ int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
   return r;
 }
 
+int Epoll1Poller::BusyPollEpoll(EventEngine::Duration spin_budget,
+                                EventEngine::Duration& spent) {
+  const auto start = std::chrono::steady_clock::now();
+  int r;
+  do {
+    r = DoEpollWait(EventEngine::Duration::zero());
+    spent = std::chrono::steady_clock::now() - start;
+  } while (r == 0 && spent < spin_budget);
+  // Export the CPU time burnt spinning so that operators can weigh it against
+  // the wakeups it saved.
+  grpc_core::global_stats().IncrementPollerBusyPollSpinTime(
+      std::chrono::duration_cast<std::chrono::microseconds>(spent).count());
+  if (r > 0) {
+    grpc_core::global_stats().IncrementPollerBusyPollHits();
+  } else {
+    grpc_core::global_stats().IncrementPollerBusyPollParks();
+  }
+  return r;
+}
+
 // Might be called multiple times
 void Epoll1EventHandle::ShutdownHandle(absl::Status why) {
   // A mutex is required here because, the SetShutdown method of the
@@ -481,8 +504,17 @@ Poller::WorkResult Epoll1Poller::Work(
   Events pending_events;
   bool was_kicked_ext = false;
   if (g_epoll_set_.cursor == g_epoll_set_.num_events) {
-    if (DoEpollWait(timeout) == 0) {
-      return Poller::WorkResult::kDeadlineExceeded;
+    const EventEngine::Duration spin_budget =
+        std::min(timeout, EventEngine::Duration(busy_poll_budget_ns_.load(
+                              std::memory_order_relaxed)));
+    EventEngine::Duration spent = EventEngine::Duration::zero();
+    // Spin first if busy polling is enabled, then park for the rest of the
+    // timeout.
+    if (spin_budget <= EventEngine::Duration::zero() ||
+        BusyPollEpoll(spin_budget, spent) == 0) {
+      if (spent >= timeout || DoEpollWait(timeout - spent) == 0) {
+        return Poller::WorkResult::kDeadlineExceeded;
+      }
     }
   }
   {
@@ -507,6 +539,24 @@ Poller::WorkResult Epoll1Poller::Work(
   return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
 }
 
+void Epoll1Poller::RequestBusyPolling(EventEngine::Duration spin_budget) {
+  grpc_core::MutexLock lock(&busy_poll_mu_);
+  busy_poll_budgets_ns_.insert(spin_budget.count());
+  busy_poll_budget_ns_.store(*busy_poll_budgets_ns_.rbegin(),
+                             std::memory_order_relaxed);
+}
+
+void Epoll1Poller::ReleaseBusyPolling(EventEngine::Duration spin_budget) {
+  grpc_core::MutexLock lock(&busy_poll_mu_);
+  auto it = busy_poll_budgets_ns_.find(spin_budget.count());
+  CHECK(it != busy_poll_budgets_ns_.end());
+  busy_poll_budgets_ns_.erase(it);
+  busy_poll_budget_ns_.store(busy_poll_budgets_ns_.empty()
+                                 ? 0
+                                 : *busy_poll_budgets_ns_.rbegin(),
+                             std::memory_order_relaxed);
+}
+
 void Epoll1Poller::Kick() {
   grpc_core::MutexLock lock(&mu_);
   if (was_kicked_ || closed_) {
@@ -564,12 +614,25 @@ int Epoll1Poller::DoEpollWait(EventEngine::Duration /*timeout*/) {
   grpc_core::Crash("unimplemented");
 }
 
+int Epoll1Poller::BusyPollEpoll(EventEngine::Duration /*spin_budget*/,
+                                EventEngine::Duration& /*spent*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 Poller::WorkResult Epoll1Poller::Work(
     EventEngine::Duration /*timeout*/,
     absl::FunctionRef<void()> /*schedule_poll_again*/) {
   grpc_core::Crash("unimplemented");
 }
 
+void Epoll1Poller::RequestBusyPolling(EventEngine::Duration /*spin_budget*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void Epoll1Poller::ReleaseBusyPolling(EventEngine::Duration /*spin_budget*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 void Epoll1Poller::Kick() { grpc_core::Crash("unimplemented"); }
 
 // If GRPC_LINUX_EPOLL is not defined, it means epoll is not available. Return
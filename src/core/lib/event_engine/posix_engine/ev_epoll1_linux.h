@@ -17,8 +17,10 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <list>
 #include <memory>
+#include <set>
 #include <string>
 
 #include "absl/base/thread_annotations.h"
@@ -53,6 +55,12 @@ class Epoll1Poller : public PosixEventPoller {
       absl::FunctionRef<void()> schedule_poll_again) override;
   std::string Name() override { return "epoll1"; }
   void Kick() override;
+  void RequestBusyPolling(
+      grpc_event_engine::experimental::EventEngine::Duration spin_budget)
+      override;
+  void ReleaseBusyPolling(
+      grpc_event_engine::experimental::EventEngine::Duration spin_budget)
+      override;
   Scheduler* GetScheduler() { return scheduler_; }
   void Shutdown() override;
   bool CanTrackErrors() const override {
@@ -90,6 +98,12 @@ class Epoll1Poller : public PosixEventPoller {
   // of events generated by epoll_wait.
   int DoEpollWait(
       grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Repeats DoEpollWait() with a zero timeout until it finds events or
+  // spin_budget elapses. Returns the number of events found and sets spent to
+  // the time spent spinning.
+  int BusyPollEpoll(
+      grpc_event_engine::experimental::EventEngine::Duration spin_budget,
+      grpc_event_engine::experimental::EventEngine::Duration& spent);
   class HandlesList {
    public:
     explicit HandlesList(Epoll1EventHandle* handle) : handle(handle) {}
@@ -123,6 +137,11 @@ class Epoll1Poller : public PosixEventPoller {
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<WakeupFd> wakeup_fd_;
   bool closed_;
+  // Spin budgets of the outstanding busy polling requests, in nanoseconds.
+  grpc_core::Mutex busy_poll_mu_;
+  std::multiset<int64_t> busy_poll_budgets_ns_ ABSL_GUARDED_BY(busy_poll_mu_);
+  // The largest of busy_poll_budgets_ns_, zero if there are none.
+  std::atomic<int64_t> busy_poll_budget_ns_{0};
 };
 
 // Return an instance of a epoll1 based poller tied to the specified event
@@ -0,0 +1,901 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/sync.h>
+#include <grpc/support/time.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_format.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+// Multishot poll and IORING_ENTER_EXT_ARG (both required by this poller) were
+// added after the initial io_uring release. Only build the poller against
+// kernel headers that know about them.
+#if defined(IORING_POLL_ADD_MULTI) && defined(IORING_ENTER_EXT_ARG) && \
+    defined(IORING_FEAT_RSRC_TAGS) && defined(__NR_io_uring_setup)
+#define GRPC_IO_URING_POLLER 1
+#endif
+#endif  // GRPC_LINUX_IO_URING
+
+#ifdef GRPC_IO_URING_POLLER
+#include <endian.h>
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/util/fork.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+#define MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION 1
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+// Size of the submission ring. Submissions are only needed to add, re-arm or
+// remove a poll request, so this does not need to scale with the number of
+// registered fds.
+constexpr uint32_t kSubmissionQueueEntries = 256;
+// Size of the completion ring. Every readiness notification of every fd is
+// posted here, so it is sized like a generous epoll_wait() batch. Completions
+// which do not fit are buffered by the kernel (IORING_FEAT_NODROP) and the
+// affected multishot polls are terminated and then re-armed by the poller.
+constexpr uint32_t kCompletionQueueEntries = 4096;
+// user_data of requests whose completion carries no information, e.g. poll
+// removals.
+constexpr uint64_t kIgnoredUserData = 0;
+// Poll events of handle fds, like EPOLLIN | EPOLLOUT | EPOLLPRI in epoll1. The
+// wakeup fd is only polled for POLLIN: an eventfd is always writable, so
+// polling it for POLLOUT would complete on every wait.
+constexpr uint32_t kHandlePollEvents = POLLIN | POLLOUT | POLLPRI;
+}  // namespace
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(int fd, IoUringPoller* poller)
+      : fd_(fd),
+        poller_(poller),
+        read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        write_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        error_closure_(
+            std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  void ReInit(int fd) {
+    fd_ = fd;
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions for why these need to be
+    // atomics.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  int WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  inline void ExecutePendingActions() {
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_->SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_->SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_->SetReady();
+    }
+  }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  friend class IoUringPoller;
+  void HandleShutdownInternal(absl::Status why);
+  // Use the least significant bit of the user_data to store track_err. We
+  // expect the addresses to be word aligned.
+  uint64_t UserData() const {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(this)) |
+           (track_err_ ? 1 : 0);
+  }
+  // See Epoll1Poller::ShutdownHandle for explanation on why a mutex is
+  // required.
+  grpc_core::Mutex mu_;
+  int fd_;
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  IoUringPoller* poller_;
+  std::unique_ptr<LockfreeEvent> read_closure_;
+  std::unique_ptr<LockfreeEvent> write_closure_;
+  std::unique_ptr<LockfreeEvent> error_closure_;
+  // The following fields are guarded by poller_->sq_mu_.
+  // The kernel may still post completions for this handle's poll request.
+  // A handle is only returned to the free list once the final completion of
+  // its poll request has been reaped, so that stale completions are never
+  // attributed to a recycled handle.
+  bool armed_ = false;
+  // OrphanHandle has started: terminated polls must not be re-armed.
+  bool orphaned_ = false;
+  // OrphanHandle has finished using the handle.
+  bool orphan_done_ = false;
+  bool track_err_ = false;
+};
+
+namespace {
+
+int IoUringSetup(uint32_t entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, uint32_t to_submit, uint32_t min_complete,
+                 uint32_t flags, const void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+// Fills sqe with a multishot poll request for the given poll events on fd. The
+// completions it generates carry user_data.
+void PrepPollAdd(void* entry, int fd, uint64_t user_data, uint32_t events) {
+  struct io_uring_sqe* sqe = static_cast<struct io_uring_sqe*>(entry);
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  // Multishot: post a completion every time the fd becomes ready, until the
+  // request is removed. This gives the same edge triggered semantics as
+  // EPOLLET.
+  sqe->len = IORING_POLL_ADD_MULTI;
+#if __BYTE_ORDER == __BIG_ENDIAN
+  // The kernel reads poll32_events as two swapped 16 bit halves on big endian
+  // machines.
+  events = (events << 16) | (events >> 16);
+#endif
+  sqe->poll32_events = events;
+  sqe->user_data = user_data;
+}
+
+// Returns true if the io_uring instance described by params supports all the
+// features this poller relies on.
+bool HasRequiredFeatures(const struct io_uring_params& params) {
+  // IORING_FEAT_RSRC_TAGS was added in the same release (5.13) as multishot
+  // poll, which cannot be probed for directly.
+  constexpr uint32_t kRequiredFeatures =
+      IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG |
+      IORING_FEAT_RSRC_TAGS;
+  return (params.features & kRequiredFeatures) == kRequiredFeatures;
+}
+
+// Only used when GRPC_ENABLE_FORK_SUPPORT=1
+std::list<IoUringPoller*> fork_poller_list;
+
+gpr_mu fork_fd_list_mu;
+
+void ForkPollerListAddPoller(IoUringPoller* poller) {
+  if (grpc_core::Fork::Enabled()) {
+    gpr_mu_lock(&fork_fd_list_mu);
+    fork_poller_list.push_back(poller);
+    gpr_mu_unlock(&fork_fd_list_mu);
+  }
+}
+
+void ForkPollerListRemovePoller(IoUringPoller* poller) {
+  if (grpc_core::Fork::Enabled()) {
+    gpr_mu_lock(&fork_fd_list_mu);
+    fork_poller_list.remove(poller);
+    gpr_mu_unlock(&fork_fd_list_mu);
+  }
+}
+
+bool InitIoUringPollerLinux();
+
+// Called by the child process's post-fork handler to close the rings of all
+// pollers. The rings are shared with the parent process, so they must not be
+// used by the child.
+void ResetEventManagerOnFork() {
+  gpr_mu_lock(&fork_fd_list_mu);
+  while (!fork_poller_list.empty()) {
+    IoUringPoller* poller = fork_poller_list.front();
+    fork_poller_list.pop_front();
+    poller->CloseInChild();
+  }
+  gpr_mu_unlock(&fork_fd_list_mu);
+  InitIoUringPollerLinux();
+}
+
+// io_uring may be compiled into the kernel but disabled at runtime (e.g. by
+// the kernel.io_uring_disabled sysctl or a seccomp profile), or it may be too
+// old to support multishot poll. Create a small ring to check.
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::experimental::SupportsWakeupFd()) {
+    return false;
+  }
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int fd = IoUringSetup(1, &params);
+  if (fd < 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring unavailable: " << grpc_core::StrError(errno);
+    return false;
+  }
+  close(fd);
+  if (!HasRequiredFeatures(params)) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring lacks required features: 0x" << std::hex
+        << params.features;
+    return false;
+  }
+  if (grpc_core::Fork::Enabled()) {
+    if (grpc_core::Fork::RegisterResetChildPollingEngineFunc(
+            ResetEventManagerOnFork)) {
+      gpr_mu_init(&fork_fd_list_mu);
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      int* release_fd,
+                                      absl::string_view reason) {
+  bool is_release_fd = (release_fd != nullptr);
+  if (!read_closure_->IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+  {
+    // The poll request holds a reference to the underlying file, so it has to
+    // be removed explicitly both when the fd is released and when it is
+    // closed.
+    grpc_core::MutexLock lock(&poller_->sq_mu_);
+    orphaned_ = true;
+    // Once the rings are closed, e.g. in a forked child, the kernel posts
+    // nothing more for the handle.
+    if (poller_->ring_.fd < 0) armed_ = false;
+    if (armed_) {
+      poller_->QueuePollRemove(UserData());
+      poller_->SubmitLocked();
+    }
+  }
+
+  // If release_fd is not NULL, we should be relinquishing control of the file
+  // descriptor fd->fd (but we still own the grpc_fd structure).
+  if (is_release_fd) {
+    *release_fd = fd_;
+  } else {
+    shutdown(fd_, SHUT_RDWR);
+    close(fd_);
+  }
+
+  {
+    // See Epoll1Poller::ShutdownHandle for explanation on why a mutex is
+    // required here.
+    grpc_core::MutexLock lock(&mu_);
+    read_closure_->DestroyEvent();
+    write_closure_->DestroyEvent();
+    error_closure_->DestroyEvent();
+  }
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  bool recycle;
+  {
+    grpc_core::MutexLock lock(&poller_->sq_mu_);
+    orphan_done_ = true;
+    // Otherwise the handle is recycled when the final completion of its poll
+    // request is reaped.
+    recycle = !armed_;
+  }
+  if (recycle) {
+    grpc_core::MutexLock lock(&poller_->mu_);
+    poller_->free_io_uring_handles_list_.push_back(this);
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
+                          GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_->SetShutdown(why)) {
+    write_closure_->SetShutdown(why);
+    error_closure_->SetShutdown(why);
+  }
+}
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : IoUringPoller(scheduler, kSubmissionQueueEntries,
+                    kCompletionQueueEntries) {}
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler,
+                             uint32_t submission_queue_entries,
+                             uint32_t completion_queue_entries)
+    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+  params.cq_entries = completion_queue_entries;
+  ring_.fd = IoUringSetup(submission_queue_entries, &params);
+  CHECK_GE(ring_.fd, 0) << "io_uring_setup failed: "
+                        << grpc_core::StrError(errno);
+  CHECK(HasRequiredFeatures(params));
+  // With IORING_FEAT_SINGLE_MMAP the submission and completion rings share a
+  // single mapping.
+  ring_.ring_size =
+      std::max(params.sq_off.array + params.sq_entries * sizeof(uint32_t),
+               params.cq_off.cqes +
+                   params.cq_entries * sizeof(struct io_uring_cqe));
+  ring_.ring_ptr =
+      mmap(nullptr, ring_.ring_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, ring_.fd, IORING_OFF_SQ_RING);
+  CHECK(ring_.ring_ptr != MAP_FAILED)
+      << "mmap of io_uring rings failed: " << grpc_core::StrError(errno);
+  ring_.sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  ring_.sqes_ptr = mmap(nullptr, ring_.sqes_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ring_.fd, IORING_OFF_SQES);
+  CHECK(ring_.sqes_ptr != MAP_FAILED)
+      << "mmap of io_uring sqes failed: " << grpc_core::StrError(errno);
+  char* ring = static_cast<char*>(ring_.ring_ptr);
+  ring_.sq_head = reinterpret_cast<uint32_t*>(ring + params.sq_off.head);
+  ring_.sq_tail = reinterpret_cast<uint32_t*>(ring + params.sq_off.tail);
+  ring_.sq_mask = *reinterpret_cast<uint32_t*>(ring + params.sq_off.ring_mask);
+  ring_.sq_entries = params.sq_entries;
+  // Submission queue entries are always used in order, so the indirection
+  // array is set up once as an identity mapping.
+  uint32_t* sq_array = reinterpret_cast<uint32_t*>(ring + params.sq_off.array);
+  for (uint32_t i = 0; i < params.sq_entries; ++i) {
+    sq_array[i] = i;
+  }
+  ring_.cq_head = reinterpret_cast<uint32_t*>(ring + params.cq_off.head);
+  ring_.cq_tail = reinterpret_cast<uint32_t*>(ring + params.cq_off.tail);
+  ring_.cq_mask = *reinterpret_cast<uint32_t*>(ring + params.cq_off.ring_mask);
+  ring_.cqes = ring + params.cq_off.cqes;
+
+  wakeup_fd_ = *CreateWakeupFd();
+  CHECK(wakeup_fd_ != nullptr);
+  GRPC_TRACE_LOG(event_engine_poller, INFO)
+      << "grpc io_uring fd: " << ring_.fd << " sq_entries: "
+      << params.sq_entries << " cq_entries: " << params.cq_entries;
+  {
+    grpc_core::MutexLock lock(&sq_mu_);
+    QueuePollAdd(wakeup_fd_->ReadFd(),
+                 reinterpret_cast<uintptr_t>(wakeup_fd_.get()), POLLIN);
+    SubmitLocked();
+  }
+  ForkPollerListAddPoller(this);
+}
+
+void IoUringPoller::Shutdown() { ForkPollerListRemovePoller(this); }
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&sq_mu_);
+  if (ring_.fd < 0) return;
+  // Reap the final completions of the handles orphaned since the last call
+  // to Work() so that they end up in the free list.
+  Events ignored;
+  Terminated terminated;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    ProcessCompletions(INT_MAX, ignored, terminated);
+  }
+  for (IoUringEventHandle* handle : terminated) {
+    if (handle != nullptr) {
+      handle->orphaned_ = true;
+      OnPollTerminated(handle);
+    }
+  }
+  CloseRingLocked();
+}
+
+void IoUringPoller::CloseInChild() {
+  grpc_core::MutexLock lock(&sq_mu_);
+  CloseRingLocked();
+}
+
+void IoUringPoller::CloseRingLocked() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+
+  if (ring_.sqes_ptr != nullptr) {
+    munmap(ring_.sqes_ptr, ring_.sqes_size);
+    ring_.sqes_ptr = nullptr;
+  }
+  if (ring_.ring_ptr != nullptr) {
+    munmap(ring_.ring_ptr, ring_.ring_size);
+    ring_.ring_ptr = nullptr;
+  }
+  if (ring_.fd >= 0) {
+    close(ring_.fd);
+    ring_.fd = -1;
+  }
+  // Kick() does nothing once closed_ is set.
+  wakeup_fd_.reset();
+  rearms_.clear();
+
+  while (!free_io_uring_handles_list_.empty()) {
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        free_io_uring_handles_list_.front());
+    free_io_uring_handles_list_.pop_front();
+    delete handle;
+  }
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+EventHandle* IoUringPoller::CreateHandle(int fd, absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_io_uring_handles_list_.empty()) {
+      new_handle = new IoUringEventHandle(fd, this);
+    } else {
+      new_handle = reinterpret_cast<IoUringEventHandle*>(
+          free_io_uring_handles_list_.front());
+      free_io_uring_handles_list_.pop_front();
+      new_handle->ReInit(fd);
+    }
+  }
+  grpc_core::MutexLock lock(&sq_mu_);
+  new_handle->orphaned_ = false;
+  new_handle->orphan_done_ = false;
+  new_handle->track_err_ = track_err;
+  new_handle->armed_ = true;
+  QueuePollAdd(fd, new_handle->UserData(), kHandlePollEvents);
+  SubmitLocked();
+  return new_handle;
+}
+
+bool IoUringPoller::SubmissionQueueFullLocked() {
+  return *ring_.sq_tail - __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE) ==
+         ring_.sq_entries;
+}
+
+void IoUringPoller::MakeRoomLocked() {
+  while (SubmissionQueueFullLocked()) {
+    SubmitLocked();
+    if (!SubmissionQueueFullLocked()) return;
+    // Submissions are flushed eagerly, so the ring is only full while the
+    // kernel refuses new requests: it returns EBUSY until the completions it
+    // could not post fit in the completion ring. Work() cannot drain that
+    // while sq_mu_ is held, so drain it here.
+    ReapCompletionsLocked();
+    SubmitLocked();
+    if (SubmissionQueueFullLocked()) std::this_thread::yield();
+  }
+}
+
+void IoUringPoller::ReapCompletionsLocked() {
+  Events pending_events;
+  Terminated terminated;
+  bool was_kicked;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    was_kicked = ProcessCompletions(INT_MAX, pending_events, terminated);
+  }
+  // Kicks are for Work() to report: signal the wakeup fd again.
+  if (was_kicked) CHECK(wakeup_fd_->Wakeup().ok());
+  // This only schedules the closures waiting for the events.
+  for (IoUringEventHandle* handle : pending_events) {
+    handle->ExecutePendingActions();
+  }
+  for (IoUringEventHandle* handle : terminated) {
+    OnPollTerminated(handle);
+  }
+}
+
+void IoUringPoller::QueueRearmsLocked() {
+  while (!rearms_.empty()) {
+    // Making room may reap more terminated polls.
+    MakeRoomLocked();
+    IoUringEventHandle* handle = rearms_.back();
+    rearms_.pop_back();
+    if (handle == nullptr) {
+      PrepPollAdd(NextSqeLocked(), wakeup_fd_->ReadFd(),
+                  reinterpret_cast<uintptr_t>(wakeup_fd_.get()), POLLIN);
+    } else {
+      PrepPollAdd(NextSqeLocked(), handle->fd_, handle->UserData(),
+                  kHandlePollEvents);
+    }
+    __atomic_store_n(ring_.sq_tail, *ring_.sq_tail + 1, __ATOMIC_RELEASE);
+  }
+}
+
+void* IoUringPoller::GetSqeLocked() {
+  // Re-arms come first: they include the wakeup fd, without which Kick()
+  // cannot wake up Work().
+  do {
+    QueueRearmsLocked();
+    MakeRoomLocked();
+  } while (!rearms_.empty());
+  return NextSqeLocked();
+}
+
+void* IoUringPoller::NextSqeLocked() {
+  struct io_uring_sqe* sqe =
+      static_cast<struct io_uring_sqe*>(ring_.sqes_ptr) +
+      (*ring_.sq_tail & ring_.sq_mask);
+  memset(sqe, 0, sizeof(*sqe));
+  return sqe;
+}
+
+void IoUringPoller::QueuePollAdd(int fd, uint64_t user_data,
+                                 uint32_t events) {
+  PrepPollAdd(GetSqeLocked(), fd, user_data, events);
+  __atomic_store_n(ring_.sq_tail, *ring_.sq_tail + 1, __ATOMIC_RELEASE);
+}
+
+void IoUringPoller::QueuePollRemove(uint64_t user_data) {
+  struct io_uring_sqe* sqe = static_cast<struct io_uring_sqe*>(GetSqeLocked());
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = user_data;
+  sqe->user_data = kIgnoredUserData;
+  __atomic_store_n(ring_.sq_tail, *ring_.sq_tail + 1, __ATOMIC_RELEASE);
+}
+
+void IoUringPoller::SubmitLocked() {
+  uint32_t to_submit =
+      *ring_.sq_tail - __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+  while (to_submit > 0) {
+    int r = IoUringEnter(ring_.fd, to_submit, 0, 0, nullptr, 0);
+    if (r < 0) {
+      if (errno == EINTR) continue;
+      if (errno == EAGAIN || errno == EBUSY) {
+        // The kernel is short on memory or the completion ring is overflowing;
+        // the remaining requests are submitted along with the next wait.
+        break;
+      }
+      grpc_core::Crash(absl::StrFormat(
+          "(event_engine) IoUringPoller:%p encountered io_uring_enter "
+          "error: %s",
+          this, grpc_core::StrError(errno).c_str()));
+    }
+    to_submit -= std::min<uint32_t>(to_submit, r);
+    if (r == 0) break;
+  }
+}
+
+// Process the completions posted by the kernel.
+// - cq_head points to the first completion to be processed.
+// - This function then processes up-to max_events_to_handle completions and
+//   advances cq_head.
+// It returns true, it there was a Kick that forced invocation of this
+// function. It also returns the list of handles that became
+// readable/writable, and the list of handles whose multishot poll request
+// terminated.
+bool IoUringPoller::ProcessCompletions(
+    int max_events_to_handle, Events& pending_events,
+    Terminated& terminated) {
+  uint32_t head = *ring_.cq_head;
+  uint32_t tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  const struct io_uring_cqe* cqes =
+      static_cast<const struct io_uring_cqe*>(ring_.cqes);
+  bool was_kicked = false;
+  for (int idx = 0; (idx < max_events_to_handle) && head != tail; idx++) {
+    const struct io_uring_cqe* cqe = &cqes[head & ring_.cq_mask];
+    ++head;
+    uint64_t user_data = cqe->user_data;
+    int32_t res = cqe->res;
+    bool more = (cqe->flags & IORING_CQE_F_MORE) != 0;
+    if (user_data == kIgnoredUserData) {
+      continue;
+    }
+    if (user_data == reinterpret_cast<uintptr_t>(wakeup_fd_.get())) {
+      if (res > 0) {
+        CHECK(wakeup_fd_->ConsumeWakeup().ok());
+        was_kicked = true;
+      }
+      if (!more) {
+        terminated.push_back(nullptr);
+      }
+      continue;
+    }
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        static_cast<uintptr_t>(user_data) & ~uintptr_t{1});
+    if (res > 0) {
+      bool track_err = (user_data & uint64_t{1}) != 0;
+      uint32_t events = static_cast<uint32_t>(res);
+      bool cancel = (events & POLLHUP) != 0;
+      bool error = (events & POLLERR) != 0;
+      bool read_ev = (events & (POLLIN | POLLPRI)) != 0;
+      bool write_ev = (events & POLLOUT) != 0;
+      bool err_fallback = error && !track_err;
+      if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                    write_ev || cancel || err_fallback,
+                                    error && !err_fallback)) {
+        pending_events.push_back(handle);
+      }
+    }
+    if (!more) {
+      terminated.push_back(handle);
+    }
+  }
+  __atomic_store_n(ring_.cq_head, head, __ATOMIC_RELEASE);
+  return was_kicked;
+}
+
+void IoUringPoller::OnPollTerminated(IoUringEventHandle* handle) {
+  if (handle == nullptr) {
+    // The wakeup fd is never removed, so always re-arm it.
+    rearms_.push_back(nullptr);
+    return;
+  }
+  handle->armed_ = false;
+  if (handle->orphan_done_) {
+    grpc_core::MutexLock lock(&mu_);
+    free_io_uring_handles_list_.push_back(handle);
+  } else if (!handle->orphaned_) {
+    // The kernel terminated the poll request, e.g. because the completion
+    // ring overflowed. Re-arm it.
+    handle->armed_ = true;
+    rearms_.push_back(handle);
+  }
+}
+
+//  Submit the queued requests and wait for completions. This does not
+//  "process" any of the completions yet; that is done in
+//  ProcessCompletions(). It returns the number of completions available.
+int IoUringPoller::DoIoUringWait(EventEngine::Duration timeout) {
+  struct __kernel_timespec ts;
+  auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout);
+  if (ns.count() < 0) ns = std::chrono::nanoseconds(0);
+  ts.tv_sec = ns.count() / GPR_NS_PER_SEC;
+  ts.tv_nsec = ns.count() % GPR_NS_PER_SEC;
+  struct io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  arg.sigmask_sz = _NSIG / 8;
+  arg.ts = reinterpret_cast<uintptr_t>(&ts);
+  uint32_t to_submit;
+  {
+    grpc_core::MutexLock lock(&sq_mu_);
+    to_submit =
+        *ring_.sq_tail - __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+  }
+  // Submitting and waiting happen in a single syscall. Requests queued by other
+  // threads concurrently are either picked up here or by their own
+  // SubmitLocked() call; the kernel never submits more than what was queued.
+  int r;
+  do {
+    r = IoUringEnter(ring_.fd, to_submit, 1,
+                     IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                     sizeof(arg));
+  } while (r < 0 && errno == EINTR);
+  if (r < 0 && errno != ETIME && errno != EAGAIN && errno != EBUSY) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(errno).c_str()));
+  }
+  return static_cast<int>(__atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE) -
+                          *ring_.cq_head);
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  // See Epoll1EventHandle::ShutdownHandle for why a mutex is required here.
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_->IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_->NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_->NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_->NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_->SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_->SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_->SetReady(); }
+
+// Polls the registered Fds for events until timeout is reached or there is a
+// Kick(). If there is a Kick(), it collects and processes any previously
+// un-processed events. If there are no un-processed events, it returns
+// Poller::WorkResult::Kicked{}
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  bool was_kicked_ext = false;
+  const auto start = std::chrono::steady_clock::now();
+  while (true) {
+    if (__atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE) == *ring_.cq_head) {
+      // Only wait for what is left of the timeout after completions that
+      // carried no readiness.
+      if (DoIoUringWait(timeout -
+                        (std::chrono::steady_clock::now() - start)) == 0) {
+        return Poller::WorkResult::kDeadlineExceeded;
+      }
+    }
+    Terminated terminated;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      // If was_kicked_ is true, collect all pending events in this iteration.
+      if (ProcessCompletions(was_kicked_
+                                 ? INT_MAX
+                                 : MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION,
+                             pending_events, terminated)) {
+        was_kicked_ = false;
+        was_kicked_ext = true;
+      }
+    }
+    if (!terminated.empty()) {
+      grpc_core::MutexLock lock(&sq_mu_);
+      for (IoUringEventHandle* handle : terminated) {
+        OnPollTerminated(handle);
+      }
+      QueueRearmsLocked();
+    }
+    // Completions of removed or terminated poll requests carry no readiness;
+    // unlike epoll1 they must not be mistaken for a Kick.
+    if (was_kicked_ext || !pending_events.empty()) break;
+  }
+  if (pending_events.empty()) {
+    return Poller::WorkResult::kKicked;
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  CHECK(wakeup_fd_->Wakeup().ok());
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler) {
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (kIoUringPollerSupported) {
+    return std::make_shared<IoUringPoller>(scheduler);
+  }
+  return nullptr;
+}
+
+void IoUringPoller::PrepareFork() { Kick(); }
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace grpc_event_engine::experimental
+
+#else  // defined(GRPC_IO_URING_POLLER)
+
+namespace grpc_event_engine::experimental {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+
+IoUringPoller::IoUringPoller(Scheduler* /* engine */) {
+  grpc_core::Crash("unimplemented");
+}
+
+IoUringPoller::IoUringPoller(Scheduler* /* engine */,
+                             uint32_t /* submission_queue_entries */,
+                             uint32_t /* completion_queue_entries */) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Shutdown() { grpc_core::Crash("unimplemented"); }
+
+void IoUringPoller::Close() { grpc_core::Crash("unimplemented"); }
+
+void IoUringPoller::CloseInChild() { grpc_core::Crash("unimplemented"); }
+
+IoUringPoller::~IoUringPoller() { grpc_core::Crash("unimplemented"); }
+
+EventHandle* IoUringPoller::CreateHandle(int /*fd*/,
+                                         absl::string_view /*name*/,
+                                         bool /*track_err*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Kick() { grpc_core::Crash("unimplemented"); }
+
+// If io_uring is not available at compile time, return nullptr.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* /*scheduler*/) {
+  return nullptr;
+}
+
+void IoUringPoller::PrepareFork() {}
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // !defined(GRPC_IO_URING_POLLER)
@@ -0,0 +1,174 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <list>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+class IoUringEventHandle;
+
+// Definition of an io_uring based poller.
+//
+// Every registered fd gets a single multishot IORING_OP_POLL_ADD request, so
+// readiness notifications are delivered as completion queue entries, and
+// waiting for them and submitting queued requests (re-arms of terminated
+// multishot polls) happen in the same io_uring_enter() call. This is a
+// readiness poller like epoll1: endpoints still read and write with their own
+// recvmsg()/sendmsg() calls, so it does not save syscalls on the data path.
+// The poller requires multishot poll and IORING_ENTER_EXT_ARG support (Linux
+// 5.13+); MakeIoUringPoller() returns nullptr when they are unavailable so
+// that callers can fall back to epoll1.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  explicit IoUringPoller(Scheduler* scheduler);
+  // Uses rings of the given sizes instead of the default ones. For tests.
+  IoUringPoller(Scheduler* scheduler, uint32_t submission_queue_entries,
+                uint32_t completion_queue_entries);
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  void Shutdown() override;
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  ~IoUringPoller() override;
+
+  // Forkable
+  void PrepareFork() override;
+  void PostforkParent() override;
+  void PostforkChild() override;
+
+  void Close();
+  // Closes the rings in a forked child. They are shared with the parent
+  // process, so unlike Close() this does not reap their completions.
+  void CloseInChild();
+
+ private:
+  // This initial vector size may need to be tuned
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+  // Handles whose multishot poll request has terminated. nullptr stands for
+  // the wakeup fd.
+  using Terminated = absl::InlinedVector<IoUringEventHandle*, 1>;
+  friend class IoUringEventHandle;
+
+  // Memory mapped submission and completion rings shared with the kernel.
+  struct Ring {
+    int fd = -1;
+    void* ring_ptr = nullptr;
+    size_t ring_size = 0;
+    void* sqes_ptr = nullptr;
+    size_t sqes_size = 0;
+    // Submission queue.
+    uint32_t* sq_head = nullptr;
+    uint32_t* sq_tail = nullptr;
+    uint32_t sq_mask = 0;
+    uint32_t sq_entries = 0;
+    // Completion queue.
+    uint32_t* cq_head = nullptr;
+    uint32_t* cq_tail = nullptr;
+    uint32_t cq_mask = 0;
+    void* cqes = nullptr;
+  };
+
+  // Queues a multishot poll request for the given poll events on fd. The
+  // completions it generates carry user_data.
+  void QueuePollAdd(int fd, uint64_t user_data, uint32_t events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Queues the cancellation of the poll request identified by user_data.
+  void QueuePollRemove(uint64_t user_data)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Hands all queued requests to the kernel without waiting.
+  void SubmitLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Returns true if no more requests can be queued.
+  bool SubmissionQueueFullLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Submits queued requests until there is room for one more.
+  void MakeRoomLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Drains the completion ring on behalf of Work(), so that the kernel takes
+  // new requests again.
+  void ReapCompletionsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Queues the re-arms of the poll requests in rearms_.
+  void QueueRearmsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Unmaps and closes the rings.
+  void CloseRingLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Submits queued requests and blocks until at least one completion is
+  // available or the timeout expires. Returns the number of completions
+  // available in the completion ring.
+  int DoIoUringWait(
+      grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Processes up-to max_events_to_handle completions from the completion
+  // ring. Returns true if there was a Kick that forced invocation of this
+  // function. It also returns the list of handles which have pending actions
+  // and the list of handles whose poll request terminated.
+  bool ProcessCompletions(int max_events_to_handle, Events& pending_events,
+                          Terminated& terminated)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Recycles a handle whose multishot poll request has terminated, or adds it
+  // to rearms_.
+  void OnPollTerminated(IoUringEventHandle* handle)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Returns a free submission queue entry, flushing the ring if it is full.
+  void* GetSqeLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Returns the submission queue entry at the tail. There must be room.
+  void* NextSqeLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+
+  grpc_core::Mutex mu_;
+  // Serializes producers of the submission ring and the armed/orphaned state
+  // of the handles.
+  grpc_core::Mutex sq_mu_;
+  Scheduler* scheduler_;
+  // Closed with both mutexes held.
+  Ring ring_;
+  // Poll requests to re-arm. nullptr stands for the wakeup fd.
+  Terminated rearms_ ABSL_GUARDED_BY(sq_mu_);
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  std::list<EventHandle*> free_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  std::unique_ptr<WakeupFd> wakeup_fd_;
+  bool closed_;
+};
+
+// Return an instance of an io_uring based poller tied to the specified event
+// engine, or nullptr if io_uring is not supported by the running kernel.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
@@ -92,6 +92,14 @@ class PosixEventPoller : public grpc_event_engine::experimental::Poller,
                                     bool track_err) = 0;
   virtual bool CanTrackErrors() const = 0;
   virtual std::string Name() = 0;
+  // While any busy polling request is outstanding, Work() spins on the poller
+  // with a zero timeout for up to the largest requested spin_budget before
+  // blocking, trading CPU for wakeup latency. Every RequestBusyPolling() must
+  // be matched by a ReleaseBusyPolling() with the same budget once the caller,
+  // e.g. a busy polling endpoint, goes away. Pollers that do not support busy
+  // polling ignore both.
+  virtual void RequestBusyPolling(EventEngine::Duration /*spin_budget*/) {}
+  virtual void ReleaseBusyPolling(EventEngine::Duration /*spin_budget*/) {}
   // Shuts down and deletes the poller. It is legal to call this function
   // only when no other poller method is in progress. For instance, it is
   // not safe to call this method, while a thread is blocked on Work(...).
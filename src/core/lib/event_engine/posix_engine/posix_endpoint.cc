@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
@@ -65,6 +66,10 @@
 #include <sys/resource.h>      // IWYU pragma: keep
 #endif
 #include <netinet/in.h>  // IWYU pragma: keep
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+#include <sys/mman.h>  // IWYU pragma: keep
+#include <unistd.h>    // IWYU pragma: keep
+#endif
 
 #ifndef SOL_TCP
 #define SOL_TCP IPPROTO_TCP
@@ -75,6 +80,10 @@
 #define TCP_CM_INQ TCP_INQ
 #endif
 
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+
 #ifdef GRPC_HAVE_MSG_NOSIGNAL
 #define SENDMSG_FLAGS MSG_NOSIGNAL
 #else
@@ -92,6 +101,12 @@
 
 #define MAX_READ_IOVEC 64
 
+// Set in ee_code of a zerocopy completion when the kernel copied the data
+// instead, e.g. because the device does not support scatter-gather.
+#ifndef SO_EE_CODE_ZEROCOPY_COPIED
+#define SO_EE_CODE_ZEROCOPY_COPIED 1
+#endif
+
 namespace grpc_event_engine::experimental {
 
 namespace {
@@ -109,6 +124,14 @@ ssize_t TcpSend(int fd, const struct msghdr* msg, int* saved_errno,
   return sent_length;
 }
 
+// Monotonic clock reading used to time the cost of sends and zerocopy
+// completions.
+int64_t MonotonicNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
 #ifdef GRPC_LINUX_ERRQUEUE
 
 #define CAP_IS_SUPPORTED(cap) (prctl(PR_CAPBSET_READ, (cap), 0) > 0)
@@ -216,6 +239,49 @@ absl::Status PosixOSError(int error_no, absl::string_view call_name) {
       call_name, ": ", grpc_core::StrError(error_no), " (", error_no, ")"));
 }
 
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+// The leading fields of struct tcp_zerocopy_receive, which are understood by
+// every kernel supporting TCP_ZEROCOPY_RECEIVE. Later kernels extended the
+// struct and accept this shorter version.
+struct TcpZerocopyReceiveArgs {
+  uint64_t address;         // in: address of the mapping
+  uint32_t length;          // in/out: number of bytes to map/mapped
+  uint32_t recv_skip_hint;  // out: bytes that must be read with recvmsg
+};
+
+// Upper bound on the size of a single TCP_ZEROCOPY_RECEIVE mapping.
+constexpr size_t kMaxZerocopyReceiveLength = 16 * 1024 * 1024;
+// Number of consecutive attempts that mapped nothing after which an endpoint
+// stops trying. Payload only lands in whole pages if the NIC splits headers
+// (or the MTU is page sized), so some connections, e.g. over loopback, never
+// benefit.
+constexpr int kMaxZerocopyReceiveMisses = 16;
+
+class RxZerocopySliceRefCount : public grpc_slice_refcount {
+ public:
+  RxZerocopySliceRefCount(
+      grpc_core::RefCountedPtr<RxZerocopyRegions> regions, void* region,
+      size_t length, grpc_core::MemoryAllocator::Reservation reservation)
+      : grpc_slice_refcount(Destroy),
+        regions_(std::move(regions)),
+        region_(region),
+        length_(length),
+        reservation_(std::move(reservation)) {}
+
+ private:
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* rc = static_cast<RxZerocopySliceRefCount*>(p);
+    rc->regions_->Return(rc->region_, rc->length_);
+    delete rc;
+  }
+
+  grpc_core::RefCountedPtr<RxZerocopyRegions> regions_;
+  void* const region_;
+  const size_t length_;
+  grpc_core::MemoryAllocator::Reservation reservation_;
+};
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+
 }  // namespace
 
 #if defined(IOV_MAX) && IOV_MAX < 260
@@ -261,6 +327,149 @@ void TcpZerocopySendRecord::UpdateOffsetForBytesSent(size_t sending_length,
   }
 }
 
+bool TcpZerocopySendCtx::ShouldZerocopy(size_t bytes) {
+  const bool above_threshold = ThresholdBytes() < bytes;
+  if (!adaptive_ || bytes < kMinCostSampleBytes) return above_threshold;
+  grpc_core::MutexLock lock(&mu_);
+  if (++probe_counter_ % kProbeInterval == 0) return !above_threshold;
+  return above_threshold;
+}
+
+void TcpZerocopySendCtx::NoteCopySendCost(size_t bytes, int64_t nanos) {
+  if (!adaptive_ || bytes < kMinCostSampleBytes) return;
+  grpc_core::MutexLock lock(&mu_);
+  copy_ns_per_byte_.Update(static_cast<double>(nanos) / bytes);
+  UpdateThresholdLocked();
+}
+
+void TcpZerocopySendCtx::NoteZerocopySendCost(size_t bytes, int64_t nanos) {
+  if (!adaptive_ || bytes < kMinCostSampleBytes) return;
+  grpc_core::MutexLock lock(&mu_);
+  zerocopy_ns_per_byte_.Update(static_cast<double>(nanos) / bytes);
+  UpdateThresholdLocked();
+}
+
+size_t RxZerocopyMapLength(size_t expected_bytes, size_t threshold,
+                           size_t page_size, size_t max_bytes) {
+  size_t length = std::min(expected_bytes, max_bytes);
+  length -= length % page_size;
+  if (length == 0 || length < threshold) return 0;
+  return length;
+}
+
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+RxZerocopyRegions::~RxZerocopyRegions() {
+  grpc_core::MutexLock lock(&mu_);
+  for (void* region : free_regions_) munmap(region, region_size_);
+}
+
+void* RxZerocopyRegions::Take(int fd) {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (!free_regions_.empty()) {
+      void* region = free_regions_.back();
+      free_regions_.pop_back();
+      return region;
+    }
+  }
+  void* region = mmap(nullptr, region_size_, PROT_READ, MAP_SHARED, fd, 0);
+  return region == MAP_FAILED ? nullptr : region;
+}
+
+void RxZerocopyRegions::Return(void* region, size_t used_bytes) {
+  if (used_bytes > 0) {
+    // The next TCP_ZEROCOPY_RECEIVE into the region would replace these
+    // pages too, but until then they would hold on to received memory that
+    // is no longer accounted for.
+    madvise(region, used_bytes, MADV_DONTNEED);
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_regions_.size() < kMaxCachedRegions) {
+      free_regions_.push_back(region);
+      return;
+    }
+  }
+  munmap(region, region_size_);
+}
+
+Slice MakeRxZerocopySlice(
+    grpc_core::RefCountedPtr<RxZerocopyRegions> regions, void* region,
+    size_t length, grpc_core::MemoryAllocator::Reservation reservation) {
+  grpc_slice slice;
+  slice.refcount = new RxZerocopySliceRefCount(
+      std::move(regions), region, length, std::move(reservation));
+  slice.data.refcounted.bytes = static_cast<uint8_t*>(region);
+  slice.data.refcounted.length = length;
+  return Slice(slice);
+}
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+
+void TcpZerocopySendCtx::NoteCompletionCost(uint32_t completions, bool copied,
+                                            int64_t nanos) {
+  if (!adaptive_ || completions == 0) return;
+  grpc_core::MutexLock lock(&mu_);
+  completion_ns_.Update(static_cast<double>(nanos) / completions);
+  // Completions show that optmem is being released again; grow the number of
+  // in-flight writes additively, unless the kernel had to copy the data, in
+  // which case keeping more of it pinned buys nothing.
+  if (!copied) SetMaxInflightSendsLocked(max_inflight_sends_ + 1);
+  UpdateThresholdLocked();
+}
+
+void TcpZerocopySendCtx::OnOptMemExhaustedLocked() {
+  grpc_core::global_stats().IncrementTcpZerocopySendEnobufs();
+  SetMaxInflightSendsLocked(max_inflight_sends_ / 2);
+  SetThresholdLocked(ThresholdBytes() * 2);
+}
+
+void TcpZerocopySendCtx::UpdateThresholdLocked() {
+  if (!copy_ns_per_byte_.Valid() || !zerocopy_ns_per_byte_.Valid() ||
+      !completion_ns_.Valid()) {
+    return;
+  }
+  // A zerocopy write of n bytes costs roughly
+  //   n * zerocopy_ns_per_byte + completion_ns
+  // against n * copy_ns_per_byte for a copying one, so it pays off for writes
+  // larger than completion_ns / (copy_ns_per_byte - zerocopy_ns_per_byte).
+  // When the kernel ends up copying anyway the per-byte costs converge, and
+  // the threshold moves to its upper bound.
+  const double saved_ns_per_byte =
+      copy_ns_per_byte_.value - zerocopy_ns_per_byte_.value;
+  const double limit = kMaxAdaptiveSendBytesThreshold;
+  double threshold = limit;
+  if (saved_ns_per_byte > 0) {
+    threshold = std::min(limit, completion_ns_.value / saved_ns_per_byte);
+  }
+  SetThresholdLocked(static_cast<size_t>(threshold));
+}
+
+void TcpZerocopySendCtx::SetThresholdLocked(size_t threshold) {
+  threshold = std::clamp(threshold, kMinAdaptiveSendBytesThreshold,
+                         kMaxAdaptiveSendBytesThreshold);
+  // Ignore changes below 1/8th of the current value, other than reaching one
+  // of the bounds, to avoid flapping on noisy samples.
+  const size_t current = ThresholdBytes();
+  if (threshold == current) return;
+  const size_t delta =
+      threshold > current ? threshold - current : current - threshold;
+  if (delta <= current / 8 && threshold != kMinAdaptiveSendBytesThreshold &&
+      threshold != kMaxAdaptiveSendBytesThreshold) {
+    return;
+  }
+  threshold_bytes_.store(threshold, std::memory_order_relaxed);
+  grpc_core::global_stats().IncrementTcpZerocopySendThreshold(threshold);
+}
+
+void TcpZerocopySendCtx::SetMaxInflightSendsLocked(int max_inflight_sends) {
+  if (max_sends_ == 0) return;
+  max_inflight_sends = std::clamp(max_inflight_sends, 1, max_sends_);
+  if (max_inflight_sends == max_inflight_sends_) return;
+  max_inflight_sends_ = max_inflight_sends;
+  grpc_core::global_stats().IncrementTcpZerocopyMaxInflightSends(
+      max_inflight_sends);
+}
+
 void PosixEndpointImpl::AddToEstimate(size_t bytes) {
   bytes_read_this_round_ += static_cast<double>(bytes);
 }
@@ -282,10 +491,104 @@ absl::Status PosixEndpointImpl::TcpAnnotateError(absl::Status src_error) const {
   return src_error;
 }
 
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+size_t PosixEndpointImpl::TcpZerocopyReceive(SliceBuffer& dst) {
+  static const size_t kPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  // Map as much as this read is expected to return. The kernel only maps
+  // whole pages of payload; anything else is left for recvmsg.
+  const size_t length = RxZerocopyMapLength(
+      std::max<size_t>(static_cast<size_t>(min_progress_size_),
+                       static_cast<size_t>(target_length_)),
+      rx_zerocopy_threshold_, kPageSize, kMaxZerocopyReceiveLength);
+  if (length == 0 || !memory_owner_.is_valid()) return 0;
+  if (rx_zerocopy_regions_ == nullptr) {
+    rx_zerocopy_regions_ =
+        grpc_core::MakeRefCounted<RxZerocopyRegions>(kMaxZerocopyReceiveLength);
+  }
+  void* addr = rx_zerocopy_regions_->Take(fd_);
+  if (addr == nullptr) {
+    LOG(ERROR) << "Rx zero-copy will not be used by gRPC since mmap on the "
+               << "socket failed: " << grpc_core::StrError(errno);
+    rx_zerocopy_enabled_ = false;
+    return 0;
+  }
+  TcpZerocopyReceiveArgs zc;
+  memset(&zc, 0, sizeof(zc));
+  zc.address = reinterpret_cast<uintptr_t>(addr);
+  zc.length = static_cast<uint32_t>(length);
+  socklen_t zc_len = sizeof(zc);
+  int ret;
+  do {
+    grpc_core::global_stats().IncrementSyscallRead();
+    ret = getsockopt(fd_, IPPROTO_TCP, TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (ret < 0 && errno == EINTR);
+  if (ret < 0) {
+    if (errno != EAGAIN) {
+      VLOG(2) << "Rx zero-copy disabled for fd=" << fd_
+              << ": TCP_ZEROCOPY_RECEIVE failed: " << grpc_core::StrError(errno);
+      rx_zerocopy_enabled_ = false;
+    }
+    rx_zerocopy_regions_->Return(addr, 0);
+    return 0;
+  }
+  const size_t mapped = std::min<size_t>(zc.length, length);
+  if (mapped == 0) {
+    rx_zerocopy_regions_->Return(addr, 0);
+    if (++rx_zerocopy_misses_ == kMaxZerocopyReceiveMisses) {
+      VLOG(2) << "Rx zero-copy disabled for fd=" << fd_
+              << ": received payload is not page aligned";
+      rx_zerocopy_enabled_ = false;
+    }
+    return 0;
+  }
+  rx_zerocopy_misses_ = 0;
+  // The pages stay mapped until the last reference to the slice is dropped,
+  // and are charged to the quota until then like the buffers of a copying
+  // read.
+  dst.Append(MakeRxZerocopySlice(rx_zerocopy_regions_, addr, mapped,
+                                 memory_owner_.MakeReservation(mapped)));
+  grpc_core::global_stats().IncrementTcpReadSize(mapped);
+  grpc_core::global_stats().IncrementTcpRxZerocopyReadSize(mapped);
+  AddToEstimate(mapped);
+  return mapped;
+}
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+
 // Returns true if data available to read or error other than EAGAIN.
 bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   GRPC_LATENT_SEE_INNER_SCOPE("TcpDoRead");
 
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+  if (rx_zerocopy_enabled_) {
+    SliceBuffer mapped;
+    if (TcpZerocopyReceive(mapped) > 0) {
+      // There may be more to read: whatever did not fill a whole page, and
+      // anything beyond the mapped length.
+      inq_ = 1;
+      if (!grpc_core::IsTcpFrameSizeTuningEnabled()) {
+        // Deliver the mapped pages on their own and keep the pre-allocated
+        // slices around for the next read.
+        incoming_buffer_->MoveFirstNBytesIntoSliceBuffer(
+            incoming_buffer_->Length(), last_read_buffer_);
+        incoming_buffer_->Swap(mapped);
+        status = absl::OkStatus();
+        return true;
+      }
+      // Stage the mapped pages in front of whatever is copied next.
+      min_progress_size_ -= mapped.Length();
+      while (mapped.Count() > 0) {
+        last_read_buffer_.Append(mapped.TakeFirst());
+      }
+      if (min_progress_size_ <= 0) {
+        min_progress_size_ = 1;
+        incoming_buffer_->Swap(last_read_buffer_);
+        status = absl::OkStatus();
+        return true;
+      }
+    }
+  }
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+
   struct msghdr msg;
   struct iovec iov[MAX_READ_IOVEC];
   ssize_t read_bytes;
@@ -662,7 +965,7 @@ TcpZerocopySendRecord* PosixEndpointImpl::TcpGetSendZerocopyRecord(
   TcpZerocopySendRecord* zerocopy_send_record = nullptr;
   const bool use_zerocopy =
       tcp_zerocopy_send_ctx_->Enabled() &&
-      tcp_zerocopy_send_ctx_->ThresholdBytes() < buf.Length();
+      tcp_zerocopy_send_ctx_->ShouldZerocopy(buf.Length());
   if (use_zerocopy) {
     zerocopy_send_record = tcp_zerocopy_send_ctx_->GetSendRecord();
     if (zerocopy_send_record == nullptr) {
@@ -706,8 +1009,10 @@ bool PosixEndpointImpl::ProcessErrors() {
   } aligned_buf;
   msg.msg_control = aligned_buf.rbuf;
   int r, saved_errno;
+  const bool adaptive = tcp_zerocopy_send_ctx_->Adaptive();
   while (true) {
     msg.msg_controllen = sizeof(aligned_buf.rbuf);
+    const int64_t start_nanos = adaptive ? MonotonicNanos() : 0;
     do {
       r = recvmsg(fd_, &msg, MSG_ERRQUEUE);
       saved_errno = errno;
@@ -730,7 +1035,7 @@ bool PosixEndpointImpl::ProcessErrors() {
     for (auto cmsg = CMSG_FIRSTHDR(&msg); cmsg && cmsg->cmsg_len;
          cmsg = CMSG_NXTHDR(&msg, cmsg)) {
       if (CmsgIsZeroCopy(*cmsg)) {
-        ProcessZerocopy(cmsg);
+        ProcessZerocopy(cmsg, start_nanos);
         seen = true;
         processed_err = true;
       } else if (cmsg->cmsg_level == SOL_SOCKET &&
@@ -757,8 +1062,11 @@ void PosixEndpointImpl::ZerocopyDisableAndWaitForRemaining() {
   }
 }
 
-// Reads \a cmsg to process zerocopy control messages.
-void PosixEndpointImpl::ProcessZerocopy(struct cmsghdr* cmsg) {
+// Reads \a cmsg to process zerocopy control messages. \a start_nanos is the
+// time at which reading the error queue message started, if the zerocopy
+// send context is adaptive.
+void PosixEndpointImpl::ProcessZerocopy(struct cmsghdr* cmsg,
+                                        int64_t start_nanos) {
   DCHECK(cmsg);
   auto serr = reinterpret_cast<struct sock_extended_err*>(CMSG_DATA(cmsg));
   DCHECK_EQ(serr->ee_errno, 0u);
@@ -775,6 +1083,11 @@ void PosixEndpointImpl::ProcessZerocopy(struct cmsghdr* cmsg) {
     DCHECK(record);
     UnrefMaybePutZerocopySendRecord(record);
   }
+  if (tcp_zerocopy_send_ctx_->Adaptive()) {
+    tcp_zerocopy_send_ctx_->NoteCompletionCost(
+        hi - lo + 1, (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0,
+        MonotonicNanos() - start_nanos);
+  }
   if (tcp_zerocopy_send_ctx_->UpdateZeroCopyOptMemStateAfterFree()) {
     handle_->SetWritable();
   }
@@ -930,6 +1243,7 @@ bool PosixEndpointImpl::DoFlushZerocopy(TcpZerocopySendRecord* record,
   int saved_errno;
   msghdr msg;
   bool constrained;
+  const bool adaptive = tcp_zerocopy_send_ctx_->Adaptive();
   status = absl::OkStatus();
   // iov consumes a large space. Keep it as the last item on the stack to
   // improve locality. After all, we expect only the first elements of it
@@ -950,6 +1264,7 @@ bool PosixEndpointImpl::DoFlushZerocopy(TcpZerocopySendRecord* record,
     // take a single ref on the zerocopy send record.
     tcp_zerocopy_send_ctx_->NoteSend(record);
     saved_errno = 0;
+    const int64_t start_nanos = adaptive ? MonotonicNanos() : 0;
     if (outgoing_buffer_arg_ != nullptr) {
       if (!ts_capable_ ||
           !WriteWithTimestamps(&msg, sending_length, &sent_length, &saved_errno,
@@ -969,6 +1284,10 @@ bool PosixEndpointImpl::DoFlushZerocopy(TcpZerocopySendRecord* record,
       grpc_core::global_stats().IncrementTcpWriteIovSize(iov_size);
       sent_length = TcpSend(fd_, &msg, &saved_errno, MSG_ZEROCOPY);
     }
+    if (adaptive && sent_length > 0) {
+      tcp_zerocopy_send_ctx_->NoteZerocopySendCost(
+          sent_length, MonotonicNanos() - start_nanos);
+    }
     if (tcp_zerocopy_send_ctx_->UpdateZeroCopyOptMemStateAfterSend(
             saved_errno == ENOBUFS, constrained) ||
         constrained) {
@@ -1039,6 +1358,7 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
   size_t unwind_slice_idx;
   size_t unwind_byte_idx;
   int saved_errno;
+  const bool adaptive = tcp_zerocopy_send_ctx_->Adaptive();
   status = absl::OkStatus();
 
   // We always start at zero, because we eagerly unref and trim the slice
@@ -1070,6 +1390,7 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
     msg.msg_flags = 0;
     bool tried_sending_message = false;
     saved_errno = 0;
+    const int64_t start_nanos = adaptive ? MonotonicNanos() : 0;
     if (outgoing_buffer_arg_ != nullptr) {
       if (!ts_capable_ || !WriteWithTimestamps(&msg, sending_length,
                                                &sent_length, &saved_errno, 0)) {
@@ -1088,6 +1409,10 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
       grpc_core::global_stats().IncrementTcpWriteIovSize(iov_size);
       sent_length = TcpSend(fd_, &msg, &saved_errno);
     }
+    if (adaptive && sent_length > 0) {
+      tcp_zerocopy_send_ctx_->NoteCopySendCost(sent_length,
+                                               MonotonicNanos() - start_nanos);
+    }
 
     if (sent_length < 0) {
       if (saved_errno == EAGAIN || saved_errno == ENOBUFS) {
@@ -1240,6 +1565,9 @@ void PosixEndpointImpl::MaybeShutdown(
   grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
                           GRPC_STATUS_UNAVAILABLE);
   handle_->ShutdownHandle(why);
+  if (busy_poll_budget_ > EventEngine::Duration::zero()) {
+    poller_->ReleaseBusyPolling(busy_poll_budget_);
+  }
   read_mu_.Lock();
   memory_owner_.Reset();
   read_mu_.Unlock();
@@ -1321,7 +1649,8 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
 #endif  // GRPC_LINUX_ERRQUEUE
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
-      options.tcp_tx_zerocopy_send_bytes_threshold);
+      options.tcp_tx_zerocopy_send_bytes_threshold,
+      options.tcp_tx_zerocopy_adaptive);
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
   if (setsockopt(fd_, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
@@ -1333,6 +1662,23 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
 #else
   inq_capable_ = false;
 #endif  // GRPC_HAVE_TCP_INQ
+  if (options.tcp_busy_poll_us > 0) {
+    // Raising SO_BUSY_POLL above net.core.busy_read needs CAP_NET_ADMIN. The
+    // poller still spins without it.
+    absl::Status busy_poll = sock.SetSocketBusyPoll(options.tcp_busy_poll_us);
+    if (!busy_poll.ok()) {
+      VLOG(2) << "cannot set busy poll fd=" << fd_ << ": " << busy_poll;
+    }
+    // Spin while this endpoint is open: other endpoints on the same poller
+    // do not pay for it once it is gone.
+    busy_poll_budget_ = std::chrono::microseconds(options.tcp_busy_poll_us);
+    poller_->RequestBusyPolling(busy_poll_budget_);
+  }
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+  rx_zerocopy_enabled_ = options.tcp_rx_zero_copy_enabled;
+  rx_zerocopy_threshold_ =
+      static_cast<size_t>(std::max(options.tcp_rx_zerocopy_threshold, 0));
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
 
   on_read_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { HandleRead(std::move(status)); });
@@ -21,15 +21,18 @@
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/slice.h>
 #include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/alloc.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <memory>
 #include <new>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
@@ -49,6 +52,7 @@
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
@@ -168,17 +172,31 @@ class TcpZerocopySendCtx {
  public:
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;  // 16KB
-
+  // Bounds for the threshold and the number of in-flight zerocopy writes when
+  // they are tuned adaptively.
+  static constexpr size_t kMinAdaptiveSendBytesThreshold = 4 * 1024;  // 4KB
+  static constexpr size_t kMaxAdaptiveSendBytesThreshold =
+      4 * 1024 * 1024;  // 4MB
+  static constexpr int kMaxAdaptiveSends = 16;
+
+  // If adaptive is true, send_bytes_threshold and max_sends are only the
+  // starting points: both are then tuned online from the costs observed on
+  // this endpoint (see ShouldZerocopy()).
   explicit TcpZerocopySendCtx(
       bool zerocopy_enabled, int max_sends = kDefaultMaxSends,
-      size_t send_bytes_threshold = kDefaultSendBytesThreshold)
-      : max_sends_(max_sends),
-        free_send_records_size_(max_sends),
+      size_t send_bytes_threshold = kDefaultSendBytesThreshold,
+      bool adaptive = false)
+      : max_sends_(adaptive && max_sends > 0
+                       ? std::max(max_sends, kMaxAdaptiveSends)
+                       : max_sends),
+        max_inflight_sends_(max_sends),
+        free_send_records_size_(max_sends_),
+        adaptive_(adaptive),
         threshold_bytes_(send_bytes_threshold) {
     send_records_ = static_cast<TcpZerocopySendRecord*>(
-        gpr_malloc(max_sends * sizeof(*send_records_)));
+        gpr_malloc(max_sends_ * sizeof(*send_records_)));
     free_send_records_ = static_cast<TcpZerocopySendRecord**>(
-        gpr_malloc(max_sends * sizeof(*free_send_records_)));
+        gpr_malloc(max_sends_ * sizeof(*free_send_records_)));
     if (send_records_ == nullptr || free_send_records_ == nullptr) {
       gpr_free(send_records_);
       gpr_free(free_send_records_);
@@ -294,7 +312,27 @@ class TcpZerocopySendCtx {
   // Only use zerocopy if we are sending at least this many bytes. The
   // additional overhead of reading the error queue for notifications means that
   // zerocopy is not useful for small transfers.
-  size_t ThresholdBytes() const { return threshold_bytes_; }
+  size_t ThresholdBytes() const {
+    return threshold_bytes_.load(std::memory_order_relaxed);
+  }
+
+  bool Adaptive() const { return adaptive_ && enabled_; }
+
+  // Returns true if a write of the given size should use zerocopy. Without
+  // adaptive tuning this is a plain comparison against ThresholdBytes(). With
+  // it, a small fraction of the writes is deliberately sent the other way, so
+  // that the cost estimates for both paths stay fresh as the workload changes.
+  bool ShouldZerocopy(size_t bytes);
+
+  // Cost samples which drive the adaptive tuning. The first two report the
+  // time spent in a copying or zerocopy sendmsg() that wrote the given number
+  // of bytes. The last one reports the time spent releasing the send records
+  // of a batch of error queue completions, and whether the kernel reported
+  // that it had to copy the data anyway (e.g. over loopback). All of them are
+  // no-ops unless Adaptive() is true.
+  void NoteCopySendCost(size_t bytes, int64_t nanos);
+  void NoteZerocopySendCost(size_t bytes, int64_t nanos);
+  void NoteCompletionCost(uint32_t completions, bool copied, int64_t nanos);
 
   // Expected to be called by handler reading messages from the err queue.
   // It is used to indicate that some optmem memory is now available. It returns
@@ -370,6 +408,7 @@ class TcpZerocopySendCtx {
     is_in_write_ = false;
     constrained = false;
     if (seen_enobuf) {
+      if (adaptive_) OnOptMemExhaustedLocked();
       if (ctx_lookup_.size() == 1) {
         // There is no un-acked z-copy record. Set constrained to true to
         // indicate that we are re-source constrained because we're seeing
@@ -433,7 +472,8 @@ class TcpZerocopySendCtx {
     if (shutdown_.load(std::memory_order_acquire)) {
       return nullptr;
     }
-    if (free_send_records_size_ == 0) {
+    if (free_send_records_size_ == 0 ||
+        max_sends_ - free_send_records_size_ >= max_inflight_sends_) {
       return nullptr;
     }
     free_send_records_size_--;
@@ -447,15 +487,54 @@ class TcpZerocopySendCtx {
     free_send_records_size_++;
   }
 
+  // Halves the number of zerocopy writes allowed in flight and doubles the
+  // threshold after sendmsg() ran out of optmem.
+  void OnOptMemExhaustedLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Recomputes the threshold from the current cost estimates.
+  void UpdateThresholdLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void SetThresholdLocked(size_t threshold) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void SetMaxInflightSendsLocked(int max_inflight_sends)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Exponentially weighted moving average of a cost sample.
+  struct CostEstimate {
+    double value = 0;
+    int samples = 0;
+    void Update(double sample) {
+      value = samples == 0 ? sample : value + (sample - value) / 8;
+      if (samples < kMinCostSamples) ++samples;
+    }
+    bool Valid() const { return samples >= kMinCostSamples; }
+  };
+  // Number of samples each estimate needs before the threshold is adapted.
+  static constexpr int kMinCostSamples = 4;
+  // Sends smaller than this are dominated by the fixed syscall overhead, so
+  // their per-byte cost is not representative and they are not sampled.
+  static constexpr size_t kMinCostSampleBytes = 4 * 1024;
+  // One in this many writes above kMinCostSampleBytes is sent against the
+  // current decision to refresh the cost estimate of the path not taken.
+  static constexpr uint32_t kProbeInterval = 32;
+
   TcpZerocopySendRecord* send_records_ ABSL_GUARDED_BY(mu_);
   TcpZerocopySendRecord** free_send_records_ ABSL_GUARDED_BY(mu_);
+  // Number of allocated send records.
   int max_sends_;
+  // Maximum number of send records handed out at once. Equal to max_sends_
+  // unless adaptive tuning lowered it.
+  int max_inflight_sends_ ABSL_GUARDED_BY(mu_);
   int free_send_records_size_ ABSL_GUARDED_BY(mu_);
   grpc_core::Mutex mu_;
   uint32_t last_send_ = 0;
   std::atomic<bool> shutdown_{false};
   bool enabled_ = false;
-  size_t threshold_bytes_ = kDefaultSendBytesThreshold;
+  const bool adaptive_;
+  std::atomic<size_t> threshold_bytes_{kDefaultSendBytesThreshold};
+  // Adaptive tuning state: nanoseconds per byte spent in copying and zerocopy
+  // sendmsg(), and nanoseconds spent per error queue completion.
+  CostEstimate copy_ns_per_byte_ ABSL_GUARDED_BY(mu_);
+  CostEstimate zerocopy_ns_per_byte_ ABSL_GUARDED_BY(mu_);
+  CostEstimate completion_ns_ ABSL_GUARDED_BY(mu_);
+  uint32_t probe_counter_ ABSL_GUARDED_BY(mu_) = 0;
   absl::flat_hash_map<uint32_t, TcpZerocopySendRecord*> ctx_lookup_
       ABSL_GUARDED_BY(mu_);
   bool memory_limited_ = false;
@@ -463,6 +542,52 @@ class TcpZerocopySendCtx {
   OptMemState zcopy_enobuf_state_ ABSL_GUARDED_BY(mu_) = OptMemState::kOpen;
 };
 
+// Returns how many bytes a TCP_ZEROCOPY_RECEIVE read should try to map when
+// expected_bytes are expected to arrive: expected_bytes capped at max_bytes
+// and rounded down to whole pages, or 0 if that is below threshold and the
+// read should copy instead.
+size_t RxZerocopyMapLength(size_t expected_bytes, size_t threshold,
+                           size_t page_size, size_t max_bytes);
+
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+// Address ranges of region_size bytes mapped on a socket, for
+// TCP_ZEROCOPY_RECEIVE to place received pages in. A region goes up the stack
+// in the slice made of the pages mapped into it, and comes back when that
+// slice is released. Its pages are then dropped with MADV_DONTNEED, which
+// releases the received memory, and the region is kept for a later read, so
+// that steady reads need neither mmap nor munmap.
+class RxZerocopyRegions : public grpc_core::RefCounted<RxZerocopyRegions> {
+ public:
+  // Regions kept for reuse, at most. Each is a VMA of its own, so this stays
+  // small to leave vm.max_map_count to the rest of the process.
+  static constexpr size_t kMaxCachedRegions = 2;
+
+  explicit RxZerocopyRegions(size_t region_size) : region_size_(region_size) {}
+  ~RxZerocopyRegions() override;
+
+  // Returns a kept region, or maps a new one on fd. Returns null if mapping
+  // fails.
+  void* Take(int fd);
+  // Gives back a region from Take(), of which the first used_bytes may hold
+  // received pages.
+  void Return(void* region, size_t used_bytes);
+
+  size_t region_size() const { return region_size_; }
+
+ private:
+  const size_t region_size_;
+  grpc_core::Mutex mu_;
+  std::vector<void*> free_regions_ ABSL_GUARDED_BY(mu_);
+};
+
+// Makes a slice of the first length bytes of region, as mapped by
+// TCP_ZEROCOPY_RECEIVE. Once the slice is released the region goes back to
+// regions and reservation, which accounts for the mapped pages, is released.
+Slice MakeRxZerocopySlice(
+    grpc_core::RefCountedPtr<RxZerocopyRegions> regions, void* region,
+    size_t length, grpc_core::MemoryAllocator::Reservation reservation);
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+
 class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
  public:
   PosixEndpointImpl(
@@ -505,6 +630,13 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+  // Maps received payload pages from the socket with TCP_ZEROCOPY_RECEIVE and
+  // appends them to dst. Returns the number of bytes appended, 0 if the read
+  // should be done by copying instead.
+  size_t TcpZerocopyReceive(grpc_event_engine::experimental::SliceBuffer& dst)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
   void FinishEstimate();
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
@@ -525,7 +657,7 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 #ifdef GRPC_LINUX_ERRQUEUE
   bool ProcessErrors();
   // Reads a cmsg to process zerocopy control messages.
-  void ProcessZerocopy(struct cmsghdr* cmsg);
+  void ProcessZerocopy(struct cmsghdr* cmsg, int64_t start_nanos);
   // Reads a cmsg to derive timestamps from the control messages.
   struct cmsghdr* ProcessTimestamp(msghdr* msg, struct cmsghdr* cmsg);
 #endif  // GRPC_LINUX_ERRQUEUE
@@ -550,6 +682,16 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   int inq_ = 1;
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+  // Set if reads of at least rx_zerocopy_threshold_ bytes should map payload
+  // pages from the socket. Cleared if the kernel turns out not to support it.
+  bool rx_zerocopy_enabled_ = false;
+  size_t rx_zerocopy_threshold_ = 0;
+  // Consecutive zerocopy attempts which did not map any data.
+  int rx_zerocopy_misses_ = 0;
+  // Created by the first zerocopy read.
+  grpc_core::RefCountedPtr<RxZerocopyRegions> rx_zerocopy_regions_;
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
 
   grpc_event_engine::experimental::SliceBuffer* outgoing_buffer_ = nullptr;
   // byte within outgoing_buffer's slices[0] to write next.
@@ -592,6 +734,10 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   // A hint from upper layers specifying the minimum number of bytes that need
   // to be read to make meaningful progress.
   int min_progress_size_ = 1;
+  // Spin budget requested from the poller, zero if this endpoint does not
+  // busy poll.
+  grpc_event_engine::experimental::EventEngine::Duration busy_poll_budget_ =
+      grpc_event_engine::experimental::EventEngine::Duration::zero();
   TracedBufferList traced_buffers_;
   // The handle is owned by the PosixEndpointImpl object.
   EventHandle* handle_;
@@ -33,6 +33,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "absl/cleanup/cleanup.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -40,11 +41,14 @@
 #include "absl/strings/str_cat.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
 #include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/iomgr/socket_mutator.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/status_helper.h"
 #include "src/core/util/strerror.h"
 #include "src/core/util/time.h"
@@ -132,8 +136,22 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
     Unref();
     return;
   }
-  // loop until accept4 returns EAGAIN, and then re-arm notification.
+  RecordAcceptQueueDepth();
+  int accepted = 0;
+  auto record_batch = absl::MakeCleanup([&accepted]() {
+    grpc_core::global_stats().IncrementTcpServerAcceptsPerWakeup(accepted);
+  });
+  // loop until accept4 returns EAGAIN, and then re-arm notification. At most
+  // tcp_server_accept_batch_size connections are accepted per notification so
+  // that a listener under a connection storm yields to the other work on its
+  // poller; any connections left in the accept queue are picked up when the
+  // re-armed notification runs.
   for (;;) {
+    if (accepted == listener_->options_.tcp_server_accept_batch_size) {
+      handle_->NotifyOnRead(notify_on_accept_);
+      handle_->SetReadable();
+      return;
+    }
     EventEngine::ResolvedAddress addr;
     memset(const_cast<sockaddr*>(addr.address()), 0, addr.size());
     // Note: If we ever decide to return this address to the user, remember to
@@ -202,6 +220,8 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
       addr = EventEngine::ResolvedAddress(addr.address(), len);
     }
 
+    ++accepted;
+    grpc_core::global_stats().IncrementTcpServerConnectionsAccepted();
     PosixSocketWrapper sock(fd);
     (void)sock.SetSocketNoSigpipeIfPossible();
     auto result = sock.ApplySocketMutatorInOptions(
@@ -250,6 +270,22 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
   GPR_UNREACHABLE_CODE(return);
 }
 
+void PosixEngineListenerImpl::AsyncConnectionAcceptor::
+    RecordAcceptQueueDepth() {
+#ifdef GRPC_LINUX_ERRQUEUE
+  // For listening TCP sockets, Linux reports the number of connections waiting
+  // in the accept queue in tcpi_unacked.
+  if (socket_.addr.address()->sa_family != AF_INET &&
+      socket_.addr.address()->sa_family != AF_INET6) {
+    return;
+  }
+  tcp_info info;
+  if (GetSocketTcpInfo(&info, handle_->WrappedFd()) != 0) return;
+  grpc_core::global_stats().IncrementTcpServerAcceptQueueDepth(
+      info.tcpi_unacked);
+#endif
+}
+
 absl::Status PosixEngineListenerImpl::HandleExternalConnection(
     int listener_fd, int fd, SliceBuffer* pending_data) {
   if (listener_fd < 0) {
@@ -96,6 +96,9 @@ class PosixEngineListenerImpl
     // Internal callback invoked when the socket has incoming connections to
     // process.
     void NotifyOnAccept(absl::Status status);
+    // Samples the number of connections waiting in the accept queue of the
+    // socket, where the platform reports it.
+    void RecordAcceptQueueDepth();
     // Shutdown the poller handle associated with this socket.
     void Shutdown();
     void Ref() { ref_count_.fetch_add(1, std::memory_order_relaxed); }
@@ -137,10 +140,12 @@ class PosixEngineListenerImpl
     }
 
     void Append(ListenerSocket socket) override {
-      acceptors_.push_back(new AsyncConnectionAcceptor(
-          listener_->engine_, listener_->shared_from_this(), socket));
-      if (on_append_) {
-        on_append_(socket.sock.Fd());
+      AppendAcceptor(socket);
+      // With a sharded listener every bound address gets additional
+      // SO_REUSEPORT sockets, each served by its own acceptor.
+      for (const ListenerSocket& shard :
+           CreateListenerSocketShards(listener_->options_, socket)) {
+        AppendAcceptor(shard);
       }
     }
 
@@ -167,6 +172,14 @@ class PosixEngineListenerImpl
     }
 
    private:
+    void AppendAcceptor(const ListenerSocket& socket) {
+      acceptors_.push_back(new AsyncConnectionAcceptor(
+          listener_->engine_, listener_->shared_from_this(), socket));
+      if (on_append_) {
+        on_append_(socket.sock.Fd());
+      }
+    }
+
     PosixListenerWithFdSupport::OnPosixBindNewFdCallback on_append_;
     std::list<AsyncConnectionAcceptor*> acceptors_;
     PosixEngineListenerImpl* listener_;
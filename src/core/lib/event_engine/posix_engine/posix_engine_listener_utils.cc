@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <vector>
 
 #include "absl/cleanup/cleanup.h"
 #include "absl/log/check.h"
@@ -227,6 +228,32 @@ absl::StatusOr<ListenerSocket> CreateAndPrepareListenerSocket(
   return socket;
 }
 
+std::vector<ListenerSocket> CreateListenerSocketShards(
+    const PosixTcpOptions& options, const ListenerSocket& socket) {
+  std::vector<ListenerSocket> shards;
+  if (options.tcp_server_listener_shards <= 1 || !options.allow_reuse_port ||
+      !PosixSocketWrapper::IsSocketReusePortSupported() ||
+      socket.addr.address()->sa_family == AF_UNIX ||
+      ResolvedAddressIsVSock(socket.addr)) {
+    return shards;
+  }
+  // Bind the shards to the port chosen for the first socket, which matters
+  // when the requested port was 0.
+  ResolvedAddress addr = socket.addr;
+  ResolvedAddressSetPort(addr, socket.port);
+  for (int i = 1; i < options.tcp_server_listener_shards; ++i) {
+    auto shard = CreateAndPrepareListenerSocket(options, addr);
+    if (!shard.ok()) {
+      LOG(ERROR) << "Failed to create listener shard " << i << " of "
+                 << options.tcp_server_listener_shards << ": "
+                 << shard.status();
+      break;
+    }
+    shards.push_back(*shard);
+  }
+  return shards;
+}
+
 bool IsSockAddrLinkLocal(const EventEngine::ResolvedAddress* resolved_addr) {
   const sockaddr* addr = resolved_addr->address();
   if (addr->sa_family == AF_INET) {
@@ -397,6 +424,14 @@ CreateAndPrepareListenerSocket(const PosixTcpOptions& /*options*/,
       "CreateAndPrepareListenerSocket is not supported on this platform");
 }
 
+std::vector<ListenerSocketsContainer::ListenerSocket>
+CreateListenerSocketShards(
+    const PosixTcpOptions& /*options*/,
+    const ListenerSocketsContainer::ListenerSocket& /*socket*/) {
+  grpc_core::Crash(
+      "CreateListenerSocketShards is not supported on this platform");
+}
+
 absl::StatusOr<int> ListenerContainerAddWildcardAddresses(
     ListenerSocketsContainer& /*listener_sockets*/,
     const PosixTcpOptions& /*options*/, int /*requested_port*/) {
@@ -17,6 +17,8 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <vector>
+
 #include "absl/status/statusor.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 
@@ -62,6 +64,17 @@ CreateAndPrepareListenerSocket(
     const PosixTcpOptions& options,
     const grpc_event_engine::experimental::EventEngine::ResolvedAddress& addr);
 
+// Creates the extra sockets of a sharded listener. When
+// options.tcp_server_listener_shards is greater than 1 and SO_REUSEPORT is
+// enabled, (tcp_server_listener_shards - 1) additional sockets are bound to the
+// address and port of the passed socket, so that the kernel spreads incoming
+// connections over their accept queues. Failing to create a shard is not fatal
+// and only reduces the number of shards.
+std::vector<ListenerSocketsContainer::ListenerSocket>
+CreateListenerSocketShards(
+    const PosixTcpOptions& options,
+    const ListenerSocketsContainer::ListenerSocket& socket);
+
 // Instead of creating and adding a socket bound to specific address, this
 // function creates and adds a socket bound to the wildcard address on the
 // server. The newly created socket is configured according to the passed
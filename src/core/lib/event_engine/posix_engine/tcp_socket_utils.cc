@@ -42,6 +42,14 @@
 #include <fcntl.h>
 #include <sys/socket.h>
 #include <unistd.h>
+#ifdef GPR_LINUX
+#ifndef SO_BUSY_POLL
+#define SO_BUSY_POLL 46
+#endif
+#ifndef SO_PREFER_BUSY_POLL
+#define SO_PREFER_BUSY_POLL 69
+#endif
+#endif
 #endif  //  GRPC_POSIX_SOCKET_UTILS_COMMON
 
 #include <atomic>
@@ -176,6 +184,15 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_tx_zerocopy_adaptive =
+      (AdjustValue(0, 0, 1, config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ADAPTIVE)) !=
+       0);
+  options.tcp_rx_zero_copy_enabled =
+      (AdjustValue(0, 0, 1, config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) !=
+       0);
+  options.tcp_rx_zerocopy_threshold =
+      AdjustValue(PosixTcpOptions::kDefaultRxZerocopyThreshold, 0, INT_MAX,
+                  config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_THRESHOLD));
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -185,6 +202,16 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
                    config.GetInt(GRPC_ARG_EXPAND_WILDCARD_ADDRS)) != 0);
   options.dscp = AdjustValue(PosixTcpOptions::kDscpNotSet, 0, 63,
                              config.GetInt(GRPC_ARG_DSCP));
+  options.tcp_server_accept_batch_size =
+      AdjustValue(PosixTcpOptions::kDefaultAcceptBatchSize, 1, INT_MAX,
+                  config.GetInt(GRPC_ARG_TCP_SERVER_ACCEPT_BATCH_SIZE));
+  options.tcp_server_listener_shards =
+      AdjustValue(PosixTcpOptions::kDefaultListenerShards, 1,
+                  PosixTcpOptions::kMaxListenerShards,
+                  config.GetInt(GRPC_ARG_TCP_SERVER_LISTENER_SHARDS));
+  options.tcp_busy_poll_us =
+      AdjustValue(0, 0, PosixTcpOptions::kMaxBusyPollUs,
+                  config.GetInt(GRPC_ARG_TCP_BUSY_POLL_US));
   options.allow_reuse_port = PosixSocketWrapper::IsSocketReusePortSupported();
   auto allow_reuse_port_value = config.GetInt(GRPC_ARG_ALLOW_REUSEPORT);
   if (allow_reuse_port_value.has_value()) {
@@ -505,6 +532,29 @@ bool PosixSocketWrapper::IsSocketReusePortSupported() {
   return kSupportSoReusePort;
 }
 
+absl::Status PosixSocketWrapper::SetSocketBusyPoll(int usec) {
+#ifdef GPR_LINUX
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec))) {
+    return absl::Status(
+        absl::StatusCode::kInternal,
+        absl::StrCat("setsockopt(SO_BUSY_POLL): ", grpc_core::StrError(errno)));
+  }
+  // SO_PREFER_BUSY_POLL needs Linux 5.11; older kernels still honor
+  // SO_BUSY_POLL, so its absence is not an error.
+  const int prefer = 1;
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer,
+                      sizeof(prefer))) {
+    VLOG(2) << "setsockopt(SO_PREFER_BUSY_POLL): "
+            << grpc_core::StrError(errno);
+  }
+  return absl::OkStatus();
+#else
+  (void)usec;
+  return absl::Status(absl::StatusCode::kInternal,
+                      "SO_BUSY_POLL unavailable on compiling system");
+#endif
+}
+
 // Disable nagle algorithm
 absl::Status PosixSocketWrapper::SetSocketLowLatency(int low_latency) {
   int val = (low_latency != 0);
@@ -843,6 +893,10 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int /*reuse*/) {
   grpc_core::Crash("unimplemented");
 }
 
+absl::Status PosixSocketWrapper::SetSocketBusyPoll(int /*usec*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketDscp(int /*dscp*/) {
   grpc_core::Crash("unimplemented");
 }
@@ -56,9 +56,14 @@ struct PosixTcpOptions {
   static constexpr int kMaxChunkSize = 32 * 1024 * 1024;
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;
+  static constexpr int kDefaultRxZerocopyThreshold = 256 * 1024;
   // Let the system decide the proper buffer size.
   static constexpr int kReadBufferSizeUnset = -1;
   static constexpr int kDscpNotSet = -1;
+  static constexpr int kDefaultAcceptBatchSize = 128;
+  static constexpr int kDefaultListenerShards = 1;
+  static constexpr int kMaxListenerShards = 1024;
+  static constexpr int kMaxBusyPollUs = 1000 * 1000;
   int tcp_read_chunk_size = kDefaultReadChunkSize;
   int tcp_min_read_chunk_size = kDefaultMinReadChunksize;
   int tcp_max_read_chunk_size = kDefaultMaxReadChunksize;
@@ -66,11 +71,17 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  bool tcp_tx_zerocopy_adaptive = false;
+  bool tcp_rx_zero_copy_enabled = false;
+  int tcp_rx_zerocopy_threshold = kDefaultRxZerocopyThreshold;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
   int dscp = kDscpNotSet;
+  int tcp_server_accept_batch_size = kDefaultAcceptBatchSize;
+  int tcp_server_listener_shards = kDefaultListenerShards;
+  int tcp_busy_poll_us = 0;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
   grpc_event_engine::experimental::MemoryAllocatorFactory*
@@ -137,11 +148,17 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_tx_zerocopy_adaptive = other.tcp_tx_zerocopy_adaptive;
+    tcp_rx_zero_copy_enabled = other.tcp_rx_zero_copy_enabled;
+    tcp_rx_zerocopy_threshold = other.tcp_rx_zerocopy_threshold;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
     dscp = other.dscp;
+    tcp_server_accept_batch_size = other.tcp_server_accept_batch_size;
+    tcp_server_listener_shards = other.tcp_server_listener_shards;
+    tcp_busy_poll_us = other.tcp_busy_poll_us;
   }
 };
 
@@ -189,6 +206,11 @@ class PosixSocketWrapper {
   // Set SO_REUSEPORT
   absl::Status SetSocketReusePort(int reuse);
 
+  // Busy poll the device queue for up to usec microseconds on blocking reads
+  // and, where supported, prefer busy polling over interrupt driven receive
+  // processing (SO_BUSY_POLL and SO_PREFER_BUSY_POLL). Linux only.
+  absl::Status SetSocketBusyPoll(int usec);
+
   // Set Differentiated Services Code Point (DSCP)
   absl::Status SetSocketDscp(int dscp);
 
@@ -0,0 +1,251 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timing_wheel.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "absl/numeric/bits.h"
+#include "src/core/util/time.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_event_engine::experimental {
+
+TimingWheelTimerList::Shard::Shard()
+    : elapsed(0), min_deadline(kNoDeadline), occupied{}, slots{} {}
+
+TimingWheelTimerList::TimingWheelTimerList(TimerListHost* host)
+    : host_(host),
+      num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
+      min_timer_(host_->Now().milliseconds_after_process_epoch()),
+      shards_(new Shard[num_shards_]) {
+  for (size_t i = 0; i < num_shards_; i++) {
+    shards_[i].elapsed = min_timer_.load(std::memory_order_relaxed);
+  }
+}
+
+// Timers are filed relative to 'elapsed': the level is picked from the most
+// significant bit in which the deadline differs from 'elapsed', so every timer
+// of a level sits in the current rotation of that level, at or after its
+// current slot. The index of the slot holding a timer is kept in its
+// heap_index.
+void TimingWheelTimerList::Shard::Add(Timer* timer) {
+  const uint64_t now = elapsed;
+  uint64_t deadline = std::max(timer->deadline, elapsed);
+  if ((now ^ deadline) > kMaxTicks) {
+    // Too far out: park the timer in the last slot of the current rotation of
+    // the highest level. It gets re-filed once that slot is reached.
+    deadline = now | kMaxTicks;
+  }
+  const int level =
+      (absl::bit_width((now ^ deadline) | (kSlotsPerLevel - 1)) - 1) /
+      kLevelBits;
+  const size_t slot =
+      (deadline >> (level * kLevelBits)) & (kSlotsPerLevel - 1);
+  timer->heap_index = level * kSlotsPerLevel + slot;
+  timer->prev = nullptr;
+  timer->next = slots[level][slot];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  slots[level][slot] = timer;
+  occupied[level] |= uint64_t{1} << slot;
+}
+
+void TimingWheelTimerList::Shard::Remove(Timer* timer) {
+  const size_t level = timer->heap_index / kSlotsPerLevel;
+  const size_t slot = timer->heap_index % kSlotsPerLevel;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    slots[level][slot] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (slots[level][slot] == nullptr) {
+    occupied[level] &= ~(uint64_t{1} << slot);
+  }
+}
+
+int64_t TimingWheelTimerList::Shard::NextEventTick() const {
+  int64_t next = kNoDeadline;
+  for (int level = 0; level < kNumLevels; level++) {
+    if (occupied[level] == 0) continue;
+    const int shift = level * kLevelBits;
+    const uint64_t current =
+        (static_cast<uint64_t>(elapsed) >> shift) & (kSlotsPerLevel - 1);
+    DCHECK_EQ(occupied[level] & (~uint64_t{0} << current), occupied[level]);
+    const uint64_t rotation = static_cast<uint64_t>(elapsed) >>
+                              (shift + kLevelBits) << (shift + kLevelBits);
+    const uint64_t tick =
+        rotation |
+        (static_cast<uint64_t>(absl::countr_zero(occupied[level])) << shift);
+    next = std::min(next, static_cast<int64_t>(tick));
+  }
+  return next;
+}
+
+void TimingWheelTimerList::Shard::Advance(
+    int64_t now, std::vector<experimental::EventEngine::Closure*>* out) {
+  for (int64_t tick = NextEventTick(); tick <= now; tick = NextEventTick()) {
+    elapsed = tick;
+    // Cascade the slots starting at this tick, highest level first so that
+    // timers moving down more than one level get cascaded again right away.
+    for (int level = kNumLevels - 1; level > 0; level--) {
+      const int shift = level * kLevelBits;
+      if ((tick & ((int64_t{1} << shift) - 1)) != 0) continue;
+      const size_t slot = (tick >> shift) & (kSlotsPerLevel - 1);
+      Timer* timer = std::exchange(slots[level][slot], nullptr);
+      occupied[level] &= ~(uint64_t{1} << slot);
+      while (timer != nullptr) {
+        Timer* next = timer->next;
+        Add(timer);
+        timer = next;
+      }
+    }
+    const size_t slot = tick & (kSlotsPerLevel - 1);
+    Timer* timer = std::exchange(slots[0][slot], nullptr);
+    occupied[0] &= ~(uint64_t{1} << slot);
+    elapsed = tick + 1;
+    while (timer != nullptr) {
+      Timer* next = timer->next;
+      if (timer->deadline > tick) {
+        // A parked timer reaching the end of the range of the wheels.
+        Add(timer);
+      } else {
+        timer->pending = false;
+        out->push_back(timer->closure);
+      }
+      timer = next;
+    }
+  }
+  // No slot is due before now, so the wheels can skip straight past it.
+  elapsed = std::max(elapsed, now + 1);
+  min_deadline = NextEventTick();
+}
+
+void TimingWheelTimerList::TimerInit(
+    Timer* timer, grpc_core::Timestamp deadline,
+    experimental::EventEngine::Closure* closure) {
+  bool is_first_timer = false;
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    timer->pending = true;
+    grpc_core::Timestamp now = host_->Now();
+    if (deadline <= now) {
+      deadline = now;
+    }
+    shard->Add(timer);
+    if (deadline.milliseconds_after_process_epoch() < shard->min_deadline) {
+      shard->min_deadline = deadline.milliseconds_after_process_epoch();
+      is_first_timer = true;
+    }
+  }
+
+  // FindExpiredTimers() holds mu_ while it recomputes min_timer_ from the
+  // shards, so either it sees the new timer, or we see the value it stored.
+  if (is_first_timer) {
+    grpc_core::MutexLock lock(&mu_);
+    if (deadline < grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                       min_timer_.load(std::memory_order_relaxed))) {
+      min_timer_.store(deadline.milliseconds_after_process_epoch(),
+                       std::memory_order_relaxed);
+      host_->Kick();
+    }
+  }
+}
+
+bool TimingWheelTimerList::TimerCancel(Timer* timer) {
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  grpc_core::MutexLock lock(&shard->mu);
+
+  if (timer->pending) {
+    timer->pending = false;
+    shard->Remove(timer);
+    return true;
+  }
+
+  return false;
+}
+
+std::vector<experimental::EventEngine::Closure*>
+TimingWheelTimerList::FindExpiredTimers(grpc_core::Timestamp now,
+                                        grpc_core::Timestamp* next) {
+  grpc_core::Timestamp min_timer =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+          min_timer_.load(std::memory_order_relaxed));
+
+  std::vector<experimental::EventEngine::Closure*> done;
+  if (now < min_timer) {
+    if (next != nullptr) *next = std::min(*next, min_timer);
+    return done;
+  }
+
+  grpc_core::MutexLock lock(&mu_);
+
+  const int64_t now_millis = now.milliseconds_after_process_epoch();
+  int64_t min_deadline = kNoDeadline;
+  for (size_t i = 0; i < num_shards_; i++) {
+    Shard& shard = shards_[i];
+    grpc_core::MutexLock shard_lock(&shard.mu);
+    if (shard.min_deadline <= now_millis) shard.Advance(now_millis, &done);
+    min_deadline = std::min(min_deadline, shard.min_deadline);
+  }
+  min_timer = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+      min_deadline);
+
+  if (next != nullptr) {
+    *next = std::min(*next, min_timer);
+  }
+
+  min_timer_.store(min_deadline, std::memory_order_relaxed);
+
+  return done;
+}
+
+std::optional<std::vector<experimental::EventEngine::Closure*>>
+TimingWheelTimerList::TimerCheck(grpc_core::Timestamp* next) {
+  grpc_core::Timestamp now = host_->Now();
+
+  grpc_core::Timestamp min_timer =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+          min_timer_.load(std::memory_order_relaxed));
+
+  if (now < min_timer) {
+    if (next != nullptr) {
+      *next = std::min(*next, min_timer);
+    }
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+
+  if (!checker_mu_.TryLock()) return std::nullopt;
+  std::vector<experimental::EventEngine::Closure*> run =
+      FindExpiredTimers(now, next);
+  checker_mu_.Unlock();
+
+  return std::move(run);
+}
+
+}  // namespace grpc_event_engine::experimental
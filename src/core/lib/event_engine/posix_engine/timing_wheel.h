@@ -0,0 +1,114 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMING_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMING_WHEEL_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_event_engine::experimental {
+
+// A TimerListInterface implementation based on a hierarchical timing wheel.
+//
+// Time is measured in millisecond ticks. Each shard holds kNumLevels wheels of
+// 64 slots; a slot on level L spans 64^L ticks, so the wheels together cover
+// 2^36 ms (a little over two years). A timer is filed on the lowest level
+// whose slots still distinguish its deadline from the shard's current tick,
+// which makes TimerInit and TimerCancel O(1) regardless of the number of
+// pending timers. As time advances, the slots of the higher levels are
+// cascaded into the lower ones, and the timers of the level 0 slot of each
+// elapsed tick are expired. Timers further out than the wheels can represent
+// are parked in the last slot of the highest level and re-filed when reached.
+class TimingWheelTimerList final : public TimerListInterface {
+ public:
+  explicit TimingWheelTimerList(TimerListHost* host);
+
+  TimingWheelTimerList(const TimingWheelTimerList&) = delete;
+  TimingWheelTimerList& operator=(const TimingWheelTimerList&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+  std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr int kLevelBits = 6;
+  static constexpr size_t kSlotsPerLevel = size_t{1} << kLevelBits;
+  static constexpr int kNumLevels = 6;
+  // Timers are never filed further than this many ticks past the current one.
+  static constexpr uint64_t kMaxTicks =
+      (uint64_t{1} << (kLevelBits * kNumLevels)) - 1;
+  static constexpr int64_t kNoDeadline = std::numeric_limits<int64_t>::max();
+
+  struct Shard {
+    Shard();
+
+    // Files timer in the slot matching its deadline.
+    void Add(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Unlinks timer from the slot it is filed in.
+    void Remove(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Returns the earliest tick at which a slot needs to be processed, or
+    // kNoDeadline if the shard is empty.
+    int64_t NextEventTick() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Processes all the ticks up-to and including now, appending the closures
+    // of the expired timers to out.
+    void Advance(int64_t now,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // The first tick that has not been processed yet.
+    int64_t elapsed ABSL_GUARDED_BY(mu);
+    // A lower bound of the deadline of the next timer due in this shard.
+    int64_t min_deadline ABSL_GUARDED_BY(mu);
+    // Bitmaps of the non-empty slots of each level.
+    uint64_t occupied[kNumLevels] ABSL_GUARDED_BY(mu);
+    // Heads of the doubly linked lists of timers filed in each slot.
+    Timer* slots[kNumLevels][kSlotsPerLevel] ABSL_GUARDED_BY(mu);
+  };
+
+  std::vector<experimental::EventEngine::Closure*> FindExpiredTimers(
+      grpc_core::Timestamp now, grpc_core::Timestamp* next);
+
+  TimerListHost* const host_;
+  const size_t num_shards_;
+  grpc_core::Mutex mu_;
+  // The deadline of the next timer due across all timer shards
+  std::atomic<uint64_t> min_timer_;
+  // Allow only one FindExpiredTimers at once (used as a TryLock, protects no
+  // fields but ensures limits on concurrency)
+  grpc_core::Mutex checker_mu_;
+  // Array of timer shards. Whenever a timer (Timer *) is added, its address
+  // is hashed to select the timer shard to add the timer to
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMING_WHEEL_H
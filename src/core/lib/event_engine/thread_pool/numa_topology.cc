@@ -0,0 +1,149 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "src/core/util/no_destruct.h"
+
+#ifdef GPR_LINUX
+#include <sched.h>
+#endif
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// CPU and node ids above this are rejected as malformed.
+constexpr int kMaxCpuId = 1 << 16;
+
+// Returns the first line of a sysfs file, without trailing whitespace.
+std::optional<std::string> ReadSysfsLine(const std::string& path) {
+  FILE* fp = fopen(path.c_str(), "r");
+  if (fp == nullptr) return std::nullopt;
+  char buf[4096];
+  std::optional<std::string> line;
+  if (fgets(buf, sizeof(buf), fp) != nullptr) {
+    line = std::string(absl::StripTrailingAsciiWhitespace(buf));
+  }
+  fclose(fp);
+  return line;
+}
+
+}  // namespace
+
+std::optional<std::vector<int>> ParseCpuList(absl::string_view list) {
+  std::vector<int> ids;
+  if (list.empty()) return ids;
+  for (absl::string_view range : absl::StrSplit(list, ',')) {
+    const size_t dash = range.find('-');
+    int first;
+    int last;
+    if (!absl::SimpleAtoi(range.substr(0, dash), &first)) return std::nullopt;
+    if (dash == absl::string_view::npos) {
+      last = first;
+    } else if (!absl::SimpleAtoi(range.substr(dash + 1), &last)) {
+      return std::nullopt;
+    }
+    if (first < 0 || last < first || last > kMaxCpuId) return std::nullopt;
+    for (int id = first; id <= last; id++) ids.push_back(id);
+  }
+  return ids;
+}
+
+const NumaTopology& NumaTopology::Get() {
+#ifdef GPR_LINUX
+  static const grpc_core::NoDestruct<NumaTopology> topology(
+      FromSysfs("/sys/devices/system/node"));
+#else
+  static const grpc_core::NoDestruct<NumaTopology> topology(SingleNode());
+#endif
+  return *topology;
+}
+
+NumaTopology NumaTopology::FromSysfs(absl::string_view node_dir) {
+  std::optional<std::string> online =
+      ReadSysfsLine(absl::StrCat(node_dir, "/online"));
+  if (!online.has_value()) return SingleNode();
+  std::optional<std::vector<int>> node_ids = ParseCpuList(*online);
+  if (!node_ids.has_value()) return SingleNode();
+  NumaTopology topology;
+  int max_cpu = -1;
+  for (int node_id : *node_ids) {
+    std::optional<std::string> cpu_list =
+        ReadSysfsLine(absl::StrCat(node_dir, "/node", node_id, "/cpulist"));
+    if (!cpu_list.has_value()) continue;
+    std::optional<std::vector<int>> cpus = ParseCpuList(*cpu_list);
+    // Memory-only nodes have an empty CPU list.
+    if (!cpus.has_value() || cpus->empty()) continue;
+    max_cpu = std::max(max_cpu, *std::max_element(cpus->begin(), cpus->end()));
+    topology.nodes_.push_back(std::move(*cpus));
+  }
+  if (topology.nodes_.empty()) return SingleNode();
+  topology.node_of_cpu_.resize(max_cpu + 1, 0);
+  for (size_t node = 0; node < topology.nodes_.size(); node++) {
+    for (int cpu : topology.nodes_[node]) topology.node_of_cpu_[cpu] = node;
+  }
+  return topology;
+}
+
+NumaTopology NumaTopology::SingleNode() {
+  NumaTopology topology;
+  std::vector<int> cpus(gpr_cpu_num_cores());
+  for (size_t i = 0; i < cpus.size(); i++) cpus[i] = i;
+  topology.nodes_.push_back(std::move(cpus));
+  return topology;
+}
+
+size_t NumaTopology::NodeOfCpu(int cpu) const {
+  if (cpu < 0 || static_cast<size_t>(cpu) >= node_of_cpu_.size()) return 0;
+  return node_of_cpu_[cpu];
+}
+
+size_t NumaTopology::CurrentNode() const {
+  if (nodes_.size() == 1) return 0;
+  return NodeOfCpu(gpr_cpu_current_cpu());
+}
+
+bool NumaTopology::BindCurrentThreadToNode(size_t node) const {
+#ifdef GPR_LINUX
+  // Stay within the CPUs the thread may already run on, as restricted by
+  // taskset or a cpuset cgroup.
+  cpu_set_t allowed;
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return false;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : nodes_[node]) {
+    if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) CPU_SET(cpu, &set);
+  }
+  if (CPU_COUNT(&set) == 0) return false;
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+  (void)node;
+  return false;
+#endif
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,69 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_NUMA_TOPOLOGY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_NUMA_TOPOLOGY_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <optional>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine::experimental {
+
+// The NUMA nodes of the machine and the CPUs that belong to each of them.
+//
+// Nodes are numbered densely from 0, in the order of their kernel ids. Nodes
+// without CPUs are left out. When the topology cannot be determined, it
+// consists of a single node holding every CPU.
+class NumaTopology {
+ public:
+  // Returns the topology of this machine, read once from
+  // /sys/devices/system/node.
+  static const NumaTopology& Get();
+  // Reads the topology from a directory laid out like /sys/devices/system/node.
+  static NumaTopology FromSysfs(absl::string_view node_dir);
+  // A topology consisting of a single node.
+  static NumaTopology SingleNode();
+
+  size_t num_nodes() const { return nodes_.size(); }
+  const std::vector<int>& cpus(size_t node) const { return nodes_[node]; }
+  // Returns the node cpu belongs to, or 0 if it is unknown.
+  size_t NodeOfCpu(int cpu) const;
+  // Returns the node of the CPU the calling thread is running on.
+  size_t CurrentNode() const;
+  // Restricts the calling thread to those CPUs of node it is already allowed
+  // to run on. Returns false, leaving the thread's affinity alone, if it may
+  // not run on any CPU of node, if that is not supported on this platform or
+  // if the kernel refused it.
+  bool BindCurrentThreadToNode(size_t node) const;
+
+ private:
+  NumaTopology() = default;
+
+  std::vector<std::vector<int>> nodes_;
+  // Indexed by CPU id.
+  std::vector<size_t> node_of_cpu_;
+};
+
+// Parses a kernel CPU list such as "0-3,8,10-11". Returns nullopt if the list
+// is malformed.
+std::optional<std::vector<int>> ParseCpuList(absl::string_view list);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_NUMA_TOPOLOGY_H
@@ -34,10 +34,16 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_local.h"
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
@@ -134,6 +140,19 @@ constexpr grpc_core::Duration kLifeguardMaxSleepBetweenChecks{
     grpc_core::Duration::Seconds(1)};
 constexpr grpc_core::Duration kBlockUntilThreadCountTimeout{
     grpc_core::Duration::Seconds(60)};
+// Time an idle worker waits for work on its own NUMA node before taking work
+// that belongs to other nodes.
+constexpr grpc_core::Duration kCrossNodeStealDelay{
+    grpc_core::Duration::Milliseconds(1)};
+// When scaling by queue delay, one of every this many closures is timed from
+// when it is queued until it starts running.
+constexpr uint32_t kQueueDelaySampleInterval = 16;
+// When scaling by queue delay, the minimum time between thread creations.
+constexpr grpc_core::Duration kQueueDelayTimeBetweenThreadStarts =
+    grpc_core::Duration::Milliseconds(100);
+// When scaling by queue delay, an idle thread is retired if closures wait less
+// than the target delay divided by this.
+constexpr int kQueueDelayRetireDivisor = 4;
 
 #ifdef GPR_POSIX_SYNC
 const bool g_log_verbose_failures =
@@ -165,6 +184,34 @@ void DumpSignalHandler(int /* sig */) {
 }  // namespace
 
 thread_local WorkQueue* g_local_queue = nullptr;
+thread_local uint32_t g_queue_delay_sample_count = 0;
+
+// -------- QueueDelayScaler --------
+
+QueueDelayScaler::Decision QueueDelayScaler::Decide(
+    const PoolState& state, grpc_core::Timestamp now,
+    grpc_core::Timestamp last_thread_start) {
+  const bool has_idle_threads = state.busy_threads < state.living_threads;
+  // Without samples, the pool is either idle, or every thread is stuck on
+  // closures that were queued before the last check.
+  const bool behind = state.queue_delay.has_value()
+                          ? *state.queue_delay > target_queue_delay_
+                          : !has_idle_threads && !state.global_queues_empty;
+  const bool retire =
+      !behind && has_idle_threads &&
+      state.living_threads > state.reserve_threads &&
+      state.queue_delay.value_or(grpc_core::Duration::Zero()) <
+          target_queue_delay_ / kQueueDelayRetireDivisor;
+  // Withdraw a retirement no thread took, now that delays went back up.
+  retire_idle_thread_.store(retire, std::memory_order_relaxed);
+  if (retire) return Decision::kRetireIdleThread;
+  if (!behind) return Decision::kNone;
+  if (has_idle_threads) return Decision::kWakeIdleThreads;
+  if (now - last_thread_start < kQueueDelayTimeBetweenThreadStarts) {
+    return Decision::kThrottled;
+  }
+  return Decision::kStartThread;
+}
 
 // -------- WorkStealingThreadPool --------
 
@@ -193,22 +240,34 @@ void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
 
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
-void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
+void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue,
+                                                   size_t node) {
   grpc_core::MutexLock lock(&mu_);
-  queues_.emplace(queue);
+  queues_[node].emplace(queue);
 }
 
-void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
+void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue,
+                                                     size_t node) {
   grpc_core::MutexLock lock(&mu_);
-  queues_.erase(queue);
+  queues_[node].erase(queue);
 }
 
-EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne(
+    size_t node, bool cross_node) {
   grpc_core::MutexLock lock(&mu_);
   EventEngine::Closure* closure;
-  for (auto* queue : queues_) {
-    closure = queue->PopMostRecent();
-    if (closure != nullptr) return closure;
+  const size_t num_nodes = cross_node ? queues_.size() : 1;
+  for (size_t i = 0; i < num_nodes; i++) {
+    for (auto* queue : queues_[(node + i) % queues_.size()]) {
+      closure = steal_oldest_ ? queue->PopOldest() : queue->PopMostRecent();
+      if (closure != nullptr) {
+        grpc_core::global_stats().IncrementThreadPoolSteals();
+        if (i != 0) {
+          grpc_core::global_stats().IncrementThreadPoolCrossNodeSteals();
+        }
+        return closure;
+      }
+    }
   }
   return nullptr;
 }
@@ -223,7 +282,21 @@ void WorkStealingThreadPool::PostforkChild() { pool_->Postfork(); }
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
     size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    : reserve_threads_(reserve_threads),
+      chase_lev_queues_(grpc_core::IsEventEngineChaseLevWorkQueueEnabled()),
+      topology_(grpc_core::IsEventEngineNumaAwareThreadPoolEnabled()
+                    ? NumaTopology::Get()
+                    : NumaTopology::SingleNode()),
+      queue_delay_scaling_(grpc_core::IsEventEngineQueueDelayScalingEnabled()),
+      queue_delay_scaler_(grpc_core::Duration::Milliseconds(
+          grpc_core::ConfigVars::Get()
+              .EventEngineThreadPoolTargetQueueDelayMs())),
+      theft_registry_(topology_.num_nodes(), chase_lev_queues_) {
+  queues_.reserve(topology_.num_nodes());
+  for (size_t i = 0; i < topology_.num_nodes(); i++) {
+    queues_.push_back(std::make_unique<BasicWorkQueue>(this));
+  }
+}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -236,16 +309,81 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
     EventEngine::Closure* closure) {
   CHECK(!IsQuiesced());
+  if (queue_delay_scaling_ &&
+      ++g_queue_delay_sample_count % kQueueDelaySampleInterval == 0) {
+    closure = SelfDeletingClosure::Create(
+        [this, closure, queued = std::chrono::steady_clock::now()]() {
+          RecordQueueDelay(std::chrono::steady_clock::now() - queued);
+          closure->Run();
+        });
+  }
   if (g_local_queue != nullptr && g_local_queue->owner() == this) {
     g_local_queue->Add(closure);
   } else {
-    queue_.Add(closure);
+    queues_[topology_.CurrentNode()]->Add(closure);
   }
   // Signal a worker in any case, even if work was added to a local queue. This
   // improves performance on 32-core streaming benchmarks with small payloads.
   work_signal_.Signal();
 }
 
+EventEngine::Closure*
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::PopGlobal(size_t node,
+                                                              bool cross_node) {
+  EventEngine::Closure* closure = queues_[node]->PopMostRecent();
+  if (closure != nullptr || !cross_node) return closure;
+  for (size_t i = 1; i < queues_.size(); i++) {
+    closure = queues_[(node + i) % queues_.size()]->PopMostRecent();
+    if (closure != nullptr) {
+      grpc_core::global_stats().IncrementThreadPoolCrossNodeSteals();
+      return closure;
+    }
+  }
+  return nullptr;
+}
+
+size_t WorkStealingThreadPool::WorkStealingThreadPoolImpl::NextThreadNode() {
+  return next_thread_node_.fetch_add(1, std::memory_order_relaxed) %
+         topology_.num_nodes();
+}
+
+WorkQueue* WorkStealingThreadPool::WorkStealingThreadPoolImpl::NewLocalQueue() {
+  if (chase_lev_queues_) return new ChaseLevWorkQueue(this);
+  return new BasicWorkQueue(this);
+}
+
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::RecordQueueDelay(
+    std::chrono::steady_clock::duration delay) {
+  const uint64_t delay_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(delay).count();
+  grpc_core::global_stats().IncrementThreadPoolQueueDelay(delay_us);
+  queue_delay_sum_us_.fetch_add(delay_us, std::memory_order_relaxed);
+  queue_delay_samples_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::optional<grpc_core::Duration>
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::TakeQueueDelay() {
+  const uint64_t samples =
+      queue_delay_samples_.exchange(0, std::memory_order_relaxed);
+  const uint64_t sum_us =
+      queue_delay_sum_us_.exchange(0, std::memory_order_relaxed);
+  if (samples == 0) return std::nullopt;
+  return grpc_core::Duration::MicrosecondsRoundDown(sum_us / samples);
+}
+
+bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::
+    ShouldRetireIdleThread() {
+  return queue_delay_scaler_.TakeRetirement() &&
+         living_thread_count_.count() > reserve_threads_;
+}
+
+bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::GlobalQueuesEmpty() {
+  for (const auto& queue : queues_) {
+    if (!queue->Empty()) return false;
+  }
+  return true;
+}
+
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
   last_started_thread_.store(
       grpc_core::Timestamp::Now().milliseconds_after_process_epoch(),
@@ -277,7 +415,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
   if (!threads_were_shut_down.ok() && g_log_verbose_failures) {
     DumpStacksAndCrash();
   }
-  CHECK(queue_.Empty());
+  CHECK(GlobalQueuesEmpty());
   quiesced_.store(true, std::memory_order_relaxed);
   grpc_core::MutexLock lock(&lifeguard_ptr_mu_);
   lifeguard_.reset();
@@ -434,10 +572,13 @@ bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   // No new threads are started when forking.
   // No new work is done when forking needs to begin.
   if (pool_->forking_.load()) return false;
+  if (pool_->queue_delay_scaling() && !pool_->IsShutdown()) {
+    return MaybeScaleByQueueDelay();
+  }
   const auto living_thread_count = pool_->living_thread_count()->count();
   // Wake an idle worker thread if there's global work to be had.
   if (pool_->busy_thread_count()->count() < living_thread_count) {
-    if (!pool_->queue_.Empty()) {
+    if (!pool_->GlobalQueuesEmpty()) {
       pool_->work_signal()->Signal();
       backoff_.Reset();
     }
@@ -467,6 +608,45 @@ bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   return true;
 }
 
+bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
+    MaybeScaleByQueueDelay() {
+  QueueDelayScaler::PoolState state;
+  state.queue_delay = pool_->TakeQueueDelay();
+  state.living_threads = pool_->living_thread_count()->count();
+  state.busy_threads = pool_->busy_thread_count()->count();
+  state.reserve_threads = pool_->reserve_threads();
+  state.global_queues_empty = pool_->GlobalQueuesEmpty();
+  switch (pool_->queue_delay_scaler()->Decide(
+      state, grpc_core::Timestamp::Now(),
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+          pool_->last_started_thread_))) {
+    case QueueDelayScaler::Decision::kNone:
+      return false;
+    case QueueDelayScaler::Decision::kWakeIdleThreads:
+      // Idle threads may be sleeping in their backoff while work waits in
+      // queues they could steal from.
+      backoff_.Reset();
+      pool_->work_signal()->SignalAll();
+      return false;
+    case QueueDelayScaler::Decision::kThrottled:
+      backoff_.Reset();
+      return false;
+    case QueueDelayScaler::Decision::kStartThread:
+      backoff_.Reset();
+      GRPC_TRACE_LOG(event_engine, INFO)
+          << "Starting new ThreadPool thread due to queue delay "
+          << (state.queue_delay.has_value() ? state.queue_delay->ToString()
+                                            : "unknown")
+          << " (total threads: " << state.living_threads + 1 << ")";
+      pool_->StartThread();
+      return true;
+    case QueueDelayScaler::Decision::kRetireIdleThread:
+      pool_->work_signal()->Signal();
+      return false;
+  }
+  GPR_UNREACHABLE_CODE(return false);
+}
+
 // -------- WorkStealingThreadPool::ThreadState --------
 
 WorkStealingThreadPool::ThreadState::ThreadState(
@@ -478,7 +658,8 @@ WorkStealingThreadPool::ThreadState::ThreadState(
                    .set_initial_backoff(kWorkerThreadMinSleepBetweenChecks)
                    .set_max_backoff(kWorkerThreadMaxSleepBetweenChecks)
                    .set_multiplier(1.3)),
-      busy_count_idx_(pool_->busy_thread_count()->NextIndex()) {}
+      busy_count_idx_(pool_->busy_thread_count()->NextIndex()),
+      node_(pool_->NextThreadNode()) {}
 
 void WorkStealingThreadPool::ThreadState::ThreadBody() {
   if (g_log_verbose_failures) {
@@ -489,8 +670,13 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
-  g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  if (pool_->topology().num_nodes() > 1 &&
+      !pool_->topology().BindCurrentThreadToNode(node_)) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "Failed to bind thread pool thread to NUMA node " << node_;
+  }
+  g_local_queue = pool_->NewLocalQueue();
+  pool_->theft_registry()->Enroll(g_local_queue, node_);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -502,14 +688,14 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     while (!g_local_queue->Empty()) {
       closure = g_local_queue->PopMostRecent();
       if (closure != nullptr) {
-        pool_->queue()->Add(closure);
+        pool_->queue(node_)->Add(closure);
       }
     }
   } else if (pool_->IsShutdown()) {
     FinishDraining();
   }
   CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  pool_->theft_registry()->Unenroll(g_local_queue, node_);
   delete g_local_queue;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
@@ -538,6 +724,9 @@ bool WorkStealingThreadPool::ThreadState::Step() {
   // * the global queue is empty
   // * the steal pool returns nullptr
   bool should_run_again = false;
+  // Work belonging to other NUMA nodes is only taken after a short back-off,
+  // which gives the threads of that node a chance to pick it up first.
+  bool cross_node = pool_->topology().num_nodes() == 1;
   auto start_time = std::chrono::steady_clock::now();
   // Wait until work is available or until shut down.
   while (!pool_->IsForking()) {
@@ -545,13 +734,13 @@ bool WorkStealingThreadPool::ThreadState::Step() {
     // TODO(hork): consider an empty check for performance wins. Depends on the
     // queue implementation, the BasicWorkQueue takes two locks when you do an
     // empty check then pop.
-    closure = pool_->queue()->PopMostRecent();
+    closure = pool_->PopGlobal(node_, cross_node);
     if (closure != nullptr) {
       should_run_again = true;
       break;
     };
     // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    closure = pool_->theft_registry()->StealOne(node_, cross_node);
     if (closure != nullptr) {
       should_run_again = true;
       break;
@@ -559,9 +748,17 @@ bool WorkStealingThreadPool::ThreadState::Step() {
     // No closures were retrieved from anywhere.
     // Quit the thread if the pool has been shut down.
     if (pool_->IsShutdown()) break;
+    if (!cross_node) {
+      pool_->work_signal()->WaitWithTimeout(kCrossNodeStealDelay);
+      cross_node = true;
+      continue;
+    }
     bool timed_out =
         pool_->work_signal()->WaitWithTimeout(backoff_.NextAttemptDelay());
     if (pool_->IsForking() || pool_->IsShutdown()) break;
+    if (pool_->queue_delay_scaling() && pool_->ShouldRetireIdleThread()) {
+      return false;
+    }
     // Quit a thread if the pool has more than it requires, and this thread
     // has been idle long enough.
     if (timed_out &&
@@ -598,11 +795,9 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
       }
       continue;
     }
-    if (!pool_->queue()->Empty()) {
-      auto* closure = pool_->queue()->PopMostRecent();
-      if (closure != nullptr) {
-        closure->Run();
-      }
+    auto* closure = pool_->PopGlobal(node_, /*cross_node=*/true);
+    if (closure != nullptr) {
+      closure->Run();
       continue;
     }
     break;
@@ -25,11 +25,15 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
@@ -41,6 +45,55 @@
 
 namespace grpc_event_engine::experimental {
 
+// Decides how a WorkStealingThreadPool that is scaled by queue delay grows and
+// shrinks. It takes the pool's state and the time as arguments, so that the
+// decisions can be tested without threads or a real clock.
+class QueueDelayScaler {
+ public:
+  enum class Decision {
+    // Closures are queued about as long as the target.
+    kNone,
+    // Closures wait too long, and there are idle threads to take them.
+    kWakeIdleThreads,
+    // Closures wait too long, and every thread is busy.
+    kStartThread,
+    // As kStartThread, but a thread was started too recently.
+    kThrottled,
+    // Closures wait much less than the target, so an idle thread may exit.
+    kRetireIdleThread,
+  };
+
+  struct PoolState {
+    // The mean delay of the closures sampled since the last decision, if any.
+    std::optional<grpc_core::Duration> queue_delay;
+    size_t living_threads = 0;
+    size_t busy_threads = 0;
+    size_t reserve_threads = 0;
+    bool global_queues_empty = true;
+  };
+
+  explicit QueueDelayScaler(grpc_core::Duration target_queue_delay)
+      : target_queue_delay_(target_queue_delay) {}
+
+  // Decides what to do at time now, given that the pool last started a thread
+  // at last_thread_start. A retirement requested by an earlier decision that
+  // no idle thread has taken yet is withdrawn by any other decision.
+  Decision Decide(const PoolState& state, grpc_core::Timestamp now,
+                  grpc_core::Timestamp last_thread_start);
+  // Returns true, once, if an idle thread should exit.
+  bool TakeRetirement() {
+    return retire_idle_thread_.exchange(false, std::memory_order_relaxed);
+  }
+
+  grpc_core::Duration target_queue_delay() const {
+    return target_queue_delay_;
+  }
+
+ private:
+  const grpc_core::Duration target_queue_delay_;
+  std::atomic<bool> retire_idle_thread_{false};
+};
+
 class WorkStealingThreadPool final : public ThreadPool {
  public:
   explicit WorkStealingThreadPool(size_t reserve_threads);
@@ -78,20 +131,28 @@ class WorkStealingThreadPool final : public ThreadPool {
   //
   // Every worker thread registers and unregisters its thread-local thread pool
   // here, and steals closures from other threads when work is otherwise
-  // unavailable.
+  // unavailable. Queues are grouped by the NUMA node of their thread.
   class TheftRegistry {
    public:
+    // If steal_oldest is true, closures are stolen from the front of other
+    // threads' queues, as lock-free queues only allow their owner to pop the
+    // most recent closure.
+    TheftRegistry(size_t num_nodes, bool steal_oldest)
+        : steal_oldest_(steal_oldest), queues_(num_nodes) {}
     // Allow any member of the registry to steal from the provided queue.
-    void Enroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Enroll(WorkQueue* queue, size_t node) ABSL_LOCKS_EXCLUDED(mu_);
     // Disallow work stealing from the provided queue.
-    void Unenroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Unenroll(WorkQueue* queue, size_t node) ABSL_LOCKS_EXCLUDED(mu_);
     // Returns one closure from another thread, or nullptr if none are
-    // available.
-    EventEngine::Closure* StealOne() ABSL_LOCKS_EXCLUDED(mu_);
+    // available. Threads of the given node are tried first, and those of other
+    // nodes only if cross_node is true.
+    EventEngine::Closure* StealOne(size_t node, bool cross_node)
+        ABSL_LOCKS_EXCLUDED(mu_);
 
    private:
+    const bool steal_oldest_;
     grpc_core::Mutex mu_;
-    absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+    std::vector<absl::flat_hash_set<WorkQueue*>> queues_ ABSL_GUARDED_BY(mu_);
   };
 
   // An implementation of the ThreadPool
@@ -105,8 +166,22 @@ class WorkStealingThreadPool final : public ThreadPool {
     // Start all threads.
     void Start();
     // Add a closure to a work queue, preferably a thread-local queue if
-    // available, otherwise the global queue.
+    // available, otherwise the global queue of the caller's NUMA node.
     void Run(EventEngine::Closure* closure);
+    // Pops a closure from the global queue of node, or if there is none and
+    // cross_node is true, from the global queue of another node.
+    EventEngine::Closure* PopGlobal(size_t node, bool cross_node);
+    // Returns the node the next worker thread is assigned to.
+    size_t NextThreadNode();
+    // Creates the thread-local queue of a new worker thread.
+    WorkQueue* NewLocalQueue();
+    // Records the time a sampled closure spent queued before it ran.
+    void RecordQueueDelay(std::chrono::steady_clock::duration delay);
+    // Returns the mean queueing delay of the closures sampled since the last
+    // call, or nullopt if none were.
+    std::optional<grpc_core::Duration> TakeQueueDelay();
+    // Returns true if the calling idle worker thread should exit.
+    bool ShouldRetireIdleThread();
     // Start a new thread.
     // The reason argument determines whether thread creation is rate-limited;
     // threads created to populate the initial pool are not rate-limited, but
@@ -140,7 +215,10 @@ class WorkStealingThreadPool final : public ThreadPool {
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
     TheftRegistry* theft_registry() { return &theft_registry_; }
-    WorkQueue* queue() { return &queue_; }
+    const NumaTopology& topology() { return topology_; }
+    bool queue_delay_scaling() const { return queue_delay_scaling_; }
+    QueueDelayScaler* queue_delay_scaler() { return &queue_delay_scaler_; }
+    WorkQueue* queue(size_t node) { return queues_[node].get(); }
     WorkSignal* work_signal() { return &work_signal_; }
 
    private:
@@ -160,6 +238,10 @@ class WorkStealingThreadPool final : public ThreadPool {
       // Starts a new thread if the pool is backlogged
       // Return true if a new thread was started.
       bool MaybeStartNewThread();
+      // Starts a new thread if closures wait longer than the target queue
+      // delay, and retires an idle one if they wait much less.
+      // Return true if a new thread was started.
+      bool MaybeScaleByQueueDelay();
 
       WorkStealingThreadPoolImpl* pool_;
       grpc_core::BackOff backoff_;
@@ -170,12 +252,24 @@ class WorkStealingThreadPool final : public ThreadPool {
     };
 
     void DumpStacksAndCrash();
+    bool GlobalQueuesEmpty();
 
     const size_t reserve_threads_;
+    // Whether worker threads use lock-free ChaseLevWorkQueues.
+    const bool chase_lev_queues_;
+    // A single node unless the NUMA aware experiment is enabled.
+    const NumaTopology topology_;
+    // Whether the pool is scaled by queue delay rather than busy threads.
+    const bool queue_delay_scaling_;
+    QueueDelayScaler queue_delay_scaler_;
+    std::atomic<uint64_t> queue_delay_sum_us_{0};
+    std::atomic<uint64_t> queue_delay_samples_{0};
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
     TheftRegistry theft_registry_;
-    BasicWorkQueue queue_;
+    // One global queue per NUMA node.
+    std::vector<std::unique_ptr<BasicWorkQueue>> queues_;
+    std::atomic<size_t> next_thread_node_{0};
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
@@ -215,6 +309,8 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    // The NUMA node this thread runs on.
+    const size_t node_;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
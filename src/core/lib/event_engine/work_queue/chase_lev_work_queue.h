@@ -0,0 +1,100 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/work_queue/work_queue.h"
+
+namespace grpc_event_engine::experimental {
+
+// A lock-free work stealing deque, as described in "Dynamic Circular
+// Work-Stealing Deque" (Chase & Lev, 2005), using the C11 memory orderings
+// from "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et
+// al., 2013).
+//
+// Unlike other WorkQueue implementations, this queue has a single owner
+// thread: only the owner may call Add and PopMostRecent. Any thread may call
+// PopOldest, Empty, and Size. PopOldest returns nullptr when it loses a race
+// with the owner or another thief, even if the queue is not empty.
+//
+// Implementation note: bottom_ is where the owner adds and pops closures, top_
+// is where other threads steal them. The buffer grows as needed and never
+// shrinks; buffers that were replaced are kept alive until the queue is
+// destroyed, since a thief may still be reading from them.
+class ChaseLevWorkQueue : public WorkQueue {
+ public:
+  ChaseLevWorkQueue() : ChaseLevWorkQueue(nullptr) {}
+  explicit ChaseLevWorkQueue(void* owner);
+  ~ChaseLevWorkQueue() override;
+  // Returns whether the queue is empty.
+  bool Empty() const override;
+  // Returns the size of the queue. This is a snapshot that may be stale by the
+  // time it is returned.
+  size_t Size() const override;
+  // Returns the most recently added closure, or nullptr if the queue is empty.
+  // Must only be called by the owner thread.
+  EventEngine::Closure* PopMostRecent() override;
+  // Steals the oldest closure from the queue, or returns nullptr if either the
+  // queue is empty or another thread won the race for that closure.
+  EventEngine::Closure* PopOldest() override;
+  // Adds a closure to the queue. Must only be called by the owner thread.
+  void Add(EventEngine::Closure* closure) override;
+  // Wraps an AnyInvocable and adds it to the the queue. Must only be called by
+  // the owner thread.
+  void Add(absl::AnyInvocable<void()> invocable) override;
+  const void* owner() override { return owner_; }
+
+ private:
+  // A circular buffer whose capacity is a power of two.
+  class Buffer {
+   public:
+    explicit Buffer(size_t capacity);
+
+    size_t capacity() const { return mask_ + 1; }
+    EventEngine::Closure* Get(int64_t i) const {
+      return slots_[i & mask_].load(std::memory_order_relaxed);
+    }
+    void Put(int64_t i, EventEngine::Closure* closure) {
+      slots_[i & mask_].store(closure, std::memory_order_relaxed);
+    }
+    // Returns a buffer twice as large, holding the closures in [top, bottom).
+    std::unique_ptr<Buffer> Grow(int64_t top, int64_t bottom) const;
+
+   private:
+    const size_t mask_;
+    std::unique_ptr<std::atomic<EventEngine::Closure*>[]> slots_;
+  };
+
+  // Owner and thieves write to separate cache lines.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> top_{0};
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> bottom_{0};
+  std::atomic<Buffer*> buffer_;
+  // All buffers ever used by this queue, including the current one. Only
+  // accessed by the owner thread.
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+  const void* const owner_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
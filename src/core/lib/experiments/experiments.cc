@@ -38,6 +38,12 @@ const char* const additional_constraints_chttp2_bound_write_size = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
+const char* const description_event_engine_chase_lev_work_queue =
+    "Use lock-free Chase-Lev deques for the thread local queues of the work "
+    "stealing thread pool. Thieves take the oldest closure of a queue instead "
+    "of the most recent one.";
+const char* const additional_constraints_event_engine_chase_lev_work_queue =
+    "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -73,12 +79,41 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
     static_cast<uint8_t>(
         grpc_core::kExperimentIdEventEngineDnsNonClientChannel),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_event_engine_numa_aware_thread_pool =
+    "Keep per NUMA node queues in the work stealing thread pool, pin its "
+    "workers to the CPUs of one node, and only steal work from other nodes "
+    "after failing to find any on the local node.";
+const char* const additional_constraints_event_engine_numa_aware_thread_pool =
+    "{}";
+const char* const description_event_engine_queue_delay_scaling =
+    "Scale the number of EventEngine thread pool threads by the sampled time "
+    "closures wait in its queues, aiming for "
+    "GRPC_EVENT_ENGINE_THREAD_POOL_TARGET_QUEUE_DELAY_MS, instead of by the "
+    "number of busy threads.";
+const char* const additional_constraints_event_engine_queue_delay_scaling =
+    "{}";
 const char* const description_event_engine_secure_endpoint =
     "Use EventEngine secure endpoint wrapper instead of iomgr when available";
 const char* const additional_constraints_event_engine_secure_endpoint = "{}";
+const char* const description_event_engine_timing_wheel =
+    "Use a hierarchical timing wheel instead of the sharded heap to track "
+    "timers in the posix EventEngine, for O(1) timer insertion and "
+    "cancellation.";
+const char* const additional_constraints_event_engine_timing_wheel = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_hpack_index_unknown_metadata =
+    "Track how often the HPACK encoder sends each key/value pair of metadata "
+    "that has no compression traits, and add pairs that repeat on a connection "
+    "to the HPACK dynamic table.";
+const char* const additional_constraints_hpack_index_unknown_metadata = "{}";
+const char* const description_hpack_intern_dynamic_table_values =
+    "Share the parsed values of HPACK dynamic table entries between "
+    "connections through a process wide cache, instead of giving every table "
+    "entry its own copy.";
+const char* const additional_constraints_hpack_intern_dynamic_table_values =
+    "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -101,6 +136,12 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_offload_large_decompression =
+    "Decompress received messages of at least "
+    "GRPC_ARG_DECOMPRESSION_OFFLOAD_THRESHOLD bytes on the EventEngine thread "
+    "pool instead of inline, so they do not hold up the other calls sharing "
+    "the thread.";
+const char* const additional_constraints_offload_large_decompression = "{}";
 const char* const description_pollset_alternative =
     "Code outside iomgr that relies directly on pollsets will use non-pollset "
     "alternatives when enabled.";
@@ -165,6 +206,10 @@ const char* const additional_constraints_server_global_callbacks_ownership =
 const char* const description_shard_global_connection_pool =
     "If set, shard the global connection pool to improve parallelism.";
 const char* const additional_constraints_shard_global_connection_pool = "{}";
+const char* const description_slab_slice_allocator =
+    "Allocate the memory of refcounted slices and read buffers up to 64KB from "
+    "size classed slabs with per-CPU caches, instead of malloc.";
+const char* const additional_constraints_slab_slice_allocator = "{}";
 const char* const description_sleep_promise_exec_ctx_removal =
     "If set, polling the sleep promise does not rely on the ExecCtx.";
 const char* const additional_constraints_sleep_promise_exec_ctx_removal = "{}";
@@ -201,6 +246,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
+    {"event_engine_chase_lev_work_queue",
+     description_event_engine_chase_lev_work_queue,
+     additional_constraints_event_engine_chase_lev_work_queue, nullptr, 0,
+     false, true},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, true, false},
     {"event_engine_dns", description_event_engine_dns,
@@ -220,11 +269,28 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_for_all_other_endpoints,
      additional_constraints_event_engine_for_all_other_endpoints,
      required_experiments_event_engine_for_all_other_endpoints, 4, true, false},
+    {"event_engine_numa_aware_thread_pool",
+     description_event_engine_numa_aware_thread_pool,
+     additional_constraints_event_engine_numa_aware_thread_pool, nullptr, 0,
+     false, true},
+    {"event_engine_queue_delay_scaling",
+     description_event_engine_queue_delay_scaling,
+     additional_constraints_event_engine_queue_delay_scaling, nullptr, 0, false,
+     true},
     {"event_engine_secure_endpoint", description_event_engine_secure_endpoint,
      additional_constraints_event_engine_secure_endpoint, nullptr, 0, true,
      false},
+    {"event_engine_timing_wheel", description_event_engine_timing_wheel,
+     additional_constraints_event_engine_timing_wheel, nullptr, 0, false, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"hpack_index_unknown_metadata", description_hpack_index_unknown_metadata,
+     additional_constraints_hpack_index_unknown_metadata, nullptr, 0, false,
+     true},
+    {"hpack_intern_dynamic_table_values",
+     description_hpack_intern_dynamic_table_values,
+     additional_constraints_hpack_intern_dynamic_table_values, nullptr, 0,
+     false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -240,6 +306,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"offload_large_decompression", description_offload_large_decompression,
+     additional_constraints_offload_large_decompression, nullptr, 0, false,
+     true},
     {"pollset_alternative", description_pollset_alternative,
      additional_constraints_pollset_alternative,
      required_experiments_pollset_alternative, 2, false, false},
@@ -282,6 +351,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"shard_global_connection_pool", description_shard_global_connection_pool,
      additional_constraints_shard_global_connection_pool, nullptr, 0, true,
      true},
+    {"slab_slice_allocator", description_slab_slice_allocator,
+     additional_constraints_slab_slice_allocator, nullptr, 0, false, true},
     {"sleep_promise_exec_ctx_removal",
      description_sleep_promise_exec_ctx_removal,
      additional_constraints_sleep_promise_exec_ctx_removal, nullptr, 0, false,
@@ -319,6 +390,12 @@ const char* const additional_constraints_chttp2_bound_write_size = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
+const char* const description_event_engine_chase_lev_work_queue =
+    "Use lock-free Chase-Lev deques for the thread local queues of the work "
+    "stealing thread pool. Thieves take the oldest closure of a queue instead "
+    "of the most recent one.";
+const char* const additional_constraints_event_engine_chase_lev_work_queue =
+    "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -354,12 +431,41 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
     static_cast<uint8_t>(
         grpc_core::kExperimentIdEventEngineDnsNonClientChannel),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_event_engine_numa_aware_thread_pool =
+    "Keep per NUMA node queues in the work stealing thread pool, pin its "
+    "workers to the CPUs of one node, and only steal work from other nodes "
+    "after failing to find any on the local node.";
+const char* const additional_constraints_event_engine_numa_aware_thread_pool =
+    "{}";
+const char* const description_event_engine_queue_delay_scaling =
+    "Scale the number of EventEngine thread pool threads by the sampled time "
+    "closures wait in its queues, aiming for "
+    "GRPC_EVENT_ENGINE_THREAD_POOL_TARGET_QUEUE_DELAY_MS, instead of by the "
+    "number of busy threads.";
+const char* const additional_constraints_event_engine_queue_delay_scaling =
+    "{}";
 const char* const description_event_engine_secure_endpoint =
     "Use EventEngine secure endpoint wrapper instead of iomgr when available";
 const char* const additional_constraints_event_engine_secure_endpoint = "{}";
+const char* const description_event_engine_timing_wheel =
+    "Use a hierarchical timing wheel instead of the sharded heap to track "
+    "timers in the posix EventEngine, for O(1) timer insertion and "
+    "cancellation.";
+const char* const additional_constraints_event_engine_timing_wheel = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_hpack_index_unknown_metadata =
+    "Track how often the HPACK encoder sends each key/value pair of metadata "
+    "that has no compression traits, and add pairs that repeat on a connection "
+    "to the HPACK dynamic table.";
+const char* const additional_constraints_hpack_index_unknown_metadata = "{}";
+const char* const description_hpack_intern_dynamic_table_values =
+    "Share the parsed values of HPACK dynamic table entries between "
+    "connections through a process wide cache, instead of giving every table "
+    "entry its own copy.";
+const char* const additional_constraints_hpack_intern_dynamic_table_values =
+    "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -382,6 +488,12 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_offload_large_decompression =
+    "Decompress received messages of at least "
+    "GRPC_ARG_DECOMPRESSION_OFFLOAD_THRESHOLD bytes on the EventEngine thread "
+    "pool instead of inline, so they do not hold up the other calls sharing "
+    "the thread.";
+const char* const additional_constraints_offload_large_decompression = "{}";
 const char* const description_pollset_alternative =
     "Code outside iomgr that relies directly on pollsets will use non-pollset "
     "alternatives when enabled.";
@@ -446,6 +558,10 @@ const char* const additional_constraints_server_global_callbacks_ownership =
 const char* const description_shard_global_connection_pool =
     "If set, shard the global connection pool to improve parallelism.";
 const char* const additional_constraints_shard_global_connection_pool = "{}";
+const char* const description_slab_slice_allocator =
+    "Allocate the memory of refcounted slices and read buffers up to 64KB from "
+    "size classed slabs with per-CPU caches, instead of malloc.";
+const char* const additional_constraints_slab_slice_allocator = "{}";
 const char* const description_sleep_promise_exec_ctx_removal =
     "If set, polling the sleep promise does not rely on the ExecCtx.";
 const char* const additional_constraints_sleep_promise_exec_ctx_removal = "{}";
@@ -482,6 +598,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
+    {"event_engine_chase_lev_work_queue",
+     description_event_engine_chase_lev_work_queue,
+     additional_constraints_event_engine_chase_lev_work_queue, nullptr, 0,
+     false, true},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, true, false},
     {"event_engine_dns", description_event_engine_dns,
@@ -501,11 +621,28 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_for_all_other_endpoints,
      additional_constraints_event_engine_for_all_other_endpoints,
      required_experiments_event_engine_for_all_other_endpoints, 4, true, false},
+    {"event_engine_numa_aware_thread_pool",
+     description_event_engine_numa_aware_thread_pool,
+     additional_constraints_event_engine_numa_aware_thread_pool, nullptr, 0,
+     false, true},
+    {"event_engine_queue_delay_scaling",
+     description_event_engine_queue_delay_scaling,
+     additional_constraints_event_engine_queue_delay_scaling, nullptr, 0, false,
+     true},
     {"event_engine_secure_endpoint", description_event_engine_secure_endpoint,
      additional_constraints_event_engine_secure_endpoint, nullptr, 0, true,
      false},
+    {"event_engine_timing_wheel", description_event_engine_timing_wheel,
+     additional_constraints_event_engine_timing_wheel, nullptr, 0, false, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"hpack_index_unknown_metadata", description_hpack_index_unknown_metadata,
+     additional_constraints_hpack_index_unknown_metadata, nullptr, 0, false,
+     true},
+    {"hpack_intern_dynamic_table_values",
+     description_hpack_intern_dynamic_table_values,
+     additional_constraints_hpack_intern_dynamic_table_values, nullptr, 0,
+     false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -521,6 +658,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"offload_large_decompression", description_offload_large_decompression,
+     additional_constraints_offload_large_decompression, nullptr, 0, false,
+     true},
     {"pollset_alternative", description_pollset_alternative,
      additional_constraints_pollset_alternative,
      required_experiments_pollset_alternative, 2, false, false},
@@ -563,6 +703,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"shard_global_connection_pool", description_shard_global_connection_pool,
      additional_constraints_shard_global_connection_pool, nullptr, 0, true,
      true},
+    {"slab_slice_allocator", description_slab_slice_allocator,
+     additional_constraints_slab_slice_allocator, nullptr, 0, false, true},
     {"sleep_promise_exec_ctx_removal",
      description_sleep_promise_exec_ctx_removal,
      additional_constraints_sleep_promise_exec_ctx_removal, nullptr, 0, false,
@@ -600,6 +742,12 @@ const char* const additional_constraints_chttp2_bound_write_size = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
+const char* const description_event_engine_chase_lev_work_queue =
+    "Use lock-free Chase-Lev deques for the thread local queues of the work "
+    "stealing thread pool. Thieves take the oldest closure of a queue instead "
+    "of the most recent one.";
+const char* const additional_constraints_event_engine_chase_lev_work_queue =
+    "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -635,12 +783,41 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
     static_cast<uint8_t>(
         grpc_core::kExperimentIdEventEngineDnsNonClientChannel),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_event_engine_numa_aware_thread_pool =
+    "Keep per NUMA node queues in the work stealing thread pool, pin its "
+    "workers to the CPUs of one node, and only steal work from other nodes "
+    "after failing to find any on the local node.";
+const char* const additional_constraints_event_engine_numa_aware_thread_pool =
+    "{}";
+const char* const description_event_engine_queue_delay_scaling =
+    "Scale the number of EventEngine thread pool threads by the sampled time "
+    "closures wait in its queues, aiming for "
+    "GRPC_EVENT_ENGINE_THREAD_POOL_TARGET_QUEUE_DELAY_MS, instead of by the "
+    "number of busy threads.";
+const char* const additional_constraints_event_engine_queue_delay_scaling =
+    "{}";
 const char* const description_event_engine_secure_endpoint =
     "Use EventEngine secure endpoint wrapper instead of iomgr when available";
 const char* const additional_constraints_event_engine_secure_endpoint = "{}";
+const char* const description_event_engine_timing_wheel =
+    "Use a hierarchical timing wheel instead of the sharded heap to track "
+    "timers in the posix EventEngine, for O(1) timer insertion and "
+    "cancellation.";
+const char* const additional_constraints_event_engine_timing_wheel = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_hpack_index_unknown_metadata =
+    "Track how often the HPACK encoder sends each key/value pair of metadata "
+    "that has no compression traits, and add pairs that repeat on a connection "
+    "to the HPACK dynamic table.";
+const char* const additional_constraints_hpack_index_unknown_metadata = "{}";
+const char* const description_hpack_intern_dynamic_table_values =
+    "Share the parsed values of HPACK dynamic table entries between "
+    "connections through a process wide cache, instead of giving every table "
+    "entry its own copy.";
+const char* const additional_constraints_hpack_intern_dynamic_table_values =
+    "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -663,6 +840,12 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_offload_large_decompression =
+    "Decompress received messages of at least "
+    "GRPC_ARG_DECOMPRESSION_OFFLOAD_THRESHOLD bytes on the EventEngine thread "
+    "pool instead of inline, so they do not hold up the other calls sharing "
+    "the thread.";
+const char* const additional_constraints_offload_large_decompression = "{}";
 const char* const description_pollset_alternative =
     "Code outside iomgr that relies directly on pollsets will use non-pollset "
     "alternatives when enabled.";
@@ -727,6 +910,10 @@ const char* const additional_constraints_server_global_callbacks_ownership =
 const char* const description_shard_global_connection_pool =
     "If set, shard the global connection pool to improve parallelism.";
 const char* const additional_constraints_shard_global_connection_pool = "{}";
+const char* const description_slab_slice_allocator =
+    "Allocate the memory of refcounted slices and read buffers up to 64KB from "
+    "size classed slabs with per-CPU caches, instead of malloc.";
+const char* const additional_constraints_slab_slice_allocator = "{}";
 const char* const description_sleep_promise_exec_ctx_removal =
     "If set, polling the sleep promise does not rely on the ExecCtx.";
 const char* const additional_constraints_sleep_promise_exec_ctx_removal = "{}";
@@ -763,6 +950,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
+    {"event_engine_chase_lev_work_queue",
+     description_event_engine_chase_lev_work_queue,
+     additional_constraints_event_engine_chase_lev_work_queue, nullptr, 0,
+     false, true},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, true, false},
     {"event_engine_dns", description_event_engine_dns,
@@ -782,11 +973,28 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_for_all_other_endpoints,
      additional_constraints_event_engine_for_all_other_endpoints,
      required_experiments_event_engine_for_all_other_endpoints, 4, true, false},
+    {"event_engine_numa_aware_thread_pool",
+     description_event_engine_numa_aware_thread_pool,
+     additional_constraints_event_engine_numa_aware_thread_pool, nullptr, 0,
+     false, true},
+    {"event_engine_queue_delay_scaling",
+     description_event_engine_queue_delay_scaling,
+     additional_constraints_event_engine_queue_delay_scaling, nullptr, 0, false,
+     true},
     {"event_engine_secure_endpoint", description_event_engine_secure_endpoint,
      additional_constraints_event_engine_secure_endpoint, nullptr, 0, true,
      false},
+    {"event_engine_timing_wheel", description_event_engine_timing_wheel,
+     additional_constraints_event_engine_timing_wheel, nullptr, 0, false, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"hpack_index_unknown_metadata", description_hpack_index_unknown_metadata,
+     additional_constraints_hpack_index_unknown_metadata, nullptr, 0, false,
+     true},
+    {"hpack_intern_dynamic_table_values",
+     description_hpack_intern_dynamic_table_values,
+     additional_constraints_hpack_intern_dynamic_table_values, nullptr, 0,
+     false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -802,6 +1010,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"offload_large_decompression", description_offload_large_decompression,
+     additional_constraints_offload_large_decompression, nullptr, 0, false,
+     true},
     {"pollset_alternative", description_pollset_alternative,
      additional_constraints_pollset_alternative,
      required_experiments_pollset_alternative, 2, false, false},
@@ -844,6 +1055,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"shard_global_connection_pool", description_shard_global_connection_pool,
      additional_constraints_shard_global_connection_pool, nullptr, 0, true,
      true},
+    {"slab_slice_allocator", description_slab_slice_allocator,
+     additional_constraints_slab_slice_allocator, nullptr, 0, false, true},
     {"sleep_promise_exec_ctx_removal",
      description_sleep_promise_exec_ctx_removal,
      additional_constraints_sleep_promise_exec_ctx_removal, nullptr, 0, false,
@@ -59,6 +59,9 @@
 // Linux has TCP_INQ support since 4.18, but it is safe to set
 // the socket option on older kernels.
 #define GRPC_HAVE_TCP_INQ 1
+// Linux has TCP_ZEROCOPY_RECEIVE support since 4.18. On older kernels the
+// socket option fails and reads fall back to copying.
+#define GRPC_HAVE_TCP_ZEROCOPY_RECEIVE 1
 #ifdef LINUX_VERSION_CODE
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
@@ -93,6 +96,11 @@
 #define GRPC_LINUX_TCP_H 1
 #endif  // __GLIBC_PREREQ(2, 17)
 #endif
+#ifdef __has_include
+#if __has_include(<linux/io_uring.h>)
+#define GRPC_LINUX_IO_URING 1
+#endif
+#endif
 #ifndef __GLIBC__
 #define GRPC_LINUX_EPOLL 1
 #define GRPC_LINUX_EPOLL_CREATE1 1
@@ -33,11 +33,13 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/seq.h"
+#include "src/core/lib/slice/slab_allocator.h"
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/util/mpscq.h"
 #include "src/core/util/useful.h"
@@ -106,8 +108,8 @@ class SliceRefCount : public grpc_slice_refcount {
       std::shared_ptr<
           grpc_event_engine::experimental::internal::MemoryAllocatorImpl>
           allocator,
-      size_t size)
-      : grpc_slice_refcount(Destroy),
+      size_t size, bool slab = false)
+      : grpc_slice_refcount(slab ? DestroySlab : Destroy),
         allocator_(std::move(allocator)),
         size_(size) {
     // Nothing to do here.
@@ -123,6 +125,11 @@ class SliceRefCount : public grpc_slice_refcount {
     rc->~SliceRefCount();
     free(rc);
   }
+  static void DestroySlab(grpc_slice_refcount* p) {
+    auto* rc = static_cast<SliceRefCount*>(p);
+    rc->~SliceRefCount();
+    SlabAllocator::Get().Free(rc);
+  }
 
   std::shared_ptr<
       grpc_event_engine::experimental::internal::MemoryAllocatorImpl>
@@ -130,6 +137,8 @@ class SliceRefCount : public grpc_slice_refcount {
   size_t size_;
 };
 
+static_assert(sizeof(SliceRefCount) <= SlabAllocator::kHeaderSize);
+
 std::atomic<double> container_memory_pressure{0.0};
 
 }  // namespace
@@ -396,6 +405,28 @@ void GrpcMemoryAllocatorImpl::Replenish() {
 }
 
 grpc_slice GrpcMemoryAllocatorImpl::MakeSlice(MemoryRequest request) {
+  if (IsSlabSliceAllocatorEnabled() &&
+      request.max() <= SlabAllocator::MaxPayloadSize()) {
+    const size_t length =
+        Reserve(request.Increase(SlabAllocator::kHeaderSize)) -
+        SlabAllocator::kHeaderSize;
+    size_t capacity;
+    void* block = SlabAllocator::Get().Allocate(length, &capacity);
+    if (block != nullptr) {
+      // Account for the whole block: the payload is rounded up to the size
+      // class.
+      if (capacity > length) Reserve(MemoryRequest(capacity - length));
+      const size_t size = SlabAllocator::kHeaderSize + capacity;
+      new (block) SliceRefCount(shared_from_this(), size, /*slab=*/true);
+      grpc_slice slice;
+      slice.refcount = static_cast<SliceRefCount*>(block);
+      slice.data.refcounted.bytes =
+          static_cast<uint8_t*>(block) + SlabAllocator::kHeaderSize;
+      slice.data.refcounted.length = length;
+      return slice;
+    }
+    Release(length + SlabAllocator::kHeaderSize);
+  }
   auto size = Reserve(request.Increase(sizeof(SliceRefCount)));
   void* p = malloc(size);
   new (p) SliceRefCount(shared_from_this(), size);
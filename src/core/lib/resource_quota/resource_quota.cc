@@ -14,10 +14,81 @@
 
 #include "src/core/lib/resource_quota/resource_quota.h"
 
+#include <grpc/event_engine/memory_request.h>
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+#include <atomic>
+#include <optional>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slab_allocator.h"
+#include "src/core/util/sync.h"
+
 namespace grpc_core {
 
+namespace {
+
+// The slab allocator's slabs are shared by the whole process. Charges the
+// default quota for the slab memory that is mapped but not handed out, and
+// unmaps what it can of it when the quota runs short.
+class SlabAllocatorCharge {
+ public:
+  explicit SlabAllocatorCharge(MemoryQuota* quota)
+      : memory_owner_(quota->CreateMemoryOwner()) {}
+
+  static void Start(MemoryQuota* quota) {
+    instance_ = new SlabAllocatorCharge(quota);
+    SlabAllocator::Get().SetIdleMemoryCallback([]() { instance_->Update(); });
+  }
+
+ private:
+  // Called without the slab allocator's locks held, as changing the charge
+  // may run the quota's reclaimers.
+  void Update() {
+    EnsureRunInExecCtx([this]() {
+      MutexLock lock(&mu_);
+      const SlabAllocator::IdleMemory idle =
+          SlabAllocator::Get().GetIdleMemory();
+      const size_t idle_bytes = std::min(
+          idle.bytes, grpc_event_engine::experimental::MemoryRequest::
+                          max_allowed_size());
+      if (idle_bytes > charged_bytes_) {
+        memory_owner_.Reserve(grpc_event_engine::experimental::MemoryRequest(
+            idle_bytes - charged_bytes_));
+      } else if (idle_bytes < charged_bytes_) {
+        memory_owner_.Release(charged_bytes_ - idle_bytes);
+      }
+      charged_bytes_ = idle_bytes;
+      // Only empty slabs are sure to give memory back.
+      if (idle.empty_slabs > 0) MaybePostReclaimer();
+    });
+  }
+
+  void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (reclaimer_posted_.exchange(true, std::memory_order_relaxed)) return;
+    memory_owner_.PostReclaimer(
+        ReclamationPass::kBenign,
+        [this](std::optional<ReclamationSweep> sweep) {
+          reclaimer_posted_.store(false, std::memory_order_relaxed);
+          if (sweep.has_value()) SlabAllocator::Get().ReleaseFreeMemory();
+        });
+  }
+
+  static SlabAllocatorCharge* instance_;
+
+  Mutex mu_;
+  MemoryOwner memory_owner_ ABSL_GUARDED_BY(mu_);
+  size_t charged_bytes_ ABSL_GUARDED_BY(mu_) = 0;
+  std::atomic<bool> reclaimer_posted_{false};
+};
+
+SlabAllocatorCharge* SlabAllocatorCharge::instance_ = nullptr;
+
+}  // namespace
+
 ResourceQuota::ResourceQuota(std::string name)
     : memory_quota_(MakeMemoryQuota(std::move(name))),
       thread_quota_(MakeRefCounted<ThreadQuota>()) {}
@@ -25,8 +96,13 @@ ResourceQuota::ResourceQuota(std::string name)
 ResourceQuota::~ResourceQuota() = default;
 
 ResourceQuotaRefPtr ResourceQuota::Default() {
-  static auto default_resource_quota =
-      MakeResourceQuota("default_resource_quota").release();
+  static auto default_resource_quota = []() {
+    auto* quota = MakeResourceQuota("default_resource_quota").release();
+    if (IsSlabSliceAllocatorEnabled()) {
+      SlabAllocatorCharge::Start(quota->memory_quota().get());
+    }
+    return quota;
+  }();
   return default_resource_quota->Ref();
 }
 
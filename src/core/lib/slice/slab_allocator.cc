@@ -0,0 +1,505 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/slice/slab_allocator.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <new>
+
+#include "absl/log/log.h"
+#include "absl/strings/string_view.h"
+#include "src/core/config/config_vars.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/no_destruct.h"
+
+#ifdef GPR_LINUX
+#include <sys/mman.h>
+#endif
+
+namespace grpc_core {
+
+namespace {
+
+// Payload sizes of the size classes: powers of two, so that the usual read
+// buffer (8KB, 64KB) and frame (16KB) sizes fit exactly, with a class half
+// way between each from 256 bytes on to bound the waste at a third.
+constexpr size_t kPayloadSizes[] = {
+    64,   128,  256,   384,   512,   768,   1024,  1536,  2048, 3072,
+    4096, 6144, 8192, 12288, 16384, 24576, 32768, 49152, 65536};
+constexpr size_t kNumSizeClasses = std::size(kPayloadSizes);
+
+// Blocks a shard caches per size class, at most.
+constexpr size_t kMaxCachedBlocks = 32;
+// Bytes a shard caches per size class, at most.
+constexpr size_t kMaxCachedBytes = 256 * 1024;
+
+// Empty slabs kept for any size class to take over, rather than unmapped.
+constexpr size_t kMaxEmptySlabs = 2;
+
+// Changes to the idle memory smaller than this are not reported.
+constexpr size_t kIdleMemoryReportBytes = SlabAllocator::kSlabSize / 4;
+
+// The slab header takes a cache line, so that payloads stay 16 byte aligned.
+constexpr size_t kSlabHeaderSize = 64;
+
+size_t SizeClassIndex(size_t length) {
+  return std::lower_bound(std::begin(kPayloadSizes), std::end(kPayloadSizes),
+                          length) -
+         std::begin(kPayloadSizes);
+}
+
+size_t BlockSize(size_t cls) {
+  return SlabAllocator::kHeaderSize + kPayloadSizes[cls];
+}
+
+size_t BlocksPerSlab(size_t cls) {
+  return (SlabAllocator::kSlabSize - kSlabHeaderSize) / BlockSize(cls);
+}
+
+size_t CacheLimit(size_t cls) {
+  return std::clamp<size_t>(kMaxCachedBytes / BlockSize(cls), 2,
+                            kMaxCachedBlocks);
+}
+
+// Returns kSlabSize bytes aligned to kSlabSize, or null.
+void* MapSlab(SlabAllocator::HugePages huge_pages, bool* hugetlb) {
+  *hugetlb = false;
+#ifdef GPR_LINUX
+  constexpr size_t kSlabSize = SlabAllocator::kSlabSize;
+#ifdef MAP_HUGETLB
+  if (huge_pages == SlabAllocator::HugePages::kHugetlb) {
+    // Huge page mappings are aligned to the huge page size.
+    void* memory =
+        mmap(nullptr, kSlabSize, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (memory != MAP_FAILED &&
+        reinterpret_cast<uintptr_t>(memory) % kSlabSize == 0) {
+      *hugetlb = true;
+      return memory;
+    }
+    if (memory != MAP_FAILED) munmap(memory, kSlabSize);
+  }
+#endif
+  // Map twice as much, and keep the aligned slab in the middle.
+  void* mapped = mmap(nullptr, 2 * kSlabSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapped == MAP_FAILED) return nullptr;
+  char* start = static_cast<char*>(mapped);
+  char* slab = start + (kSlabSize - reinterpret_cast<uintptr_t>(start) %
+                                        kSlabSize) %
+                           kSlabSize;
+  if (slab != start) munmap(start, slab - start);
+  char* end = start + 2 * kSlabSize;
+  if (slab + kSlabSize != end) {
+    munmap(slab + kSlabSize, end - (slab + kSlabSize));
+  }
+#ifdef MADV_HUGEPAGE
+  if (huge_pages != SlabAllocator::HugePages::kNone) {
+    madvise(slab, kSlabSize, MADV_HUGEPAGE);
+  }
+#endif
+  return slab;
+#else
+  (void)huge_pages;
+  return ::operator new(SlabAllocator::kSlabSize,
+                        std::align_val_t(SlabAllocator::kSlabSize),
+                        std::nothrow);
+#endif
+}
+
+void UnmapSlab(void* slab) {
+#ifdef GPR_LINUX
+  munmap(slab, SlabAllocator::kSlabSize);
+#else
+  ::operator delete(slab, std::align_val_t(SlabAllocator::kSlabSize));
+#endif
+}
+
+SlabAllocator::Options OptionsFromConfig() {
+  SlabAllocator::Options options;
+  const absl::string_view huge_pages =
+      ConfigVars::Get().SlabAllocatorHugePages();
+  if (huge_pages == "none") {
+    options.huge_pages = SlabAllocator::HugePages::kNone;
+  } else if (huge_pages == "hugetlb") {
+    options.huge_pages = SlabAllocator::HugePages::kHugetlb;
+  } else if (huge_pages != "transparent") {
+    LOG(ERROR) << "Unknown GRPC_SLAB_ALLOCATOR_HUGE_PAGES value '"
+               << huge_pages << "', using 'transparent'";
+  }
+  options.max_mapped_bytes =
+      static_cast<size_t>(std::max(0, ConfigVars::Get().SlabAllocatorMaxMb()))
+      << 20;
+  return options;
+}
+
+}  // namespace
+
+struct SlabAllocator::Slab {
+  static Slab* Of(void* block) {
+    return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(block) &
+                                   ~(kSlabSize - 1));
+  }
+
+  // Makes all of the slab free blocks of size class index cls.
+  void Reset(size_t cls) {
+    size_class = static_cast<uint32_t>(cls);
+    free_count = static_cast<uint32_t>(BlocksPerSlab(cls));
+    free = nullptr;
+    next_unused = reinterpret_cast<char*>(this) + kSlabHeaderSize;
+    prev = nullptr;
+    next = nullptr;
+  }
+
+  void* TakeBlock() {
+    --free_count;
+    if (free == nullptr) {
+      void* block = next_unused;
+      next_unused += BlockSize(size_class);
+      return block;
+    }
+    void* block = free;
+    free = *static_cast<void**>(block);
+    return block;
+  }
+
+  void ReturnBlock(void* block) {
+    ++free_count;
+    *static_cast<void**>(block) = free;
+    free = block;
+  }
+
+  uint32_t size_class;
+  // Blocks not taken: those on free, and those from next_unused on.
+  uint32_t free_count;
+  bool hugetlb;
+  // Blocks returned, linked through their first bytes.
+  void* free;
+  // The blocks from here on were never taken since the slab was last reset,
+  // so they need not be linked.
+  char* next_unused;
+  // Neighbours in the size class's list of slabs with free blocks, or, next
+  // only, in the list of empty slabs.
+  Slab* prev;
+  Slab* next;
+};
+
+struct alignas(GPR_CACHELINE_SIZE) SlabAllocator::Shard {
+  struct Cache {
+    std::array<void*, kMaxCachedBlocks> blocks;
+    size_t count = 0;
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    uint64_t requested_bytes = 0;
+  };
+
+  Mutex mu;
+  std::array<Cache, kNumSizeClasses> caches ABSL_GUARDED_BY(mu);
+};
+
+struct SlabAllocator::SizeClass {
+  void Link(Slab* slab) {
+    slab->prev = tail;
+    slab->next = nullptr;
+    (tail == nullptr ? head : tail->next) = slab;
+    tail = slab;
+  }
+
+  void Unlink(Slab* slab) {
+    (slab->prev == nullptr ? head : slab->prev->next) = slab->next;
+    (slab->next == nullptr ? tail : slab->next->prev) = slab->prev;
+  }
+
+  // The slabs with free blocks, which blocks are taken from front first.
+  Slab* head = nullptr;
+  Slab* tail = nullptr;
+  // All slabs of the size class, full ones included.
+  size_t slabs = 0;
+};
+
+double SlabAllocator::Stats::ExternalFragmentation() const {
+  if (slabs_mapped == 0) return 0;
+  size_t in_use = 0;
+  for (const SizeClassStats& s : size_classes) {
+    in_use += s.blocks_in_use * (kHeaderSize + s.payload_size);
+  }
+  return 1 - static_cast<double>(in_use) / (slabs_mapped * kSlabSize);
+}
+
+double SlabAllocator::Stats::InternalFragmentation() const {
+  uint64_t requested = 0;
+  uint64_t allocated = 0;
+  for (const SizeClassStats& s : size_classes) {
+    requested += s.requested_bytes;
+    allocated += s.allocations * s.payload_size;
+  }
+  if (allocated == 0) return 0;
+  return 1 - static_cast<double>(requested) / allocated;
+}
+
+SlabAllocator& SlabAllocator::Get() {
+  static NoDestruct<SlabAllocator> allocator(OptionsFromConfig());
+  return *allocator;
+}
+
+SlabAllocator::SlabAllocator(Options options)
+    : options_(options),
+      shards_(PerCpuOptions().SetCpusPerShard(2).SetMaxShards(64)),
+      size_classes_(kNumSizeClasses) {
+  static_assert(sizeof(Slab) <= kSlabHeaderSize);
+}
+
+SlabAllocator::~SlabAllocator() {
+  MutexLock lock(&mu_);
+  for (Slab* slab : slabs_) UnmapSlab(slab);
+}
+
+size_t SlabAllocator::MaxPayloadSize() {
+  return kPayloadSizes[kNumSizeClasses - 1];
+}
+
+void* SlabAllocator::Allocate(size_t length, size_t* capacity) {
+  const size_t cls = SizeClassIndex(length);
+  if (cls == kNumSizeClasses) {
+    global_stats().IncrementSlabFallbackAllocations();
+    return nullptr;
+  }
+  void* block = nullptr;
+  bool idle_memory_changed = false;
+  {
+    Shard& shard = shards_.this_cpu();
+    MutexLock lock(&shard.mu);
+    Shard::Cache& cache = shard.caches[cls];
+    if (cache.count == 0) idle_memory_changed = Refill(cls, shard);
+    if (cache.count > 0) {
+      ++cache.allocations;
+      cache.requested_bytes += length;
+      block = cache.blocks[--cache.count];
+    }
+  }
+  if (idle_memory_changed) ReportIdleMemory();
+  if (block == nullptr) {
+    global_stats().IncrementSlabFallbackAllocations();
+    return nullptr;
+  }
+  if (capacity != nullptr) *capacity = kPayloadSizes[cls];
+  return block;
+}
+
+void SlabAllocator::Free(void* block) {
+  // The slab cannot change size class while the block is taken.
+  const size_t cls = Slab::Of(block)->size_class;
+  bool idle_memory_changed = false;
+  {
+    Shard& shard = shards_.this_cpu();
+    MutexLock lock(&shard.mu);
+    Shard::Cache& cache = shard.caches[cls];
+    if (cache.count == CacheLimit(cls)) {
+      idle_memory_changed = Drain(cls, shard);
+    }
+    ++cache.frees;
+    cache.blocks[cache.count++] = block;
+  }
+  if (idle_memory_changed) ReportIdleMemory();
+}
+
+bool SlabAllocator::Refill(size_t cls, Shard& shard) {
+  Shard::Cache& cache = shard.caches[cls];
+  MutexLock lock(&mu_);
+  SizeClass& size_class = size_classes_[cls];
+  if (size_class.head == nullptr && !Grow(cls)) return false;
+  const size_t want = std::max<size_t>(1, CacheLimit(cls) / 2);
+  size_t n = 0;
+  while (n < want && size_class.head != nullptr) {
+    Slab* slab = size_class.head;
+    cache.blocks[n++] = slab->TakeBlock();
+    if (slab->free_count == 0) size_class.Unlink(slab);
+  }
+  // The cache hands out its last block first: reversed, blocks are handed
+  // out in the order they were taken, which for a fresh slab is address
+  // order.
+  std::reverse(cache.blocks.begin(), cache.blocks.begin() + n);
+  cache.count = n;
+  taken_bytes_ += n * BlockSize(cls);
+  return IdleMemoryChanged();
+}
+
+bool SlabAllocator::Drain(size_t cls, Shard& shard) {
+  Shard::Cache& cache = shard.caches[cls];
+  const size_t n = std::max<size_t>(1, cache.count / 2);
+  MutexLock lock(&mu_);
+  cache.count -= n;
+  return ReturnBlocks(cls, cache.blocks.data() + cache.count, n);
+}
+
+bool SlabAllocator::ReturnBlocks(size_t cls, void* const* blocks,
+                                 size_t count) {
+  if (count == 0) return false;
+  SizeClass& size_class = size_classes_[cls];
+  const size_t blocks_per_slab = BlocksPerSlab(cls);
+  for (size_t i = 0; i < count; ++i) {
+    Slab* slab = Slab::Of(blocks[i]);
+    slab->ReturnBlock(blocks[i]);
+    if (slab->free_count == 1) size_class.Link(slab);
+    if (slab->free_count < blocks_per_slab) continue;
+    size_class.Unlink(slab);
+    --size_class.slabs;
+    if (num_empty_slabs_ < kMaxEmptySlabs) {
+      slab->next = empty_slabs_;
+      empty_slabs_ = slab;
+      ++num_empty_slabs_;
+    } else {
+      Unmap(slab);
+    }
+  }
+  taken_bytes_ -= count * BlockSize(cls);
+  return IdleMemoryChanged();
+}
+
+bool SlabAllocator::Grow(size_t cls) {
+  Slab* slab = empty_slabs_;
+  if (slab != nullptr) {
+    empty_slabs_ = slab->next;
+    --num_empty_slabs_;
+  } else {
+    if ((slabs_.size() + 1) * kSlabSize > options_.max_mapped_bytes) {
+      return false;
+    }
+    bool hugetlb;
+    void* memory = MapSlab(options_.huge_pages, &hugetlb);
+    if (memory == nullptr) return false;
+    slab = new (memory) Slab;
+    slab->hugetlb = hugetlb;
+    slabs_.push_back(slab);
+    if (hugetlb) ++hugetlb_slabs_;
+    global_stats().IncrementSlabSlabsMapped();
+  }
+  slab->Reset(cls);
+  SizeClass& size_class = size_classes_[cls];
+  size_class.Link(slab);
+  ++size_class.slabs;
+  return true;
+}
+
+void SlabAllocator::Unmap(Slab* slab) {
+  slabs_.erase(std::find(slabs_.begin(), slabs_.end(), slab));
+  if (slab->hugetlb) --hugetlb_slabs_;
+  UnmapSlab(slab);
+}
+
+SlabAllocator::IdleMemory SlabAllocator::GetIdleMemoryLocked() {
+  IdleMemory idle;
+  idle.bytes = slabs_.size() * kSlabSize - taken_bytes_;
+  idle.empty_slabs = num_empty_slabs_;
+  return idle;
+}
+
+SlabAllocator::IdleMemory SlabAllocator::GetIdleMemory() {
+  MutexLock lock(&mu_);
+  return GetIdleMemoryLocked();
+}
+
+bool SlabAllocator::IdleMemoryChanged() {
+  if (idle_memory_callback_.load(std::memory_order_relaxed) == nullptr) {
+    return false;
+  }
+  const IdleMemory idle = GetIdleMemoryLocked();
+  const IdleMemory& reported = reported_idle_memory_;
+  if (idle.empty_slabs == reported.empty_slabs &&
+      idle.bytes < reported.bytes + kIdleMemoryReportBytes &&
+      reported.bytes < idle.bytes + kIdleMemoryReportBytes) {
+    return false;
+  }
+  reported_idle_memory_ = idle;
+  return true;
+}
+
+void SlabAllocator::ReportIdleMemory() {
+  IdleMemoryCallback callback =
+      idle_memory_callback_.load(std::memory_order_acquire);
+  if (callback != nullptr) callback();
+}
+
+void SlabAllocator::SetIdleMemoryCallback(IdleMemoryCallback callback) {
+  {
+    MutexLock lock(&mu_);
+    reported_idle_memory_ = GetIdleMemoryLocked();
+    idle_memory_callback_.store(callback, std::memory_order_release);
+  }
+  ReportIdleMemory();
+}
+
+void SlabAllocator::ReleaseFreeMemory() {
+  bool idle_memory_changed = false;
+  for (Shard& shard : shards_) {
+    MutexLock shard_lock(&shard.mu);
+    MutexLock lock(&mu_);
+    for (size_t cls = 0; cls < kNumSizeClasses; ++cls) {
+      Shard::Cache& cache = shard.caches[cls];
+      if (ReturnBlocks(cls, cache.blocks.data(), cache.count)) {
+        idle_memory_changed = true;
+      }
+      cache.count = 0;
+    }
+  }
+  {
+    MutexLock lock(&mu_);
+    while (empty_slabs_ != nullptr) {
+      Slab* slab = empty_slabs_;
+      empty_slabs_ = slab->next;
+      Unmap(slab);
+    }
+    num_empty_slabs_ = 0;
+    if (IdleMemoryChanged()) idle_memory_changed = true;
+  }
+  if (idle_memory_changed) ReportIdleMemory();
+}
+
+SlabAllocator::Stats SlabAllocator::GetStats() {
+  Stats stats;
+  stats.size_classes.resize(kNumSizeClasses);
+  std::array<uint64_t, kNumSizeClasses> frees{};
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    for (size_t cls = 0; cls < kNumSizeClasses; ++cls) {
+      const Shard::Cache& cache = shard.caches[cls];
+      stats.size_classes[cls].allocations += cache.allocations;
+      stats.size_classes[cls].requested_bytes += cache.requested_bytes;
+      frees[cls] += cache.frees;
+    }
+  }
+  MutexLock lock(&mu_);
+  stats.slabs_mapped = slabs_.size();
+  stats.hugetlb_slabs = hugetlb_slabs_;
+  stats.empty_slabs = num_empty_slabs_;
+  for (size_t cls = 0; cls < kNumSizeClasses; ++cls) {
+    SizeClassStats& s = stats.size_classes[cls];
+    s.payload_size = kPayloadSizes[cls];
+    s.blocks_mapped = size_classes_[cls].slabs * BlocksPerSlab(cls);
+    // Shards are read one after the other, so while blocks are allocated
+    // and freed this is approximate.
+    s.blocks_in_use = s.allocations > frees[cls]
+                          ? static_cast<size_t>(s.allocations - frees[cls])
+                          : 0;
+  }
+  return stats;
+}
+
+}  // namespace grpc_core
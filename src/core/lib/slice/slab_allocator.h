@@ -0,0 +1,176 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SLICE_SLAB_ALLOCATOR_H
+#define GRPC_SRC_CORE_LIB_SLICE_SLAB_ALLOCATOR_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// Allocates the memory behind refcounted slices from size classes, so that
+// read buffers and message slices do not go through malloc.
+//
+// Memory is mapped in 2MB slabs, optionally backed by huge pages, and each
+// slab is cut into blocks of one size class. A block is kHeaderSize bytes for
+// the slice's refcount followed by the payload. Freed blocks go to a cache on
+// the freeing CPU's shard, and move to and from their slab's free list in
+// batches. A slab whose blocks are all back is empty: a few empty slabs are
+// kept, for any size class to take over, and the others are unmapped. Once
+// max_mapped_bytes are mapped, Allocate() fails and callers fall back to
+// malloc.
+class SlabAllocator {
+ public:
+  enum class HugePages {
+    // Plain pages.
+    kNone,
+    // madvise(MADV_HUGEPAGE), for transparent huge pages.
+    kTransparent,
+    // MAP_HUGETLB, from the reserved huge page pool; slabs fall back to
+    // kTransparent once that is exhausted.
+    kHugetlb,
+  };
+
+  struct Options {
+    HugePages huge_pages = HugePages::kTransparent;
+    size_t max_mapped_bytes = 32 * 1024 * 1024;
+  };
+
+  struct SizeClassStats {
+    // Largest payload the class holds.
+    size_t payload_size = 0;
+    uint64_t allocations = 0;
+    // Sum of the payload sizes asked for, to compare with
+    // allocations * payload_size.
+    uint64_t requested_bytes = 0;
+    size_t blocks_in_use = 0;
+    size_t blocks_mapped = 0;
+  };
+
+  struct Stats {
+    size_t slabs_mapped = 0;
+    // Of slabs_mapped, those on MAP_HUGETLB pages.
+    size_t hugetlb_slabs = 0;
+    // Of slabs_mapped, those with no blocks handed out.
+    size_t empty_slabs = 0;
+    std::vector<SizeClassStats> size_classes;
+
+    // Share of the mapped memory not holding live blocks: free blocks plus
+    // the ends of slabs that no block fits in.
+    double ExternalFragmentation() const;
+    // Share of the allocated payload capacity that was not asked for.
+    double InternalFragmentation() const;
+  };
+
+  // The slab memory that is mapped but not handed out to the shards.
+  struct IdleMemory {
+    size_t bytes = 0;
+    // Slabs with no blocks handed out.
+    size_t empty_slabs = 0;
+  };
+
+  // Called, without the allocator's locks held, when the idle memory changed
+  // by a quarter of a slab or more, or when the number of empty slabs
+  // changed.
+  using IdleMemoryCallback = void (*)();
+
+  // Space before the payload of a block, for the slice's refcount.
+  static constexpr size_t kHeaderSize = 48;
+  static constexpr size_t kSlabSize = 2 * 1024 * 1024;
+
+  // The process wide allocator, configured from the
+  // GRPC_SLAB_ALLOCATOR_HUGE_PAGES and GRPC_SLAB_ALLOCATOR_MAX_MB config vars.
+  static SlabAllocator& Get();
+
+  explicit SlabAllocator(Options options);
+  ~SlabAllocator();
+
+  SlabAllocator(const SlabAllocator&) = delete;
+  SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+  // Returns a block with room for kHeaderSize + length bytes, or null if
+  // length is above the largest size class or no more slabs may be mapped.
+  // If capacity is not null, it is set to the payload size of the block.
+  void* Allocate(size_t length, size_t* capacity = nullptr);
+  // Frees a block returned by Allocate().
+  void Free(void* block);
+
+  Stats GetStats();
+
+  IdleMemory GetIdleMemory();
+  // Sets the callback told of changes to the idle memory, and calls it.
+  void SetIdleMemoryCallback(IdleMemoryCallback callback);
+
+  // Returns the blocks cached by the shards to their slabs, and unmaps the
+  // slabs that are left empty. For when memory is short.
+  void ReleaseFreeMemory();
+
+  // The largest payload Allocate() succeeds for.
+  static size_t MaxPayloadSize();
+
+ private:
+  struct Slab;
+  struct Shard;
+  struct SizeClass;
+
+  // Refill(), Drain() and ReturnBlocks() return whether the idle memory
+  // changed enough to call the IdleMemoryCallback.
+
+  // Fills cache with blocks of size class index cls, taking a slab if
+  // needed.
+  bool Refill(size_t cls, Shard& shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu);
+  // Returns half of shard's cached blocks of size class index cls to their
+  // slabs.
+  bool Drain(size_t cls, Shard& shard) ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu);
+  // Returns blocks of size class index cls to their slabs. Slabs left empty
+  // are kept up to kMaxEmptySlabs, and unmapped beyond.
+  bool ReturnBlocks(size_t cls, void* const* blocks, size_t count)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Gives size class index cls a slab with free blocks: an empty one if there
+  // is, or a newly mapped one.
+  bool Grow(size_t cls) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void Unmap(Slab* slab) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  IdleMemory GetIdleMemoryLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  bool IdleMemoryChanged() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void ReportIdleMemory();
+
+  const Options options_;
+  PerCpu<Shard> shards_;
+  Mutex mu_;
+  std::vector<SizeClass> size_classes_ ABSL_GUARDED_BY(mu_);
+  std::vector<Slab*> slabs_ ABSL_GUARDED_BY(mu_);
+  // Linked through Slab::next.
+  Slab* empty_slabs_ ABSL_GUARDED_BY(mu_) = nullptr;
+  size_t num_empty_slabs_ ABSL_GUARDED_BY(mu_) = 0;
+  size_t hugetlb_slabs_ ABSL_GUARDED_BY(mu_) = 0;
+  // Bytes of the blocks taken from the slabs, by the shards or callers.
+  size_t taken_bytes_ ABSL_GUARDED_BY(mu_) = 0;
+  // What the IdleMemoryCallback was last called for.
+  IdleMemory reported_idle_memory_ ABSL_GUARDED_BY(mu_);
+  std::atomic<IdleMemoryCallback> idle_memory_callback_{nullptr};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SLICE_SLAB_ALLOCATOR_H
@@ -26,6 +26,8 @@
 #include <new>
 
 #include "absl/log/check.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/slice/slab_allocator.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/util/memory.h"
@@ -220,6 +222,19 @@ grpc_slice grpc_slice_from_cpp_string(std::string str) {
 
 grpc_slice grpc_slice_malloc_large(size_t length) {
   grpc_slice slice;
+  if (grpc_core::IsSlabSliceAllocatorEnabled()) {
+    void* block = grpc_core::SlabAllocator::Get().Allocate(length);
+    if (block != nullptr) {
+      slice.refcount = new (block) grpc_slice_refcount(
+          [](grpc_slice_refcount* p) {
+            grpc_core::SlabAllocator::Get().Free(p);
+          });
+      slice.data.refcounted.bytes = static_cast<uint8_t*>(block) +
+                                    grpc_core::SlabAllocator::kHeaderSize;
+      slice.data.refcounted.length = length;
+      return slice;
+    }
+  }
   uint8_t* memory = new uint8_t[sizeof(grpc_slice_refcount) + length];
   slice.refcount = new (memory) grpc_slice_refcount(
       [](grpc_slice_refcount* p) { delete[] reinterpret_cast<uint8_t*>(p); });
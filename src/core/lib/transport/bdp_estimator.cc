@@ -51,6 +51,7 @@ Timestamp BdpEstimator::CompletePing() {
       << " est=" << estimate_ << " dt=" << dt << " bw=" << bw / 125000.0
       << "Mbs bw_est=" << bw_est_ / 125000.0 << "Mbs";
   CHECK(ping_state_ == PingState::STARTED);
+  AddSample(bw, dt);
   if (accumulator_ > 2 * estimate_ / 3 && bw > bw_est_) {
     estimate_ = std::max(accumulator_, estimate_ * 2);
     bw_est_ = bw;
@@ -77,4 +78,32 @@ Timestamp BdpEstimator::CompletePing() {
   return Timestamp::Now() + inter_ping_delay_;
 }
 
+void BdpEstimator::AddSample(double bandwidth, double rtt) {
+  samples_[num_samples_ % kNumSamples] = Sample{bandwidth, rtt};
+  ++num_samples_;
+  if (bandwidth >= plateau_bw_ * 1.25) {
+    plateau_bw_ = bandwidth;
+    plateau_count_ = 0;
+  } else {
+    ++plateau_count_;
+  }
+}
+
+double BdpEstimator::MaxBandwidth() const {
+  double max_bw = 0;
+  for (size_t i = 0; i < std::min(num_samples_, kNumSamples); i++) {
+    max_bw = std::max(max_bw, samples_[i].bandwidth);
+  }
+  return max_bw;
+}
+
+double BdpEstimator::MinRttSeconds() const {
+  if (num_samples_ == 0) return 0;
+  double min_rtt = samples_[0].rtt;
+  for (size_t i = 1; i < std::min(num_samples_, kNumSamples); i++) {
+    min_rtt = std::min(min_rtt, samples_[i].rtt);
+  }
+  return min_rtt;
+}
+
 }  // namespace grpc_core
@@ -23,6 +23,7 @@
 #include <grpc/support/time.h>
 #include <inttypes.h>
 
+#include <array>
 #include <string>
 
 #include "absl/log/check.h"
@@ -72,9 +73,26 @@ class BdpEstimator {
 
   int64_t accumulator() const { return accumulator_; }
 
+  // Delivery rate model over the last kNumSamples completed pings, in the
+  // style of BBR: the highest bandwidth (bytes/sec) and the lowest round trip
+  // time (seconds) seen. Both are zero until a ping completes.
+  static constexpr size_t kNumSamples = 10;
+  double MaxBandwidth() const;
+  double MinRttSeconds() const;
+  // True once the bandwidth stopped growing by 25% over three pings: from
+  // then on the link is assumed to be fully used.
+  bool BandwidthPlateaued() const { return plateau_count_ >= 3; }
+
  private:
   enum class PingState { UNSCHEDULED, SCHEDULED, STARTED };
 
+  struct Sample {
+    double bandwidth = 0;
+    double rtt = 0;
+  };
+
+  void AddSample(double bandwidth, double rtt);
+
   int64_t accumulator_;
   int64_t estimate_;
   // when was the current ping started?
@@ -84,6 +102,10 @@ class BdpEstimator {
   PingState ping_state_;
   double bw_est_;
   absl::string_view name_;
+  std::array<Sample, kNumSamples> samples_;
+  size_t num_samples_ = 0;
+  double plateau_bw_ = 0;
+  int plateau_count_ = 0;
 };
 
 }  // namespace grpc_core
@@ -422,6 +422,18 @@ const absl::string_view
         "enobufs_count",
         "uncommon_io_error_count",
         "msg_errqueue_error_count",
+        "tcp_server_connections_accepted",
+        "tcp_zerocopy_send_enobufs",
+        "poller_busy_poll_hits",
+        "poller_busy_poll_parks",
+        "thread_pool_steals",
+        "thread_pool_cross_node_steals",
+        "http2_idle_compactions",
+        "http2_writes_coalesced",
+        "compression_skipped_incompressible",
+        "compression_skipped_cpu_busy",
+        "slab_slabs_mapped",
+        "slab_fallback_allocations",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -468,6 +480,28 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of ENOBUFS errors",
     "Number of uncommon io errors",
     "Number of uncommon errors returned by MSG_ERRQUEUE",
+    "Number of connections accepted by listening sockets",
+    "Number of zerocopy sendmsg calls that failed with ENOBUFS on endpoints "
+    "with adaptive zerocopy",
+    "Number of times a busy polling EventEngine poller found events while "
+    "spinning",
+    "Number of times a busy polling EventEngine poller exhausted its spin "
+    "budget and blocked",
+    "Number of closures an EventEngine thread pool worker took from the queue "
+    "of another worker",
+    "Number of closures an EventEngine thread pool worker took from a queue "
+    "that belongs to another NUMA node",
+    "Number of times an HTTP2 transport with no active streams shrank its "
+    "HPACK table and buffers",
+    "Number of times an HTTP2 write was held back to coalesce it with frames "
+    "from later writes",
+    "Number of messages adaptive compression sent uncompressed because they "
+    "looked incompressible",
+    "Number of messages adaptive compression sent uncompressed because the "
+    "process was short of CPU",
+    "Number of 2MB slabs the slice slab allocator mapped",
+    "Number of slice allocations the slab allocator left to malloc, because "
+    "they were too large or the slab memory limit was reached",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -513,6 +547,17 @@ const absl::string_view
         "chaotic_good_tcp_read_offer_control",
         "chaotic_good_tcp_write_size_data",
         "chaotic_good_tcp_write_size_control",
+        "tcp_server_accepts_per_wakeup",
+        "tcp_server_accept_queue_depth",
+        "tcp_rx_zerocopy_read_size",
+        "tcp_zerocopy_send_threshold",
+        "tcp_zerocopy_max_inflight_sends",
+        "poller_busy_poll_spin_time",
+        "thread_pool_queue_delay",
+        "http2_frames_per_write",
+        "http2_bytes_per_write",
+        "compression_ratio",
+        "compression_time",
 };
 const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
@@ -560,6 +605,23 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes offered to each syscall_read in the control channel",
     "Number of bytes offered to each syscall_write in the data channel",
     "Number of bytes offered to each syscall_write in the control channel",
+    "Number of connections accepted per readiness notification of a listening "
+    "socket",
+    "Number of connections waiting in the accept queue of a listening socket "
+    "when it becomes readable",
+    "Number of bytes mapped by each TCP_ZEROCOPY_RECEIVE read",
+    "Zerocopy send threshold in bytes chosen by adaptive tuning, recorded on "
+    "each change",
+    "Number of in-flight zerocopy writes allowed by adaptive tuning, recorded "
+    "on each change",
+    "Number of microseconds a busy polling EventEngine poller spent spinning "
+    "before finding events or blocking",
+    "Number of microseconds a sampled closure waited in an EventEngine thread "
+    "pool queue before it started running",
+    "Number of frames in each HTTP2 endpoint write",
+    "Number of bytes in each HTTP2 endpoint write",
+    "Size of each compressed message as a percentage of its uncompressed size",
+    "Number of microseconds spent compressing each message",
 };
 GlobalStats::GlobalStats()
     : client_calls_created{0},
@@ -598,7 +660,19 @@ GlobalStats::GlobalStats()
       enotconn_count{0},
       enobufs_count{0},
       uncommon_io_error_count{0},
-      msg_errqueue_error_count{0} {}
+      msg_errqueue_error_count{0},
+      tcp_server_connections_accepted{0},
+      tcp_zerocopy_send_enobufs{0},
+      poller_busy_poll_hits{0},
+      poller_busy_poll_parks{0},
+      thread_pool_steals{0},
+      thread_pool_cross_node_steals{0},
+      http2_idle_compactions{0},
+      http2_writes_coalesced{0},
+      compression_skipped_incompressible{0},
+      compression_skipped_cpu_busy{0},
+      slab_slabs_mapped{0},
+      slab_fallback_allocations{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -731,6 +805,39 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kChaoticGoodTcpWriteSizeControl:
       return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable0,
                            20, chaotic_good_tcp_write_size_control.buckets()};
+    case Histogram::kTcpServerAcceptsPerWakeup:
+      return HistogramView{&Histogram_10000_20_64::BucketFor, kStatsTable4, 20,
+                           tcp_server_accepts_per_wakeup.buckets()};
+    case Histogram::kTcpServerAcceptQueueDepth:
+      return HistogramView{&Histogram_65536_26_64::BucketFor, kStatsTable6, 26,
+                           tcp_server_accept_queue_depth.buckets()};
+    case Histogram::kTcpRxZerocopyReadSize:
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable0,
+                           20, tcp_rx_zerocopy_read_size.buckets()};
+    case Histogram::kTcpZerocopySendThreshold:
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable0,
+                           20, tcp_zerocopy_send_threshold.buckets()};
+    case Histogram::kTcpZerocopyMaxInflightSends:
+      return HistogramView{&Histogram_100_20_64::BucketFor, kStatsTable10, 20,
+                           tcp_zerocopy_max_inflight_sends.buckets()};
+    case Histogram::kPollerBusyPollSpinTime:
+      return HistogramView{&Histogram_100000_20_64::BucketFor, kStatsTable2, 20,
+                           poller_busy_poll_spin_time.buckets()};
+    case Histogram::kThreadPoolQueueDelay:
+      return HistogramView{&Histogram_100000_20_64::BucketFor, kStatsTable2, 20,
+                           thread_pool_queue_delay.buckets()};
+    case Histogram::kHttp2FramesPerWrite:
+      return HistogramView{&Histogram_10000_20_64::BucketFor, kStatsTable4, 20,
+                           http2_frames_per_write.buckets()};
+    case Histogram::kHttp2BytesPerWrite:
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable0,
+                           20, http2_bytes_per_write.buckets()};
+    case Histogram::kCompressionRatio:
+      return HistogramView{&Histogram_100_20_64::BucketFor, kStatsTable10, 20,
+                           compression_ratio.buckets()};
+    case Histogram::kCompressionTime:
+      return HistogramView{&Histogram_100000_20_64::BucketFor, kStatsTable2, 20,
+                           compression_time.buckets()};
   }
 }
 const absl::string_view
@@ -821,6 +928,30 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.uncommon_io_error_count.load(std::memory_order_relaxed);
     result->msg_errqueue_error_count +=
         data.msg_errqueue_error_count.load(std::memory_order_relaxed);
+    result->tcp_server_connections_accepted +=
+        data.tcp_server_connections_accepted.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_send_enobufs +=
+        data.tcp_zerocopy_send_enobufs.load(std::memory_order_relaxed);
+    result->poller_busy_poll_hits +=
+        data.poller_busy_poll_hits.load(std::memory_order_relaxed);
+    result->poller_busy_poll_parks +=
+        data.poller_busy_poll_parks.load(std::memory_order_relaxed);
+    result->thread_pool_steals +=
+        data.thread_pool_steals.load(std::memory_order_relaxed);
+    result->thread_pool_cross_node_steals +=
+        data.thread_pool_cross_node_steals.load(std::memory_order_relaxed);
+    result->http2_idle_compactions +=
+        data.http2_idle_compactions.load(std::memory_order_relaxed);
+    result->http2_writes_coalesced +=
+        data.http2_writes_coalesced.load(std::memory_order_relaxed);
+    result->compression_skipped_incompressible +=
+        data.compression_skipped_incompressible.load(std::memory_order_relaxed);
+    result->compression_skipped_cpu_busy +=
+        data.compression_skipped_cpu_busy.load(std::memory_order_relaxed);
+    result->slab_slabs_mapped +=
+        data.slab_slabs_mapped.load(std::memory_order_relaxed);
+    result->slab_fallback_allocations +=
+        data.slab_fallback_allocations.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
@@ -891,6 +1022,22 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->chaotic_good_tcp_write_size_data);
     data.chaotic_good_tcp_write_size_control.Collect(
         &result->chaotic_good_tcp_write_size_control);
+    data.tcp_server_accepts_per_wakeup.Collect(
+        &result->tcp_server_accepts_per_wakeup);
+    data.tcp_server_accept_queue_depth.Collect(
+        &result->tcp_server_accept_queue_depth);
+    data.tcp_rx_zerocopy_read_size.Collect(&result->tcp_rx_zerocopy_read_size);
+    data.tcp_zerocopy_send_threshold.Collect(
+        &result->tcp_zerocopy_send_threshold);
+    data.tcp_zerocopy_max_inflight_sends.Collect(
+        &result->tcp_zerocopy_max_inflight_sends);
+    data.poller_busy_poll_spin_time.Collect(
+        &result->poller_busy_poll_spin_time);
+    data.thread_pool_queue_delay.Collect(&result->thread_pool_queue_delay);
+    data.http2_frames_per_write.Collect(&result->http2_frames_per_write);
+    data.http2_bytes_per_write.Collect(&result->http2_bytes_per_write);
+    data.compression_ratio.Collect(&result->compression_ratio);
+    data.compression_time.Collect(&result->compression_time);
   }
   return result;
 }
@@ -946,6 +1093,29 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       uncommon_io_error_count - other.uncommon_io_error_count;
   result->msg_errqueue_error_count =
       msg_errqueue_error_count - other.msg_errqueue_error_count;
+  result->tcp_server_connections_accepted =
+      tcp_server_connections_accepted - other.tcp_server_connections_accepted;
+  result->tcp_zerocopy_send_enobufs =
+      tcp_zerocopy_send_enobufs - other.tcp_zerocopy_send_enobufs;
+  result->poller_busy_poll_hits =
+      poller_busy_poll_hits - other.poller_busy_poll_hits;
+  result->poller_busy_poll_parks =
+      poller_busy_poll_parks - other.poller_busy_poll_parks;
+  result->thread_pool_steals = thread_pool_steals - other.thread_pool_steals;
+  result->thread_pool_cross_node_steals =
+      thread_pool_cross_node_steals - other.thread_pool_cross_node_steals;
+  result->http2_idle_compactions =
+      http2_idle_compactions - other.http2_idle_compactions;
+  result->http2_writes_coalesced =
+      http2_writes_coalesced - other.http2_writes_coalesced;
+  result->compression_skipped_incompressible =
+      compression_skipped_incompressible -
+      other.compression_skipped_incompressible;
+  result->compression_skipped_cpu_busy =
+      compression_skipped_cpu_busy - other.compression_skipped_cpu_busy;
+  result->slab_slabs_mapped = slab_slabs_mapped - other.slab_slabs_mapped;
+  result->slab_fallback_allocations =
+      slab_fallback_allocations - other.slab_fallback_allocations;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
@@ -1041,6 +1211,26 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->chaotic_good_tcp_write_size_control =
       chaotic_good_tcp_write_size_control -
       other.chaotic_good_tcp_write_size_control;
+  result->tcp_server_accepts_per_wakeup =
+      tcp_server_accepts_per_wakeup - other.tcp_server_accepts_per_wakeup;
+  result->tcp_server_accept_queue_depth =
+      tcp_server_accept_queue_depth - other.tcp_server_accept_queue_depth;
+  result->tcp_rx_zerocopy_read_size =
+      tcp_rx_zerocopy_read_size - other.tcp_rx_zerocopy_read_size;
+  result->tcp_zerocopy_send_threshold =
+      tcp_zerocopy_send_threshold - other.tcp_zerocopy_send_threshold;
+  result->tcp_zerocopy_max_inflight_sends =
+      tcp_zerocopy_max_inflight_sends - other.tcp_zerocopy_max_inflight_sends;
+  result->poller_busy_poll_spin_time =
+      poller_busy_poll_spin_time - other.poller_busy_poll_spin_time;
+  result->thread_pool_queue_delay =
+      thread_pool_queue_delay - other.thread_pool_queue_delay;
+  result->http2_frames_per_write =
+      http2_frames_per_write - other.http2_frames_per_write;
+  result->http2_bytes_per_write =
+      http2_bytes_per_write - other.http2_bytes_per_write;
+  result->compression_ratio = compression_ratio - other.compression_ratio;
+  result->compression_time = compression_time - other.compression_time;
   return result;
 }
 }  // namespace grpc_core
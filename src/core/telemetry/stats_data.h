@@ -307,6 +307,18 @@ struct GlobalStats {
     kEnobufsCount,
     kUncommonIoErrorCount,
     kMsgErrqueueErrorCount,
+    kTcpServerConnectionsAccepted,
+    kTcpZerocopySendEnobufs,
+    kPollerBusyPollHits,
+    kPollerBusyPollParks,
+    kThreadPoolSteals,
+    kThreadPoolCrossNodeSteals,
+    kHttp2IdleCompactions,
+    kHttp2WritesCoalesced,
+    kCompressionSkippedIncompressible,
+    kCompressionSkippedCpuBusy,
+    kSlabSlabsMapped,
+    kSlabFallbackAllocations,
     COUNT
   };
   enum class Histogram {
@@ -352,6 +364,17 @@ struct GlobalStats {
     kChaoticGoodTcpReadOfferControl,
     kChaoticGoodTcpWriteSizeData,
     kChaoticGoodTcpWriteSizeControl,
+    kTcpServerAcceptsPerWakeup,
+    kTcpServerAcceptQueueDepth,
+    kTcpRxZerocopyReadSize,
+    kTcpZerocopySendThreshold,
+    kTcpZerocopyMaxInflightSends,
+    kPollerBusyPollSpinTime,
+    kThreadPoolQueueDelay,
+    kHttp2FramesPerWrite,
+    kHttp2BytesPerWrite,
+    kCompressionRatio,
+    kCompressionTime,
     COUNT
   };
   GlobalStats();
@@ -400,6 +423,18 @@ struct GlobalStats {
       uint64_t enobufs_count;
       uint64_t uncommon_io_error_count;
       uint64_t msg_errqueue_error_count;
+      uint64_t tcp_server_connections_accepted;
+      uint64_t tcp_zerocopy_send_enobufs;
+      uint64_t poller_busy_poll_hits;
+      uint64_t poller_busy_poll_parks;
+      uint64_t thread_pool_steals;
+      uint64_t thread_pool_cross_node_steals;
+      uint64_t http2_idle_compactions;
+      uint64_t http2_writes_coalesced;
+      uint64_t compression_skipped_incompressible;
+      uint64_t compression_skipped_cpu_busy;
+      uint64_t slab_slabs_mapped;
+      uint64_t slab_fallback_allocations;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -445,6 +480,17 @@ struct GlobalStats {
   Histogram_16777216_20_64 chaotic_good_tcp_read_offer_control;
   Histogram_16777216_20_64 chaotic_good_tcp_write_size_data;
   Histogram_16777216_20_64 chaotic_good_tcp_write_size_control;
+  Histogram_10000_20_64 tcp_server_accepts_per_wakeup;
+  Histogram_65536_26_64 tcp_server_accept_queue_depth;
+  Histogram_16777216_20_64 tcp_rx_zerocopy_read_size;
+  Histogram_16777216_20_64 tcp_zerocopy_send_threshold;
+  Histogram_100_20_64 tcp_zerocopy_max_inflight_sends;
+  Histogram_100000_20_64 poller_busy_poll_spin_time;
+  Histogram_100000_20_64 thread_pool_queue_delay;
+  Histogram_10000_20_64 http2_frames_per_write;
+  Histogram_16777216_20_64 http2_bytes_per_write;
+  Histogram_100_20_64 compression_ratio;
+  Histogram_100000_20_64 compression_time;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
 };
@@ -581,6 +627,52 @@ class GlobalStatsCollector {
     data_.this_cpu().msg_errqueue_error_count.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementTcpServerConnectionsAccepted() {
+    data_.this_cpu().tcp_server_connections_accepted.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopySendEnobufs() {
+    data_.this_cpu().tcp_zerocopy_send_enobufs.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementPollerBusyPollHits() {
+    data_.this_cpu().poller_busy_poll_hits.fetch_add(1,
+                                                     std::memory_order_relaxed);
+  }
+  void IncrementPollerBusyPollParks() {
+    data_.this_cpu().poller_busy_poll_parks.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementThreadPoolSteals() {
+    data_.this_cpu().thread_pool_steals.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementThreadPoolCrossNodeSteals() {
+    data_.this_cpu().thread_pool_cross_node_steals.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2IdleCompactions() {
+    data_.this_cpu().http2_idle_compactions.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2WritesCoalesced() {
+    data_.this_cpu().http2_writes_coalesced.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCompressionSkippedIncompressible() {
+    data_.this_cpu().compression_skipped_incompressible.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCompressionSkippedCpuBusy() {
+    data_.this_cpu().compression_skipped_cpu_busy.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSlabSlabsMapped() {
+    data_.this_cpu().slab_slabs_mapped.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementSlabFallbackAllocations() {
+    data_.this_cpu().slab_fallback_allocations.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -713,6 +805,39 @@ class GlobalStatsCollector {
   void IncrementChaoticGoodTcpWriteSizeControl(int value) {
     data_.this_cpu().chaotic_good_tcp_write_size_control.Increment(value);
   }
+  void IncrementTcpServerAcceptsPerWakeup(int value) {
+    data_.this_cpu().tcp_server_accepts_per_wakeup.Increment(value);
+  }
+  void IncrementTcpServerAcceptQueueDepth(int value) {
+    data_.this_cpu().tcp_server_accept_queue_depth.Increment(value);
+  }
+  void IncrementTcpRxZerocopyReadSize(int value) {
+    data_.this_cpu().tcp_rx_zerocopy_read_size.Increment(value);
+  }
+  void IncrementTcpZerocopySendThreshold(int value) {
+    data_.this_cpu().tcp_zerocopy_send_threshold.Increment(value);
+  }
+  void IncrementTcpZerocopyMaxInflightSends(int value) {
+    data_.this_cpu().tcp_zerocopy_max_inflight_sends.Increment(value);
+  }
+  void IncrementPollerBusyPollSpinTime(int value) {
+    data_.this_cpu().poller_busy_poll_spin_time.Increment(value);
+  }
+  void IncrementThreadPoolQueueDelay(int value) {
+    data_.this_cpu().thread_pool_queue_delay.Increment(value);
+  }
+  void IncrementHttp2FramesPerWrite(int value) {
+    data_.this_cpu().http2_frames_per_write.Increment(value);
+  }
+  void IncrementHttp2BytesPerWrite(int value) {
+    data_.this_cpu().http2_bytes_per_write.Increment(value);
+  }
+  void IncrementCompressionRatio(int value) {
+    data_.this_cpu().compression_ratio.Increment(value);
+  }
+  void IncrementCompressionTime(int value) {
+    data_.this_cpu().compression_time.Increment(value);
+  }
 
  private:
   friend class Http2StatsCollector;
@@ -754,6 +879,18 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> enobufs_count{0};
     std::atomic<uint64_t> uncommon_io_error_count{0};
     std::atomic<uint64_t> msg_errqueue_error_count{0};
+    std::atomic<uint64_t> tcp_server_connections_accepted{0};
+    std::atomic<uint64_t> tcp_zerocopy_send_enobufs{0};
+    std::atomic<uint64_t> poller_busy_poll_hits{0};
+    std::atomic<uint64_t> poller_busy_poll_parks{0};
+    std::atomic<uint64_t> thread_pool_steals{0};
+    std::atomic<uint64_t> thread_pool_cross_node_steals{0};
+    std::atomic<uint64_t> http2_idle_compactions{0};
+    std::atomic<uint64_t> http2_writes_coalesced{0};
+    std::atomic<uint64_t> compression_skipped_incompressible{0};
+    std::atomic<uint64_t> compression_skipped_cpu_busy{0};
+    std::atomic<uint64_t> slab_slabs_mapped{0};
+    std::atomic<uint64_t> slab_fallback_allocations{0};
     HistogramCollector_65536_26_64 call_initial_size;
     HistogramCollector_16777216_20_64 tcp_write_size;
     HistogramCollector_80_10_64 tcp_write_iov_size;
@@ -797,6 +934,17 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20_64 chaotic_good_tcp_read_offer_control;
     HistogramCollector_16777216_20_64 chaotic_good_tcp_write_size_data;
     HistogramCollector_16777216_20_64 chaotic_good_tcp_write_size_control;
+    HistogramCollector_10000_20_64 tcp_server_accepts_per_wakeup;
+    HistogramCollector_65536_26_64 tcp_server_accept_queue_depth;
+    HistogramCollector_16777216_20_64 tcp_rx_zerocopy_read_size;
+    HistogramCollector_16777216_20_64 tcp_zerocopy_send_threshold;
+    HistogramCollector_100_20_64 tcp_zerocopy_max_inflight_sends;
+    HistogramCollector_100000_20_64 poller_busy_poll_spin_time;
+    HistogramCollector_100000_20_64 thread_pool_queue_delay;
+    HistogramCollector_10000_20_64 http2_frames_per_write;
+    HistogramCollector_16777216_20_64 http2_bytes_per_write;
+    HistogramCollector_100_20_64 compression_ratio;
+    HistogramCollector_100000_20_64 compression_time;
   };
   PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
 };
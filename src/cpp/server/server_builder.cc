@@ -16,6 +16,7 @@
 //
 //
 
+#include <grpc/compression.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/channel_arg_names.h>
 #include <grpc/impl/compression_types.h>
@@ -98,9 +99,11 @@ ServerBuilder::ServerBuilder()
     plugins_.emplace_back(value());
   }
 
-  // all compression algorithms enabled by default.
+  // all supported compression algorithms enabled by default.
+  grpc_compression_options compression_options;
+  grpc_compression_options_init(&compression_options);
   enabled_compression_algorithms_bitset_ =
-      (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1;
+      compression_options.enabled_algorithms_bitset;
   memset(&maybe_default_compression_level_, 0,
          sizeof(maybe_default_compression_level_));
   memset(&maybe_default_compression_algorithm_, 0,
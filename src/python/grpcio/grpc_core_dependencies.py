@@ -133,6 +133,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/chttp2_plugin.cc',
     'src/core/ext/transport/chttp2/client/chttp2_connector.cc',
     'src/core/ext/transport/chttp2/server/chttp2_server.cc',
+    'src/core/ext/transport/chttp2/transport/base64_simd.cc',
     'src/core/ext/transport/chttp2/transport/bin_decoder.cc',
     'src/core/ext/transport/chttp2/transport/bin_encoder.cc',
     'src/core/ext/transport/chttp2/transport/call_tracer_wrapper.cc',
@@ -149,6 +150,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/frame_window_update.cc',
     'src/core/ext/transport/chttp2/transport/hpack_encoder.cc',
     'src/core/ext/transport/chttp2/transport/hpack_encoder_table.cc',
+    'src/core/ext/transport/chttp2/transport/hpack_interned_slices.cc',
     'src/core/ext/transport/chttp2/transport/hpack_parse_result.cc',
     'src/core/ext/transport/chttp2/transport/hpack_parser.cc',
     'src/core/ext/transport/chttp2/transport/hpack_parser_table.cc',
@@ -158,7 +160,9 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/ping_abuse_policy.cc',
     'src/core/ext/transport/chttp2/transport/ping_callbacks.cc',
     'src/core/ext/transport/chttp2/transport/ping_rate_policy.cc',
+    'src/core/ext/transport/chttp2/transport/read_ahead.cc',
     'src/core/ext/transport/chttp2/transport/stream_lists.cc',
+    'src/core/ext/transport/chttp2/transport/stream_priority.cc',
     'src/core/ext/transport/chttp2/transport/varint.cc',
     'src/core/ext/transport/chttp2/transport/write_size_policy.cc',
     'src/core/ext/transport/chttp2/transport/writing.cc',
@@ -508,9 +512,12 @@ CORE_SOURCE_FILES = [
     'src/core/lib/channel/channel_stack_builder_impl.cc',
     'src/core/lib/channel/connected_channel.cc',
     'src/core/lib/channel/promise_based_filter.cc',
+    'src/core/lib/compression/adaptive_compression.cc',
     'src/core/lib/compression/compression.cc',
     'src/core/lib/compression/compression_internal.cc',
     'src/core/lib/compression/message_compress.cc',
+    'src/core/lib/compression/streaming_compression.cc',
+    'src/core/lib/compression/zstd_compression.cc',
     'src/core/lib/debug/trace.cc',
     'src/core/lib/debug/trace_flags.cc',
     'src/core/lib/event_engine/ares_resolver.cc',
@@ -523,6 +530,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/forkable.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
     'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -537,6 +545,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
     'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+    'src/core/lib/event_engine/posix_engine/timing_wheel.cc',
     'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc',
@@ -547,6 +556,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/slice_buffer.cc',
     'src/core/lib/event_engine/tcp_socket_utils.cc',
     'src/core/lib/event_engine/thread_local.cc',
+    'src/core/lib/event_engine/thread_pool/numa_topology.cc',
     'src/core/lib/event_engine/thread_pool/thread_count.cc',
     'src/core/lib/event_engine/thread_pool/thread_pool_factory.cc',
     'src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.cc',
@@ -561,6 +571,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/windows/windows_engine.cc',
     'src/core/lib/event_engine/windows/windows_listener.cc',
     'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+    'src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc',
     'src/core/lib/experiments/config.cc',
     'src/core/lib/experiments/experiments.cc',
     'src/core/lib/iomgr/buffer_list.cc',
@@ -652,6 +663,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/security/authorization/rbac_policy.cc',
     'src/core/lib/security/authorization/stdout_logger.cc',
     'src/core/lib/slice/percent_encoding.cc',
+    'src/core/lib/slice/slab_allocator.cc',
     'src/core/lib/slice/slice.cc',
     'src/core/lib/slice/slice_buffer.cc',
     'src/core/lib/slice/slice_string_helpers.cc',
@@ -0,0 +1,126 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/compression/adaptive_compression.h"
+
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using Decision = AdaptiveCompressionPolicy::Decision;
+
+std::string RandomBytes(size_t length) {
+  std::mt19937 rng(42);
+  std::string out(length, '\0');
+  for (char& c : out) c = static_cast<char>(rng());
+  return out;
+}
+
+std::string Text(size_t length) {
+  std::string out;
+  while (out.size() < length) {
+    out += "the quick brown fox jumps over the lazy dog; ";
+  }
+  out.resize(length);
+  return out;
+}
+
+// Spreads data over slices of slice_length bytes.
+SliceBuffer Split(const std::string& data, size_t slice_length) {
+  SliceBuffer out;
+  for (size_t i = 0; i < data.size(); i += slice_length) {
+    out.Append(Slice::FromCopiedString(data.substr(i, slice_length)));
+  }
+  return out;
+}
+
+double Idle() { return 0.1; }
+double Busy() { return 0.95; }
+
+TEST(AdaptiveCompressionTest, EntropyOfKnownInputs) {
+  SliceBuffer empty;
+  EXPECT_EQ(EstimateEntropy(empty.c_slice_buffer()), 0);
+  SliceBuffer zeros = Split(std::string(10000, '\0'), 1000);
+  EXPECT_EQ(EstimateEntropy(zeros.c_slice_buffer()), 0);
+  SliceBuffer two = Split(std::string(100, 'a') + std::string(100, 'b'), 7);
+  EXPECT_DOUBLE_EQ(EstimateEntropy(two.c_slice_buffer()), 1);
+  SliceBuffer text = Split(Text(100000), 4096);
+  EXPECT_LT(EstimateEntropy(text.c_slice_buffer()), 5);
+  // Sampled, across slice boundaries.
+  for (size_t slice_length : {1, 13, 4096, 1 << 20}) {
+    SliceBuffer random = Split(RandomBytes(1 << 20), slice_length);
+    EXPECT_GT(EstimateEntropy(random.c_slice_buffer()),
+              AdaptiveCompressionPolicy::kMaxEntropy)
+        << slice_length;
+  }
+}
+
+TEST(AdaptiveCompressionTest, SkipsIncompressibleMessages) {
+  AdaptiveCompressionPolicy policy(Idle);
+  SliceBuffer random = Split(RandomBytes(10000), 1000);
+  EXPECT_EQ(policy.Decide(random.c_slice_buffer()),
+            Decision::kSkipIncompressible);
+  SliceBuffer text = Split(Text(10000), 1000);
+  EXPECT_EQ(policy.Decide(text.c_slice_buffer()), Decision::kCompress);
+  // Too short to be worth sampling.
+  SliceBuffer tiny = Split(RandomBytes(100), 1000);
+  EXPECT_EQ(policy.Decide(tiny.c_slice_buffer()), Decision::kCompress);
+}
+
+TEST(AdaptiveCompressionTest, BacksOffCallsThatDoNotShrink) {
+  AdaptiveCompressionPolicy policy(Idle);
+  SliceBuffer text = Split(Text(10000), 1000);
+  for (int i = 0; i < AdaptiveCompressionPolicy::kMaxMisses; i++) {
+    ASSERT_EQ(policy.Decide(text.c_slice_buffer()), Decision::kCompress);
+    policy.RecordResult(false);
+  }
+  for (int i = 1; i < AdaptiveCompressionPolicy::kProbeInterval; i++) {
+    EXPECT_EQ(policy.Decide(text.c_slice_buffer()),
+              Decision::kSkipIncompressible);
+  }
+  // The probe shrinks, so the call is back to normal.
+  EXPECT_EQ(policy.Decide(text.c_slice_buffer()), Decision::kCompress);
+  policy.RecordResult(true);
+  EXPECT_EQ(policy.Decide(text.c_slice_buffer()), Decision::kCompress);
+}
+
+TEST(AdaptiveCompressionTest, SkipsWhileCpuBusy) {
+  AdaptiveCompressionPolicy policy(Busy);
+  SliceBuffer text = Split(Text(10000), 1000);
+  EXPECT_EQ(policy.Decide(text.c_slice_buffer()), Decision::kSkipCpuBusy);
+}
+
+TEST(AdaptiveCompressionTest, ProcessCpuUtilizationInRange) {
+  const double utilization = ProcessCpuUtilization();
+  EXPECT_GE(utilization, 0);
+  EXPECT_LE(utilization, 1);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
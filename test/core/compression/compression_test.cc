@@ -25,18 +25,20 @@
 
 #include "absl/log/log.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/compression/zstd_compression.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/test_config.h"
 
 TEST(CompressionTest, CompressionAlgorithmParse) {
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD,
   };
-  const char* invalid_names[] = {"gzip2", "foo", "", "2gzip"};
+  const char* invalid_names[] = {"gzip2", "foo", "", "2gzip", "zstd "};
 
   VLOG(2) << "test_compression_algorithm_parse";
 
@@ -64,11 +66,12 @@ TEST(CompressionTest, CompressionAlgorithmName) {
   int success;
   const char* name;
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD,
   };
 
   VLOG(2) << "test_compression_algorithm_name";
@@ -203,6 +206,27 @@ TEST(CompressionTest, CompressionAlgorithmForLevel) {
               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
                                                    accepted_encodings));
   }
+
+  {
+    // accept zstd too: levels never map to it
+    uint32_t accepted_encodings = 0;
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_NONE);  // always
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_GZIP);
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_DEFLATE);
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_ZSTD);
+
+    ASSERT_EQ(GRPC_COMPRESS_GZIP,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_LOW,
+                                                   accepted_encodings));
+
+    ASSERT_EQ(GRPC_COMPRESS_DEFLATE,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_MED,
+                                                   accepted_encodings));
+
+    ASSERT_EQ(GRPC_COMPRESS_DEFLATE,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
+                                                   accepted_encodings));
+  }
 }
 
 TEST(CompressionTest, CompressionEnableDisableAlgorithm) {
@@ -216,9 +240,12 @@ TEST(CompressionTest, CompressionEnableDisableAlgorithm) {
        algorithm < GRPC_COMPRESS_ALGORITHMS_COUNT;
        algorithm = static_cast<grpc_compression_algorithm>(
            static_cast<int>(algorithm) + 1)) {
-    // all algorithms are enabled by default
-    ASSERT_NE(
-        grpc_compression_options_is_algorithm_enabled(&options, algorithm), 0);
+    // all algorithms the build supports are enabled by default
+    const bool supported =
+        algorithm != GRPC_COMPRESS_ZSTD || grpc_core::kZstdSupported;
+    ASSERT_EQ(
+        grpc_compression_options_is_algorithm_enabled(&options, algorithm) != 0,
+        supported);
   }
   // disable one by one
   for (algorithm = GRPC_COMPRESS_NONE;
@@ -53,5 +53,5 @@ void CheckCompresses(grpc_compression_algorithm compression_algorithm,
 }
 FUZZ_TEST(MyTestSuite, CheckCompresses)
     .WithDomains(ElementOf({GRPC_COMPRESS_NONE, GRPC_COMPRESS_DEFLATE,
-                            GRPC_COMPRESS_GZIP}),
+                            GRPC_COMPRESS_GZIP, GRPC_COMPRESS_ZSTD}),
                  VectorOf(Arbitrary<uint8_t>()).WithMinSize(1));
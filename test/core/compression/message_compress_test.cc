@@ -25,14 +25,23 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/compression/zstd_compression.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/slice_splitter.h"
 #include "test/core/test_util/test_config.h"
 
+#ifdef GRPC_HAVE_ZSTD
+#include <zdict.h>
+#endif
+
 typedef enum { ONE_A = 0, ONE_KB_A, ONE_MB_A, TEST_VALUE_COUNT } test_value;
 
 typedef enum {
@@ -113,6 +122,9 @@ static grpc_slice repeated(char c, size_t length) {
 static compressability get_compressability(
     test_value id, grpc_compression_algorithm algorithm) {
   if (algorithm == GRPC_COMPRESS_NONE) return SHOULD_NOT_COMPRESS;
+  if (algorithm == GRPC_COMPRESS_ZSTD && !grpc_core::kZstdSupported) {
+    return SHOULD_NOT_COMPRESS;
+  }
   switch (id) {
     case ONE_A:
       return SHOULD_NOT_COMPRESS;
@@ -300,6 +312,335 @@ TEST(MessageCompressTest, BadDecompressionAlgorithm) {
   grpc_slice_buffer_destroy(&output);
 }
 
+static std::string flatten(const grpc_slice_buffer* buffer) {
+  std::string out;
+  for (size_t i = 0; i < buffer->count; i++) {
+    out.append(
+        reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(buffer->slices[i])),
+        GRPC_SLICE_LENGTH(buffer->slices[i]));
+  }
+  return out;
+}
+
+// Compresses and decompresses the same messages one call would carry, split
+// into one byte slices on both sides.
+static void streaming_round_trip(grpc_compression_algorithm algorithm,
+                                 bool context_takeover) {
+  grpc_core::MessageCompressionOptions options;
+  options.context_takeover = context_takeover;
+  auto compressor = grpc_core::MakeStreamingCompressor(algorithm, options);
+  auto decompressor = grpc_core::MakeStreamingDecompressor(algorithm, options);
+  if (algorithm == GRPC_COMPRESS_ZSTD && !grpc_core::kZstdSupported) {
+    EXPECT_EQ(compressor, nullptr);
+    EXPECT_EQ(decompressor, nullptr);
+    return;
+  }
+  ASSERT_NE(compressor, nullptr);
+  ASSERT_NE(decompressor, nullptr);
+  size_t previous_length = 0;
+  for (int i = 0; i < 4; i++) {
+    // Too short to compress on its own, except at the second go with context
+    // takeover; then long enough to need several output blocks.
+    const std::string message =
+        i < 2 ? "hello hello world"
+              : std::string(3 * grpc_core::PooledSliceWriter::kMaxBlockSize +
+                                i,
+                            'a' + i);
+    grpc_slice_buffer input;
+    grpc_slice_buffer split;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&split);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&input, grpc_slice_from_copied_buffer(
+                                      message.data(), message.size()));
+    grpc_split_slice_buffer(GRPC_SLICE_SPLIT_ONE_BYTE, &input, &split);
+    if (!compressor->Compress(&split, &compressed)) {
+      // Only without context takeover, and only when it would not pay.
+      EXPECT_FALSE(context_takeover);
+      EXPECT_EQ(compressed.length, 0);
+      EXPECT_LT(i, 2);
+    } else {
+      if (context_takeover && i == 1) {
+        EXPECT_LT(compressed.length, previous_length);
+      }
+      previous_length = compressed.length;
+      grpc_slice_buffer_reset_and_unref(&split);
+      grpc_split_slice_buffer(GRPC_SLICE_SPLIT_ONE_BYTE, &compressed, &split);
+      ASSERT_TRUE(decompressor->Decompress(&split, &output))
+          << "algorithm " << algorithm;
+      EXPECT_EQ(flatten(&output), message);
+    }
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&split);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+}
+
+TEST(MessageCompressTest, StreamingRoundTrip) {
+  grpc_core::ExecCtx exec_ctx;
+  for (int i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    const auto algorithm = static_cast<grpc_compression_algorithm>(i);
+    if (algorithm == GRPC_COMPRESS_NONE) {
+      EXPECT_EQ(grpc_core::MakeStreamingCompressor(
+                    algorithm, grpc_core::MessageCompressionOptions()),
+                nullptr);
+      continue;
+    }
+    streaming_round_trip(algorithm, false);
+    streaming_round_trip(algorithm, true);
+  }
+}
+
+TEST(MessageCompressTest, StreamingContextTakeoverNeedsHistory) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::MessageCompressionOptions options;
+  options.context_takeover = true;
+  auto compressor =
+      grpc_core::MakeStreamingCompressor(GRPC_COMPRESS_DEFLATE, options);
+  grpc_slice_buffer input;
+  grpc_slice_buffer first;
+  grpc_slice_buffer second;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&first);
+  grpc_slice_buffer_init(&second);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+  ASSERT_TRUE(compressor->Compress(&input, &first));
+  ASSERT_TRUE(compressor->Compress(&input, &second));
+
+  // A decompressor that missed the first message cannot decode the second,
+  // and stays broken.
+  auto decompressor =
+      grpc_core::MakeStreamingDecompressor(GRPC_COMPRESS_DEFLATE, options);
+  EXPECT_FALSE(decompressor->Decompress(&second, &output));
+  EXPECT_EQ(output.length, 0);
+  EXPECT_FALSE(decompressor->Decompress(&first, &output));
+  EXPECT_EQ(output.length, 0);
+
+  // Nor can one that expects self-contained messages.
+  decompressor = grpc_core::MakeStreamingDecompressor(
+      GRPC_COMPRESS_DEFLATE, grpc_core::MessageCompressionOptions());
+  EXPECT_FALSE(decompressor->Decompress(&first, &output));
+  EXPECT_EQ(output.length, 0);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&first);
+  grpc_slice_buffer_destroy(&second);
+  grpc_slice_buffer_destroy(&output);
+}
+
+TEST(MessageCompressTest, PooledSliceWriterSharesBlocks) {
+  grpc_core::PooledSliceWriter writer;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&output);
+  for (char c : {'x', 'y'}) {
+    memset(writer.data(), c, 100);
+    writer.Commit(100);
+    EXPECT_EQ(writer.written(), 100);
+    writer.Finish(&output);
+    EXPECT_EQ(writer.written(), 0);
+  }
+  // Abandoned output is never handed out.
+  memset(writer.data(), 'z', 100);
+  writer.Commit(100);
+  writer.Abandon();
+  EXPECT_EQ(flatten(&output), std::string(100, 'x') + std::string(100, 'y'));
+  // Both came from the same block, back to back, so the slice buffer merged
+  // them.
+  EXPECT_EQ(output.count, 1);
+
+  // Outputs spanning blocks come out as one slice per block.
+  size_t length = 0;
+  while (length < grpc_core::PooledSliceWriter::kMaxBlockSize) {
+    const size_t n = writer.available();
+    memset(writer.data(), 'w', n);
+    writer.Commit(n);
+    length += n;
+  }
+  grpc_slice_buffer_reset_and_unref(&output);
+  writer.Finish(&output);
+  EXPECT_EQ(output.length, length);
+  EXPECT_GT(output.count, 1);
+  // The large block it ended in is not shared with the next output.
+  EXPECT_EQ(writer.block_size(), 0);
+  writer.available();
+  EXPECT_EQ(writer.block_size(), grpc_core::PooledSliceWriter::kMinBlockSize);
+
+  // A large output that ends early in its last block is copied out of it.
+  grpc_slice_buffer_reset_and_unref(&output);
+  while (writer.block_size() < grpc_core::PooledSliceWriter::kMaxBlockSize) {
+    const size_t n = writer.available();
+    memset(writer.data(), 'v', n);
+    writer.Commit(n);
+    writer.available();
+  }
+  memset(writer.data(), 'v', 100);
+  writer.Commit(100);
+  length = writer.written();
+  writer.Finish(&output);
+  EXPECT_EQ(flatten(&output), std::string(length, 'v'));
+  EXPECT_EQ(writer.block_size(), 0);
+
+  grpc_slice_buffer_destroy(&output);
+}
+
+#ifdef GRPC_HAVE_ZSTD
+
+// A small, repetitive message, like the protos dictionaries are meant for.
+static std::string sample_message(int i) {
+  return absl::StrCat("{\"user_id\":", i * 7919, ",\"name\":\"customer-", i,
+                      "\",\"region\":\"us-east-1\",\"status\":\"ACTIVE\"}");
+}
+
+static std::string train_dictionary() {
+  std::string samples;
+  std::vector<size_t> sizes;
+  for (int i = 0; i < 2000; i++) {
+    std::string sample = sample_message(i);
+    samples += sample;
+    sizes.push_back(sample.size());
+  }
+  std::string dictionary(4096, '\0');
+  size_t size =
+      ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+                            samples.data(), sizes.data(), sizes.size());
+  CHECK(!ZDICT_isError(size)) << ZDICT_getErrorName(size);
+  dictionary.resize(size);
+  return dictionary;
+}
+
+TEST(MessageCompressTest, ZstdDictionary) {
+  auto dictionaries = grpc_core::MakeRefCounted<grpc_core::ZstdDictionaries>();
+  ASSERT_TRUE(dictionaries->Add("/pkg.Users/", train_dictionary()).ok());
+  const grpc_core::ZstdDictionary* dictionary =
+      dictionaries->ForPath("/pkg.Users/Get");
+  ASSERT_NE(dictionary, nullptr);
+  EXPECT_EQ(dictionaries->ForPath("/pkg.Orders/Get"), nullptr);
+  EXPECT_EQ(dictionaries->ForId(dictionary->id()), dictionary);
+
+  const std::string message = sample_message(123456);
+  grpc_slice_buffer input;
+  grpc_slice_buffer plain;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&plain);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, grpc_slice_from_copied_buffer(
+                                    message.data(), message.size()));
+
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::MessageCompressionOptions options;
+  options.zstd_dictionary = dictionary;
+  ASSERT_EQ(1, grpc_msg_compress(GRPC_COMPRESS_ZSTD, options, &input,
+                                 &compressed));
+  // Too short for zstd to do much on its own.
+  grpc_msg_compress(GRPC_COMPRESS_ZSTD, &input, &plain);
+  EXPECT_LT(compressed.length * 2, plain.length);
+
+  // The receiver needs the dictionary.
+  ASSERT_EQ(0, grpc_msg_decompress(GRPC_COMPRESS_ZSTD, &compressed, &output));
+  EXPECT_EQ(output.length, 0);
+  options = grpc_core::MessageCompressionOptions();
+  options.zstd_dictionaries = dictionaries.get();
+  ASSERT_EQ(1, grpc_msg_decompress(GRPC_COMPRESS_ZSTD, options, &compressed,
+                                   &output));
+  EXPECT_EQ(flatten(&output), message);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&plain);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
+TEST(MessageCompressTest, ZstdDictionaryPrefixes) {
+  const std::string dictionary = train_dictionary();
+  auto dictionaries = grpc_core::MakeRefCounted<grpc_core::ZstdDictionaries>();
+  ASSERT_TRUE(dictionaries->Add("/pkg.", dictionary).ok());
+  // The same dictionary may serve several prefixes...
+  ASSERT_TRUE(dictionaries->Add("/pkg.Users/", dictionary).ok());
+  // ...but each prefix gets one.
+  EXPECT_FALSE(dictionaries->Add("/pkg.Users/", dictionary).ok());
+  EXPECT_NE(dictionaries->ForPath("/pkg.Users/Get"), nullptr);
+  EXPECT_NE(dictionaries->ForPath("/pkg.Orders/Get"), nullptr);
+  EXPECT_EQ(dictionaries->ForPath("/other.Users/Get"), nullptr);
+  EXPECT_FALSE(dictionaries->Add("/raw/", "not a dictionary").ok());
+}
+
+TEST(MessageCompressTest, ZstdDictionaryIdList) {
+  auto dictionaries = grpc_core::MakeRefCounted<grpc_core::ZstdDictionaries>();
+  EXPECT_EQ(dictionaries->IdList(), "");
+  ASSERT_TRUE(dictionaries->Add("/pkg.", train_dictionary()).ok());
+  const uint32_t id = dictionaries->ForPath("/pkg.Users/Get")->id();
+  EXPECT_EQ(dictionaries->IdList(), absl::StrCat(id));
+}
+
+TEST(MessageCompressTest, ZstdBadData) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer garbage;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&garbage);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  ASSERT_EQ(1, grpc_msg_compress(GRPC_COMPRESS_ZSTD, &input, &compressed));
+  grpc_slice_buffer_trim_end(&compressed, 1, &garbage);
+  ASSERT_EQ(0, grpc_msg_decompress(GRPC_COMPRESS_ZSTD, &compressed, &output));
+  EXPECT_EQ(output.length, 0);
+  grpc_slice_buffer_add(&compressed, grpc_slice_ref(garbage.slices[0]));
+  grpc_slice_buffer_add(&compressed, grpc_slice_from_copied_string("x"));
+  ASSERT_EQ(0, grpc_msg_decompress(GRPC_COMPRESS_ZSTD, &compressed, &output));
+  EXPECT_EQ(output.length, 0);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&garbage);
+  grpc_slice_buffer_destroy(&output);
+}
+
+#else  // GRPC_HAVE_ZSTD
+
+TEST(MessageCompressTest, ZstdUnavailable) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  // Falls back to sending the message as is.
+  ASSERT_EQ(0, grpc_msg_compress(GRPC_COMPRESS_ZSTD, &input, &output));
+  EXPECT_EQ(flatten(&output), flatten(&input));
+  grpc_slice_buffer_reset_and_unref(&output);
+  ASSERT_EQ(0, grpc_msg_decompress(GRPC_COMPRESS_ZSTD, &input, &output));
+  EXPECT_EQ(output.length, 0);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&output);
+}
+
+#endif  // GRPC_HAVE_ZSTD
+
+TEST(MessageCompressTest, ZstdDictionaryIdListContains) {
+  using grpc_core::ZstdDictionaries;
+  EXPECT_TRUE(ZstdDictionaries::IdListContains("12", 12));
+  EXPECT_TRUE(ZstdDictionaries::IdListContains("7, 12,4000000000", 12));
+  EXPECT_TRUE(ZstdDictionaries::IdListContains("7,12,4000000000", 4000000000));
+  EXPECT_FALSE(ZstdDictionaries::IdListContains("", 12));
+  EXPECT_FALSE(ZstdDictionaries::IdListContains("1,2,123", 12));
+  EXPECT_FALSE(ZstdDictionaries::IdListContains("12x", 12));
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -52,5 +52,5 @@ void CheckDecompresses(grpc_compression_algorithm compression_algorithm,
 }
 FUZZ_TEST(MyTestSuite, CheckDecompresses)
     .WithDomains(ElementOf({GRPC_COMPRESS_NONE, GRPC_COMPRESS_DEFLATE,
-                            GRPC_COMPRESS_GZIP}),
+                            GRPC_COMPRESS_GZIP, GRPC_COMPRESS_ZSTD}),
                  VectorOf(Arbitrary<uint8_t>()).WithMinSize(1));
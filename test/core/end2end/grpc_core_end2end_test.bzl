@@ -69,6 +69,7 @@ _DEPS = [
     "//src/core:grpc_authorization_base",
     "//src/core:grpc_fake_credentials",
     "//src/core:endpoint_transport",
+    "//src/core:internal_channel_arg_names",
     "//src/core:iomgr_port",
     "//src/core:json",
     "//src/core:lb_policy",
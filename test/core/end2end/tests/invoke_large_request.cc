@@ -23,6 +23,7 @@
 #include <memory>
 
 #include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/internal_channel_arg_names.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/util/time.h"
@@ -31,15 +32,13 @@
 namespace grpc_core {
 namespace {
 
-CORE_END2END_TEST(Http2SingleHopTests, InvokeLargeRequest) {
+void InvokeLargeRequestBody(CoreEnd2endTest& test, const ChannelArgs& args) {
   const size_t kMessageSize = 10 * 1024 * 1024;
   auto send_from_client = RandomSlice(kMessageSize);
   auto send_from_server = RandomSlice(kMessageSize);
-  InitServer(
-      ChannelArgs().Set(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, kMessageSize));
-  InitClient(
-      ChannelArgs().Set(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, kMessageSize));
-  auto c = NewClientCall("/foo").Timeout(Duration::Minutes(5)).Create();
+  test.InitServer(args.Set(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, kMessageSize));
+  test.InitClient(args.Set(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, kMessageSize));
+  auto c = test.NewClientCall("/foo").Timeout(Duration::Minutes(5)).Create();
   IncomingStatusOnClient server_status;
   IncomingMetadata server_initial_metadata;
   IncomingMessage server_message;
@@ -50,21 +49,21 @@ CORE_END2END_TEST(Http2SingleHopTests, InvokeLargeRequest) {
       .RecvInitialMetadata(server_initial_metadata)
       .RecvMessage(server_message)
       .RecvStatusOnClient(server_status);
-  auto s = RequestCall(101);
-  Expect(101, true);
-  Step(Duration::Minutes(1));
+  auto s = test.RequestCall(101);
+  test.Expect(101, true);
+  test.Step(Duration::Minutes(1));
   IncomingMessage client_message;
   s.NewBatch(102).SendInitialMetadata({}).RecvMessage(client_message);
-  Expect(102, true);
-  Step(Duration::Minutes(1));
+  test.Expect(102, true);
+  test.Step(Duration::Minutes(1));
   IncomingCloseOnServer client_close;
   s.NewBatch(103)
       .SendStatusFromServer(GRPC_STATUS_UNIMPLEMENTED, "xyz", {})
       .SendMessage(send_from_server.Ref())
       .RecvCloseOnServer(client_close);
-  Expect(103, true);
-  Expect(1, true);
-  Step(Duration::Minutes(1));
+  test.Expect(103, true);
+  test.Expect(1, true);
+  test.Step(Duration::Minutes(1));
   EXPECT_EQ(server_status.status(), GRPC_STATUS_UNIMPLEMENTED);
   EXPECT_EQ(server_status.message(), "xyz");
   EXPECT_EQ(s.method(), "/foo");
@@ -73,5 +72,16 @@ CORE_END2END_TEST(Http2SingleHopTests, InvokeLargeRequest) {
   EXPECT_EQ(server_message.payload(), send_from_server);
 }
 
+CORE_END2END_TEST(Http2SingleHopTests, InvokeLargeRequest) {
+  InvokeLargeRequestBody(*this, ChannelArgs());
+}
+
+// The 10MB messages take many endpoint reads, some of which complete while the
+// previous one is still being parsed and some after.
+CORE_END2END_TEST(Http2SingleHopTests, InvokeLargeRequestWithReadAhead) {
+  InvokeLargeRequestBody(*this,
+                         ChannelArgs().Set(GRPC_ARG_HTTP2_READ_AHEAD, true));
+}
+
 }  // namespace
 }  // namespace grpc_core
@@ -20,8 +20,13 @@
 #include <grpc/status.h>
 
 #include <memory>
+#include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/time.h"
 #include "test/core/end2end/end2end_tests.h"
 
@@ -79,4 +84,61 @@ CORE_END2END_TEST(WriteBufferingTests, WriteBufferingWorks) {
   EXPECT_EQ(request_payload_recv1.payload(), "hello world");
   EXPECT_EQ(request_payload_recv2.payload(), "abc123");
 }
+
+// Small writes of concurrent calls are held back to be coalesced, and every
+// call still completes.
+CORE_END2END_TEST(Http2SingleHopTests, WriteCoalescingCompletesConcurrentCalls) {
+  const auto args =
+      ChannelArgs().Set("grpc.http2.write_coalescing_max_delay_ms", 20);
+  InitServer(args);
+  InitClient(args);
+  auto before = global_stats().Collect();
+  constexpr int kCalls = 4;
+  std::vector<Call> client_calls;
+  client_calls.reserve(kCalls);
+  IncomingMetadata server_initial_metadata[kCalls];
+  IncomingMessage server_message[kCalls];
+  IncomingStatusOnClient server_status[kCalls];
+  for (int i = 0; i < kCalls; i++) {
+    client_calls.emplace_back(NewClientCall(absl::StrCat("/call", i))
+                                  .Timeout(Duration::Minutes(1))
+                                  .Create());
+    client_calls[i]
+        .NewBatch(1 + i)
+        .SendInitialMetadata({})
+        .SendMessage(absl::StrCat("request ", i))
+        .SendCloseFromClient()
+        .RecvInitialMetadata(server_initial_metadata[i])
+        .RecvMessage(server_message[i])
+        .RecvStatusOnClient(server_status[i]);
+  }
+  for (int i = 0; i < kCalls; i++) {
+    auto s = RequestCall(101 + i);
+    Expect(101 + i, true);
+    Step();
+    // Calls reach the server in any order: "/callN" was started by client
+    // call N.
+    const int client_index = s.method().back() - '0';
+    IncomingMessage client_message;
+    s.NewBatch(201 + i).SendInitialMetadata({}).RecvMessage(client_message);
+    Expect(201 + i, true);
+    Step();
+    EXPECT_EQ(client_message.payload(), absl::StrCat("request ", client_index));
+    IncomingCloseOnServer client_close;
+    s.NewBatch(301 + i)
+        .RecvCloseOnServer(client_close)
+        .SendMessage(absl::StrCat("response ", client_index))
+        .SendStatusFromServer(GRPC_STATUS_OK, "xyz", {});
+    Expect(301 + i, true);
+    Expect(1 + client_index, true);
+    Step();
+    EXPECT_FALSE(client_close.was_cancelled());
+  }
+  for (int i = 0; i < kCalls; i++) {
+    EXPECT_EQ(server_status[i].status(), GRPC_STATUS_OK);
+    EXPECT_EQ(server_message[i].payload(), absl::StrCat("response ", i));
+  }
+  auto diff = global_stats().Collect()->Diff(*before);
+  EXPECT_GT(diff->http2_writes_coalesced, 0u);
+}
 }  // namespace grpc_core
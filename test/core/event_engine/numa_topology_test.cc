@@ -0,0 +1,202 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "test/core/test_util/test_config.h"
+
+#ifdef GPR_LINUX
+#include <sched.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::Optional;
+
+TEST(ParseCpuListTest, ParsesSingleIds) {
+  EXPECT_THAT(ParseCpuList("0"), Optional(ElementsAre(0)));
+  EXPECT_THAT(ParseCpuList("1,5,7"), Optional(ElementsAre(1, 5, 7)));
+}
+
+TEST(ParseCpuListTest, ParsesRanges) {
+  EXPECT_THAT(ParseCpuList("0-3"), Optional(ElementsAre(0, 1, 2, 3)));
+  EXPECT_THAT(ParseCpuList("0-1,8,10-11"),
+              Optional(ElementsAre(0, 1, 8, 10, 11)));
+}
+
+TEST(ParseCpuListTest, ParsesEmptyList) {
+  EXPECT_THAT(ParseCpuList(""), Optional(IsEmpty()));
+}
+
+TEST(ParseCpuListTest, RejectsMalformedLists) {
+  EXPECT_EQ(ParseCpuList("a"), std::nullopt);
+  EXPECT_EQ(ParseCpuList("1,,2"), std::nullopt);
+  EXPECT_EQ(ParseCpuList("3-1"), std::nullopt);
+  EXPECT_EQ(ParseCpuList("1-"), std::nullopt);
+  EXPECT_EQ(ParseCpuList("-1"), std::nullopt);
+  EXPECT_EQ(ParseCpuList("0-100000000"), std::nullopt);
+}
+
+TEST(NumaTopologyTest, SingleNodeHoldsEveryCpu) {
+  NumaTopology topology = NumaTopology::SingleNode();
+  ASSERT_EQ(topology.num_nodes(), 1);
+  EXPECT_EQ(topology.cpus(0).size(), gpr_cpu_num_cores());
+  EXPECT_EQ(topology.CurrentNode(), 0);
+}
+
+TEST(NumaTopologyTest, CurrentNodeIsValid) {
+  const NumaTopology& topology = NumaTopology::Get();
+  ASSERT_GE(topology.num_nodes(), 1);
+  EXPECT_LT(topology.CurrentNode(), topology.num_nodes());
+}
+
+#ifdef GPR_LINUX
+
+class FakeSysfs {
+ public:
+  FakeSysfs()
+      : dir_(absl::StrCat(::testing::TempDir(), "/numa_topology_test_",
+                          getpid(), "_", next_id_++)) {
+    mkdir(dir_.c_str(), 0755);
+  }
+
+  const std::string& dir() const { return dir_; }
+
+  void SetOnline(absl::string_view online) {
+    WriteFile(absl::StrCat(dir_, "/online"), online);
+  }
+
+  void AddNode(int node, absl::string_view cpu_list) {
+    std::string node_dir = absl::StrCat(dir_, "/node", node);
+    mkdir(node_dir.c_str(), 0755);
+    WriteFile(absl::StrCat(node_dir, "/cpulist"), cpu_list);
+  }
+
+ private:
+  static void WriteFile(const std::string& path, absl::string_view contents) {
+    FILE* fp = fopen(path.c_str(), "w");
+    ASSERT_NE(fp, nullptr) << path;
+    fprintf(fp, "%.*s\n", static_cast<int>(contents.size()), contents.data());
+    fclose(fp);
+  }
+
+  static int next_id_;
+  const std::string dir_;
+};
+
+int FakeSysfs::next_id_ = 0;
+
+TEST(NumaTopologyTest, ReadsNodesFromSysfs) {
+  FakeSysfs sysfs;
+  sysfs.SetOnline("0-1");
+  sysfs.AddNode(0, "0-1,4-5");
+  sysfs.AddNode(1, "2-3,6-7");
+  NumaTopology topology = NumaTopology::FromSysfs(sysfs.dir());
+  ASSERT_EQ(topology.num_nodes(), 2);
+  EXPECT_THAT(topology.cpus(0), ElementsAre(0, 1, 4, 5));
+  EXPECT_THAT(topology.cpus(1), ElementsAre(2, 3, 6, 7));
+  EXPECT_EQ(topology.NodeOfCpu(4), 0);
+  EXPECT_EQ(topology.NodeOfCpu(6), 1);
+  EXPECT_EQ(topology.NodeOfCpu(100), 0);
+}
+
+TEST(NumaTopologyTest, SkipsNodesWithoutCpus) {
+  FakeSysfs sysfs;
+  sysfs.SetOnline("0,2-3");
+  sysfs.AddNode(0, "0-3");
+  // Memory-only node.
+  sysfs.AddNode(2, "");
+  sysfs.AddNode(3, "4-7");
+  NumaTopology topology = NumaTopology::FromSysfs(sysfs.dir());
+  ASSERT_EQ(topology.num_nodes(), 2);
+  EXPECT_THAT(topology.cpus(1), ElementsAre(4, 5, 6, 7));
+  EXPECT_EQ(topology.NodeOfCpu(5), 1);
+}
+
+TEST(NumaTopologyTest, BindingKeepsExistingAffinity) {
+  cpu_set_t original;
+  ASSERT_EQ(sched_getaffinity(0, sizeof(original), &original), 0);
+  // The first CPU the thread may run on, and one it may not.
+  int allowed = -1;
+  int disallowed = -1;
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &original)) {
+      if (allowed < 0) allowed = cpu;
+    } else if (disallowed < 0) {
+      disallowed = cpu;
+    }
+  }
+  ASSERT_GE(allowed, 0);
+  ASSERT_GE(disallowed, 0);
+  // Allow only one CPU, as taskset would.
+  cpu_set_t restricted;
+  CPU_ZERO(&restricted);
+  CPU_SET(allowed, &restricted);
+  ASSERT_EQ(sched_setaffinity(0, sizeof(restricted), &restricted), 0);
+  FakeSysfs sysfs;
+  sysfs.SetOnline("0-1");
+  sysfs.AddNode(0, absl::StrCat(std::min(allowed, disallowed), ",",
+                                std::max(allowed, disallowed)));
+  sysfs.AddNode(1, absl::StrCat(disallowed));
+  NumaTopology topology = NumaTopology::FromSysfs(sysfs.dir());
+  ASSERT_EQ(topology.num_nodes(), 2);
+  // Binding to node 0 keeps the thread on the CPU it was restricted to,
+  // rather than widening its affinity to the whole node.
+  EXPECT_TRUE(topology.BindCurrentThreadToNode(0));
+  cpu_set_t bound;
+  ASSERT_EQ(sched_getaffinity(0, sizeof(bound), &bound), 0);
+  EXPECT_TRUE(CPU_EQUAL(&bound, &restricted));
+  // The thread may not run on node 1 at all, so it is left alone.
+  EXPECT_FALSE(topology.BindCurrentThreadToNode(1));
+  ASSERT_EQ(sched_getaffinity(0, sizeof(bound), &bound), 0);
+  EXPECT_TRUE(CPU_EQUAL(&bound, &restricted));
+  ASSERT_EQ(sched_setaffinity(0, sizeof(original), &original), 0);
+}
+
+TEST(NumaTopologyTest, FallsBackToSingleNode) {
+  FakeSysfs missing;
+  EXPECT_EQ(NumaTopology::FromSysfs(missing.dir()).num_nodes(), 1);
+  FakeSysfs malformed;
+  malformed.SetOnline("zero");
+  EXPECT_EQ(NumaTopology::FromSysfs(malformed.dir()).num_nodes(), 1);
+}
+
+#endif  // GPR_LINUX
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -21,6 +21,7 @@
 #include <chrono>
 #include <cstring>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "absl/status/statusor.h"
@@ -55,10 +56,13 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/dual_ref_counted.h"
 #include "src/core/util/notification.h"
@@ -371,13 +375,20 @@ void WaitAndShutdown(server* sv, client* cl) {
   gpr_mu_unlock(&g_mu);
 }
 
-class EventPollerTest : public ::testing::Test {
+// Runs each test with the poller picked by GRPC_POLL_STRATEGY, and again with
+// the io_uring poller, which is opt-in and never picked by default.
+class EventPollerTest : public ::testing::TestWithParam<absl::string_view> {
   void SetUp() override {
     engine_ = PosixEventEngine::MakePosixEventEngine();
     EXPECT_NE(engine_, nullptr);
     scheduler_ = std::make_unique<TestScheduler>(engine_.get());
     EXPECT_NE(scheduler_, nullptr);
-    g_event_poller = MakeDefaultPoller(scheduler_.get());
+    if (GetParam() == "io_uring") {
+      // Null if the kernel does not support it, which skips the test.
+      g_event_poller = MakeIoUringPoller(scheduler_.get());
+    } else {
+      g_event_poller = MakeDefaultPoller(scheduler_.get());
+    }
     engine_ = PosixEventEngine::MakeTestOnlyPosixEventEngine(g_event_poller);
     EXPECT_NE(engine_, nullptr);
     scheduler_->ChangeCurrentEventEngine(engine_.get());
@@ -403,7 +414,7 @@ class EventPollerTest : public ::testing::Test {
 // Test grpc_fd. Start an upload server and client, upload a stream of bytes
 // from the client to the server, and verify that the total number of sent
 // bytes is equal to the total number of received bytes.
-TEST_F(EventPollerTest, TestEventPollerHandle) {
+TEST_P(EventPollerTest, TestEventPollerHandle) {
   server sv;
   client cl;
   int port;
@@ -445,7 +456,7 @@ void SecondReadCallback(FdChangeData* fdc, absl::Status /*status*/) {
 // Note that we have two different but almost identical callbacks above -- the
 // point is to have two different function pointers and two different data
 // pointers and make sure that changing both really works.
-TEST_F(EventPollerTest, TestEventPollerHandleChange) {
+TEST_P(EventPollerTest, TestEventPollerHandleChange) {
   EventHandle* em_fd;
   FdChangeData a, b;
   int flags;
@@ -682,7 +693,7 @@ class Worker : public grpc_core::DualRefCounted<Worker> {
 // immediately and schedule the wait for the next read event. A new read event
 // is also generated for each fd in parallel after the previous one is
 // processed.
-TEST_F(EventPollerTest, TestMultipleHandles) {
+TEST_P(EventPollerTest, TestMultipleHandles) {
   static constexpr int kNumHandles = 100;
   static constexpr int kNumWakeupsPerHandle = 100;
   if (g_event_poller == nullptr) {
@@ -694,6 +705,103 @@ TEST_F(EventPollerTest, TestMultipleHandles) {
   worker->Wait();
 }
 
+// An idle poller waits out the whole timeout: neither its own wakeup fd nor
+// anything else reports a kick until Kick() is called.
+TEST_P(EventPollerTest, IdlePollerDoesNotSpin) {
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(g_event_poller->Work(50ms, []() {}),
+              Poller::WorkResult::kDeadlineExceeded);
+  }
+  g_event_poller->Kick();
+  EXPECT_EQ(g_event_poller->Work(24h, []() {}), Poller::WorkResult::kKicked);
+  EXPECT_EQ(g_event_poller->Work(50ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+}
+
+// Busy polling spins only while a request for it is outstanding. Only epoll1
+// busy polls.
+TEST_P(EventPollerTest, BusyPollingFollowsRequests) {
+  if (g_event_poller == nullptr || g_event_poller->Name() != "epoll1") {
+    return;
+  }
+  // Every idle Work() that spun before blocking counts as a park.
+  auto parks = []() {
+    return grpc_core::global_stats().Collect()->poller_busy_poll_parks;
+  };
+  const uint64_t initial_parks = parks();
+  EXPECT_EQ(g_event_poller->Work(20ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  EXPECT_EQ(parks(), initial_parks);
+  g_event_poller->RequestBusyPolling(5ms);
+  g_event_poller->RequestBusyPolling(1ms);
+  EXPECT_EQ(g_event_poller->Work(20ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  EXPECT_EQ(parks(), initial_parks + 1);
+  // One request is still outstanding.
+  g_event_poller->ReleaseBusyPolling(5ms);
+  EXPECT_EQ(g_event_poller->Work(20ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  EXPECT_EQ(parks(), initial_parks + 2);
+  // With none left, Work() blocks straight away again.
+  g_event_poller->ReleaseBusyPolling(1ms);
+  EXPECT_EQ(g_event_poller->Work(20ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  EXPECT_EQ(parks(), initial_parks + 2);
+}
+
+INSTANTIATE_TEST_SUITE_P(EventPollerTests, EventPollerTest,
+                         ::testing::Values("default", "io_uring"),
+                         [](const ::testing::TestParamInfo<absl::string_view>&
+                                info) { return std::string(info.param); });
+
+// More fds than fit in the rings of an io_uring poller become readable at
+// once, so the completion ring overflows and the submission ring fills up.
+// Creating and orphaning the handles must not block on the full rings, and
+// every fd must still be reported readable.
+TEST(IoUringPollerTest, FillsSmallRings) {
+  static constexpr int kNumHandles = 64;
+  auto engine = PosixEventEngine::MakePosixEventEngine();
+  TestScheduler scheduler(engine.get());
+  if (MakeIoUringPoller(&scheduler) == nullptr) {
+    // The kernel does not support it.
+    return;
+  }
+  auto poller = std::make_shared<IoUringPoller>(&scheduler, /*sq_entries=*/8,
+                                                /*cq_entries=*/8);
+  std::vector<std::unique_ptr<WakeupFd>> wakeup_fds;
+  std::vector<EventHandle*> handles;
+  std::atomic<int> num_readable{0};
+  for (int i = 0; i < kNumHandles; i++) {
+    wakeup_fds.push_back(*PipeWakeupFd::CreatePipeWakeupFd());
+    EXPECT_TRUE(wakeup_fds.back()->Wakeup().ok());
+    handles.push_back(
+        poller->CreateHandle(wakeup_fds.back()->ReadFd(), "test", false));
+    handles.back()->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+        [&num_readable](absl::Status status) {
+          EXPECT_TRUE(status.ok());
+          ++num_readable;
+        }));
+  }
+  const auto deadline = std::chrono::steady_clock::now() + 30s;
+  while (num_readable.load() < kNumHandles &&
+         std::chrono::steady_clock::now() < deadline) {
+    poller->Work(100ms, []() {});
+  }
+  EXPECT_EQ(num_readable.load(), kNumHandles);
+  // Each removal fills a submission queue entry and posts completions again.
+  for (EventHandle* handle : handles) {
+    int release_fd;
+    handle->OrphanHandle(nullptr, &release_fd, "");
+  }
+  while (poller->Work(100ms, []() {}) !=
+         Poller::WorkResult::kDeadlineExceeded) {
+  }
+  poller->Shutdown();
+}
+
 }  // namespace
 }  // namespace experimental
 }  // namespace grpc_event_engine
@@ -17,6 +17,8 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/channel_arg_names.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 #include <algorithm>
 #include <chrono>
@@ -76,7 +78,8 @@ struct Connection {
 std::list<Connection> CreateConnectedEndpoints(
     PosixEventPoller& poller, bool is_zero_copy_enabled, int num_connections,
     std::shared_ptr<EventEngine> posix_ee,
-    std::shared_ptr<EventEngine> oracle_ee) {
+    std::shared_ptr<EventEngine> oracle_ee,
+    bool is_zero_copy_adaptive = false) {
   std::list<Connection> connections;
   auto memory_quota = std::make_unique<grpc_core::MemoryQuota>("bar");
   std::string target_addr = absl::StrCat(
@@ -98,8 +101,13 @@ std::list<Connection> CreateConnectedEndpoints(
   args = args.Set(GRPC_ARG_RESOURCE_QUOTA, quota);
   if (is_zero_copy_enabled) {
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, 1);
+    if (is_zero_copy_adaptive) {
+      args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_ADAPTIVE, 1);
+    }
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD,
                     kMinMessageSize);
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, 1);
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_THRESHOLD, kMinMessageSize);
   }
   ChannelArgsEndpointConfig config(args);
   auto listener = oracle_ee->CreateListener(
@@ -144,8 +152,19 @@ std::list<Connection> CreateConnectedEndpoints(
 
 }  // namespace
 
-std::string TestScenarioName(const ::testing::TestParamInfo<bool>& info) {
-  return absl::StrCat("is_zero_copy_enabled_", info.param);
+enum class ZerocopyMode { kDisabled, kEnabled, kAdaptive };
+
+std::string TestScenarioName(
+    const ::testing::TestParamInfo<ZerocopyMode>& info) {
+  switch (info.param) {
+    case ZerocopyMode::kDisabled:
+      return "is_zero_copy_enabled_false";
+    case ZerocopyMode::kEnabled:
+      return "is_zero_copy_enabled_true";
+    case ZerocopyMode::kAdaptive:
+      return "is_zero_copy_adaptive";
+  }
+  GPR_UNREACHABLE_CODE(return "");
 }
 
 // A helper class to drive the polling of Fds. It repeatedly calls the Work(..)
@@ -192,7 +211,7 @@ class Worker : public grpc_core::DualRefCounted<Worker> {
   grpc_core::Notification signal;
 };
 
-class PosixEndpointTest : public ::testing::TestWithParam<bool> {
+class PosixEndpointTest : public ::testing::TestWithParam<ZerocopyMode> {
   void SetUp() override {
     oracle_ee_ = std::make_shared<PosixOracleEventEngine>();
     scheduler_ =
@@ -239,8 +258,9 @@ TEST_P(PosixEndpointTest, ConnectExchangeBidiDataTransferTest) {
   Worker* worker = new Worker(GetPosixEE(), PosixPoller());
   worker->Start();
   {
-    auto connections = CreateConnectedEndpoints(*PosixPoller(), GetParam(), 1,
-                                                GetPosixEE(), GetOracleEE());
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam() != ZerocopyMode::kDisabled, 1, GetPosixEE(),
+        GetOracleEE(), GetParam() == ZerocopyMode::kAdaptive);
     auto it = connections.begin();
     auto client_endpoint = std::move((*it).client_endpoint);
     auto server_endpoint = std::move((*it).server_endpoint);
@@ -275,7 +295,8 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
   Worker* worker = new Worker(GetPosixEE(), PosixPoller());
   worker->Start();
   auto connections = CreateConnectedEndpoints(
-      *PosixPoller(), GetParam(), kNumConnections, GetPosixEE(), GetOracleEE());
+      *PosixPoller(), GetParam() != ZerocopyMode::kDisabled, kNumConnections,
+      GetPosixEE(), GetOracleEE(), GetParam() == ZerocopyMode::kAdaptive);
   std::vector<std::thread> threads;
   // Create one thread for each connection. For each connection, create
   // 2 more worker threads: to exchange and verify bi-directional data transfer.
@@ -325,9 +346,102 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
   worker->Wait();
 }
 
-// Test with zero copy enabled and disabled.
+// Test with zero copy disabled, enabled with a fixed send threshold, and
+// enabled with the adaptive one.
 INSTANTIATE_TEST_SUITE_P(PosixEndpoint, PosixEndpointTest,
-                         ::testing::ValuesIn({false, true}), &TestScenarioName);
+                         ::testing::Values(ZerocopyMode::kDisabled,
+                                           ZerocopyMode::kEnabled,
+                                           ZerocopyMode::kAdaptive),
+                         &TestScenarioName);
+
+TEST(TcpZerocopySendCtxTest, AdaptsThresholdToObservedCosts) {
+  TcpZerocopySendCtx ctx(/*zerocopy_enabled=*/true, /*max_sends=*/4,
+                         /*send_bytes_threshold=*/16 * 1024,
+                         /*adaptive=*/true);
+  ASSERT_TRUE(ctx.Adaptive());
+  // Copying costs 0.5ns per byte, zerocopy 0.25ns per byte and each
+  // completion 5us: zerocopy pays off above 5000 / (0.5 - 0.25) = 20000 bytes.
+  for (int i = 0; i < 4; ++i) {
+    ctx.NoteCopySendCost(1000000, 500000);
+    ctx.NoteZerocopySendCost(1000000, 250000);
+  }
+  EXPECT_EQ(ctx.ThresholdBytes(), 16u * 1024);
+  for (int i = 0; i < 4; ++i) {
+    ctx.NoteCompletionCost(1, /*copied=*/false, 5000);
+  }
+  EXPECT_EQ(ctx.ThresholdBytes(), 20000u);
+  EXPECT_FALSE(ctx.ShouldZerocopy(1000));
+  // Completions raised the in-flight limit from 4 to 8; ENOBUFS halves it and
+  // doubles the threshold.
+  bool constrained;
+  ctx.UpdateZeroCopyOptMemStateAfterSend(/*seen_enobuf=*/true, constrained);
+  EXPECT_EQ(ctx.ThresholdBytes(), 40000u);
+  std::vector<TcpZerocopySendRecord*> records;
+  while (auto* record = ctx.GetSendRecord()) records.push_back(record);
+  EXPECT_EQ(records.size(), 4u);
+  for (auto* record : records) ctx.PutSendRecord(record);
+  // When the kernel copies anyway, zerocopy sends cost as much as copying
+  // ones and the threshold moves to its upper bound.
+  for (int i = 0; i < 64; ++i) {
+    ctx.NoteZerocopySendCost(1000000, 500000);
+    ctx.NoteCompletionCost(1, /*copied=*/true, 5000);
+  }
+  EXPECT_EQ(ctx.ThresholdBytes(),
+            TcpZerocopySendCtx::kMaxAdaptiveSendBytesThreshold);
+}
+
+TEST(RxZerocopyTest, MapsWholePagesAboveThreshold) {
+  constexpr size_t kPage = 4096;
+  constexpr size_t kThreshold = 256 * 1024;
+  constexpr size_t kMax = 16 * 1024 * 1024;
+  EXPECT_EQ(RxZerocopyMapLength(1024 * 1024, kThreshold, kPage, kMax),
+            1024 * 1024);
+  // Only whole pages are mapped; the rest is left for recvmsg.
+  EXPECT_EQ(RxZerocopyMapLength(300000, kThreshold, kPage, kMax),
+            73 * kPage);
+  EXPECT_EQ(RxZerocopyMapLength(kPage - 1, 0, kPage, kMax), 0);
+  // Smaller reads copy.
+  EXPECT_EQ(RxZerocopyMapLength(kThreshold - 1, kThreshold, kPage, kMax), 0);
+  EXPECT_EQ(RxZerocopyMapLength(kThreshold, kThreshold, kPage, kMax),
+            kThreshold);
+  // Large reads are capped.
+  EXPECT_EQ(RxZerocopyMapLength(4 * kMax + 1, kThreshold, kPage, kMax), kMax);
+}
+
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+TEST(RxZerocopyTest, ReusesRegionsAndChargesMappedBytes) {
+  // Regions can be mapped on any TCP socket. Loopback connections never get
+  // pages mapped into them, so this drives the regions and slices directly.
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  ASSERT_GE(fd, 0);
+  auto regions = grpc_core::MakeRefCounted<RxZerocopyRegions>(1024 * 1024);
+  void* first = regions->Take(fd);
+  ASSERT_NE(first, nullptr);
+  void* second = regions->Take(fd);
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(first, second);
+
+  auto quota = grpc_core::MakeMemoryQuota("rx_zerocopy");
+  quota->SetSize(1024 * 1024);
+  auto owner = quota->CreateMemoryOwner();
+  EXPECT_LT(owner.GetPressureInfo().instantaneous_pressure, 0.1);
+  {
+    Slice slice = MakeRxZerocopySlice(
+        regions, first, 512 * 1024, owner.MakeReservation(512 * 1024));
+    EXPECT_EQ(slice.data(), first);
+    EXPECT_EQ(slice.size(), 512 * 1024);
+    // The mapped bytes count against the quota while the slice is alive.
+    EXPECT_GE(owner.GetPressureInfo().instantaneous_pressure, 0.5);
+  }
+  // Released regions are reused rather than unmapped.
+  EXPECT_EQ(regions->Take(fd), first);
+  regions->Return(first, 0);
+  regions->Return(second, 0);
+  close(fd);
+  // Regions outlive the socket, and are unmapped with the last reference.
+  regions.reset();
+}
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
 
 }  // namespace experimental
 }  // namespace grpc_event_engine
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <list>
 #include <string>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -30,9 +31,11 @@
 // This test won't work except with posix sockets enabled
 #ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
 
+#include <grpc/impl/channel_arg_names.h>
 #include <ifaddrs.h>
 
 #include "absl/log/log.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
@@ -184,6 +187,43 @@ TEST(PosixEngineListenerUtils, ListenerContainerIpv6LinkLocalTest) {
   EXPECT_FALSE(IsSockAddrLinkLocal(&resolved_addr6_not_ll2));
 }
 
+TEST(PosixEngineListenerUtils, CreateListenerSocketShardsTest) {
+  if (!PosixSocketWrapper::IsSocketReusePortSupported()) {
+    LOG(INFO) << "Skipping CreateListenerSocketShardsTest because "
+                 "SO_REUSEPORT is not supported.";
+    return;
+  }
+  TestListenerSocketsContainer listener_sockets;
+  ChannelArgsEndpointConfig config(
+      grpc_core::ChannelArgs()
+          .Set(GRPC_ARG_ALLOW_REUSEPORT, 1)
+          .Set(GRPC_ARG_TCP_SERVER_LISTENER_SHARDS, 4));
+  PosixTcpOptions options = TcpOptionsFromEndpointConfig(config);
+  auto result = ListenerContainerAddWildcardAddresses(listener_sockets,
+                                                      options, /*port=*/0);
+  ASSERT_TRUE(result.ok());
+  for (auto socket = listener_sockets.begin(); socket != listener_sockets.end();
+       ++socket) {
+    std::vector<ListenerSocketsContainer::ListenerSocket> shards =
+        CreateListenerSocketShards(options, *socket);
+    EXPECT_EQ(shards.size(), 3u);
+    for (auto& shard : shards) {
+      EXPECT_EQ(shard.port, *result);
+      EXPECT_EQ(shard.addr.address()->sa_family,
+                socket->addr.address()->sa_family);
+      close(shard.sock.Fd());
+    }
+    close(socket->sock.Fd());
+  }
+  // Without sharding no extra sockets are created.
+  options.tcp_server_listener_shards = 1;
+  auto socket = CreateAndPrepareListenerSocket(
+      options, ResolvedAddressMakeWild4(grpc_pick_unused_port_or_die()));
+  ASSERT_TRUE(socket.ok());
+  EXPECT_TRUE(CreateListenerSocketShards(options, *socket).empty());
+  close(socket->sock.Fd());
+}
+
 #ifdef GRPC_HAVE_IFADDRS
 TEST(PosixEngineListenerUtils, ListenerContainerAddAllLocalAddressesTest) {
   TestListenerSocketsContainer listener_sockets;
@@ -27,10 +27,13 @@
 // This test won't work except with posix sockets enabled
 #ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
 
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/alloc.h>
 #include <netinet/in.h>
 #include <netinet/ip.h>
 
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/iomgr/socket_mutator.h"
 #include "src/core/util/useful.h"
@@ -169,6 +172,40 @@ TEST(TcpPosixSocketUtilsTest, SocketOptionsTest) {
   close(sock);
 }
 
+TEST(TcpPosixSocketUtilsTest, AcceptBatchSizeOptionTest) {
+  EXPECT_EQ(TcpOptionsFromEndpointConfig(ChannelArgsEndpointConfig())
+                .tcp_server_accept_batch_size,
+            PosixTcpOptions::kDefaultAcceptBatchSize);
+  auto args = grpc_core::ChannelArgs().Set(
+      GRPC_ARG_TCP_SERVER_ACCEPT_BATCH_SIZE, 16);
+  PosixTcpOptions options =
+      TcpOptionsFromEndpointConfig(ChannelArgsEndpointConfig(args));
+  EXPECT_EQ(options.tcp_server_accept_batch_size, 16);
+  EXPECT_EQ(PosixTcpOptions(options).tcp_server_accept_batch_size, 16);
+  // Out of range values fall back to the default.
+  args = args.Set(GRPC_ARG_TCP_SERVER_ACCEPT_BATCH_SIZE, 0);
+  EXPECT_EQ(TcpOptionsFromEndpointConfig(ChannelArgsEndpointConfig(args))
+                .tcp_server_accept_batch_size,
+            PosixTcpOptions::kDefaultAcceptBatchSize);
+}
+
+TEST(TcpPosixSocketUtilsTest, BusyPollOptionTest) {
+  EXPECT_EQ(TcpOptionsFromEndpointConfig(ChannelArgsEndpointConfig())
+                .tcp_busy_poll_us,
+            0);
+  auto args = grpc_core::ChannelArgs().Set(GRPC_ARG_TCP_BUSY_POLL_US, 50);
+  PosixTcpOptions options =
+      TcpOptionsFromEndpointConfig(ChannelArgsEndpointConfig(args));
+  EXPECT_EQ(options.tcp_busy_poll_us, 50);
+  EXPECT_EQ(PosixTcpOptions(options).tcp_busy_poll_us, 50);
+  // Out of range values fall back to the default.
+  args =
+      args.Set(GRPC_ARG_TCP_BUSY_POLL_US, PosixTcpOptions::kMaxBusyPollUs + 1);
+  EXPECT_EQ(TcpOptionsFromEndpointConfig(ChannelArgsEndpointConfig(args))
+                .tcp_busy_poll_us,
+            0);
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
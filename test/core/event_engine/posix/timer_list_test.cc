@@ -27,6 +27,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timing_wheel.h"
 #include "src/core/util/time.h"
 
 using testing::Mock;
@@ -66,7 +67,13 @@ CheckResult FinishCheck(
 
 }  // namespace
 
-TEST(TimerListTest, Add) {
+template <typename T>
+class TimerListTest : public ::testing::Test {};
+
+using TimerListTypes = ::testing::Types<TimerList, TimingWheelTimerList>;
+TYPED_TEST_SUITE(TimerListTest, TimerListTypes);
+
+TYPED_TEST(TimerListTest, Add) {
   Timer timers[20];
   StrictMock<MockClosure> closures[20];
 
@@ -75,7 +82,7 @@ TEST(TimerListTest, Add) {
 
   StrictMock<MockHost> host;
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
-  TimerList timer_list(&host);
+  TypeParam timer_list(&host);
 
   // 10 ms timers.  will expire in the current epoch
   for (int i = 0; i < 10; i++) {
@@ -129,7 +136,7 @@ TEST(TimerListTest, Add) {
 }
 
 // Cleaning up a list with pending timers.
-TEST(TimerListTest, Destruction) {
+TYPED_TEST(TimerListTest, Destruction) {
   Timer timers[5];
   StrictMock<MockClosure> closures[5];
 
@@ -137,7 +144,7 @@ TEST(TimerListTest, Destruction) {
   EXPECT_CALL(host, Now())
       .WillOnce(
           Return(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(0)));
-  TimerList timer_list(&host);
+  TypeParam timer_list(&host);
 
   EXPECT_CALL(host, Now())
       .WillOnce(
@@ -183,6 +190,40 @@ TEST(TimerListTest, Destruction) {
   EXPECT_TRUE(timer_list.TimerCancel(&timers[2]));
 }
 
+// Timers spread over several orders of magnitude fire neither early nor late.
+TYPED_TEST(TimerListTest, FiresAcrossDeadlineScales) {
+  const grpc_core::Duration kDelays[] = {
+      grpc_core::Duration::Milliseconds(70), grpc_core::Duration::Seconds(5),
+      grpc_core::Duration::Minutes(7), grpc_core::Duration::Hours(9)};
+  Timer timers[4];
+  StrictMock<MockClosure> closures[4];
+
+  const auto kStart =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100);
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+  TypeParam timer_list(&host);
+
+  for (int i = 0; i < 4; i++) {
+    EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+    timer_list.TimerInit(&timers[i], kStart + kDelays[i], &closures[i]);
+  }
+
+  for (int i = 0; i < 4; i++) {
+    EXPECT_CALL(host, Now())
+        .WillOnce(Return(kStart + kDelays[i] -
+                         grpc_core::Duration::Milliseconds(1)));
+    EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+              CheckResult::kCheckedAndEmpty);
+    EXPECT_CALL(host, Now()).WillOnce(Return(kStart + kDelays[i]));
+    EXPECT_CALL(closures[i], Run());
+    EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+              CheckResult::kTimersFired);
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+}
+
 // Cleans up a list with pending timers that simulate long-running-services.
 // This test does the following:
 //  1) Simulates grpc server start time to 25 days in the past (completed in
@@ -195,7 +236,7 @@ TEST(TimerListTest, Destruction) {
 //      step 1) to `now+4`
 //  4) Shuts down the timer list
 // https://github.com/grpc/grpc/issues/15904
-TEST(TimerListTest, LongRunningServiceCleanup) {
+TYPED_TEST(TimerListTest, LongRunningServiceCleanup) {
   Timer timers[4];
   StrictMock<MockClosure> closures[4];
 
@@ -204,7 +245,7 @@ TEST(TimerListTest, LongRunningServiceCleanup) {
 
   StrictMock<MockHost> host;
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
-  TimerList timer_list(&host);
+  TypeParam timer_list(&host);
 
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
   timer_list.TimerInit(&timers[0], kStart + k25Days, &closures[0]);
@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <tuple>
 #include <vector>
@@ -31,6 +32,9 @@
 #include "gtest/gtest.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/thd.h"
 #include "src/core/util/time.h"
@@ -246,6 +250,112 @@ TYPED_TEST(ThreadPoolTest, ScalesWhenBackloggedFromSingleThreadLocalQueue) {
   p.Quiesce();
 }
 
+TYPED_TEST(ThreadPoolTest, RecordsQueueDelayWhenScalingByQueueDelay) {
+  if (!grpc_core::IsEventEngineQueueDelayScalingEnabled()) {
+    GTEST_SKIP() << "Queue delays are only sampled when scaling by them";
+  }
+  auto before = grpc_core::global_stats().Collect();
+  {
+    TypeParam p(4);
+    constexpr int kClosureCount = 1000;
+    std::atomic<int> run_count{0};
+    grpc_core::Notification done;
+    for (int i = 0; i < kClosureCount; i++) {
+      p.Run([&]() {
+        if (run_count.fetch_add(1) + 1 == kClosureCount) done.Notify();
+      });
+    }
+    done.WaitForNotification();
+    p.Quiesce();
+  }
+  auto diff = grpc_core::global_stats().Collect()->Diff(*before);
+  EXPECT_GT(
+      diff->histogram(grpc_core::GlobalStats::Histogram::kThreadPoolQueueDelay)
+          .Count(),
+      0);
+}
+
+class QueueDelayScalerTest : public testing::Test {
+ protected:
+  using Decision = QueueDelayScaler::Decision;
+
+  static QueueDelayScaler::PoolState State(
+      std::optional<grpc_core::Duration> queue_delay, size_t living_threads,
+      size_t busy_threads, bool global_queues_empty = true) {
+    QueueDelayScaler::PoolState state;
+    state.queue_delay = queue_delay;
+    state.living_threads = living_threads;
+    state.busy_threads = busy_threads;
+    state.reserve_threads = 2;
+    state.global_queues_empty = global_queues_empty;
+    return state;
+  }
+
+  Decision Decide(const QueueDelayScaler::PoolState& state) {
+    return scaler_.Decide(state, now_, last_thread_start_);
+  }
+
+  QueueDelayScaler scaler_{grpc_core::Duration::Milliseconds(8)};
+  grpc_core::Timestamp now_ =
+      grpc_core::Timestamp::ProcessEpoch() + grpc_core::Duration::Hours(1);
+  grpc_core::Timestamp last_thread_start_ = grpc_core::Timestamp::ProcessEpoch();
+};
+
+TEST_F(QueueDelayScalerTest, WakesIdleThreadsBeforeStartingOne) {
+  const auto slow = grpc_core::Duration::Milliseconds(20);
+  EXPECT_EQ(Decide(State(slow, 4, 3)), Decision::kWakeIdleThreads);
+  EXPECT_EQ(Decide(State(slow, 4, 4)), Decision::kStartThread);
+}
+
+TEST_F(QueueDelayScalerTest, RateLimitsThreadStarts) {
+  const auto slow = grpc_core::Duration::Milliseconds(20);
+  last_thread_start_ = now_ - grpc_core::Duration::Milliseconds(50);
+  EXPECT_EQ(Decide(State(slow, 4, 4)), Decision::kThrottled);
+  now_ += grpc_core::Duration::Milliseconds(50);
+  EXPECT_EQ(Decide(State(slow, 4, 4)), Decision::kStartThread);
+}
+
+TEST_F(QueueDelayScalerTest, StartsThreadWhenAllBusyWithoutSamples) {
+  // Every thread is stuck on a closure queued before the last check.
+  EXPECT_EQ(Decide(State(std::nullopt, 4, 4, /*global_queues_empty=*/false)),
+            Decision::kStartThread);
+  // Nothing is waiting.
+  EXPECT_EQ(Decide(State(std::nullopt, 4, 4)), Decision::kNone);
+}
+
+TEST_F(QueueDelayScalerTest, RetiresIdleThreadsAboveReserve) {
+  const auto fast = grpc_core::Duration::Milliseconds(1);
+  EXPECT_EQ(Decide(State(fast, 4, 1)), Decision::kRetireIdleThread);
+  EXPECT_TRUE(scaler_.TakeRetirement());
+  // Only one thread is retired per decision.
+  EXPECT_FALSE(scaler_.TakeRetirement());
+  // An idle pool retires threads too.
+  EXPECT_EQ(Decide(State(std::nullopt, 4, 0)), Decision::kRetireIdleThread);
+  // Not below the reserve, nor while every thread is busy.
+  EXPECT_EQ(Decide(State(fast, 2, 0)), Decision::kNone);
+  EXPECT_EQ(Decide(State(fast, 4, 4)), Decision::kNone);
+  // Nor between a quarter of the target and the target.
+  EXPECT_EQ(Decide(State(grpc_core::Duration::Milliseconds(4), 4, 1)),
+            Decision::kNone);
+  EXPECT_FALSE(scaler_.TakeRetirement());
+}
+
+TEST_F(QueueDelayScalerTest, WithdrawsRetirementWhenDelayRises) {
+  EXPECT_EQ(Decide(State(grpc_core::Duration::Milliseconds(1), 4, 1)),
+            Decision::kRetireIdleThread);
+  // No idle thread woke up to take the retirement before the next decision,
+  // at which point the delay is back above the target.
+  EXPECT_EQ(Decide(State(grpc_core::Duration::Milliseconds(20), 4, 4)),
+            Decision::kStartThread);
+  EXPECT_FALSE(scaler_.TakeRetirement());
+  // Likewise when it is back to around the target.
+  EXPECT_EQ(Decide(State(grpc_core::Duration::Milliseconds(1), 4, 1)),
+            Decision::kRetireIdleThread);
+  EXPECT_EQ(Decide(State(grpc_core::Duration::Milliseconds(6), 4, 1)),
+            Decision::kNone);
+  EXPECT_FALSE(scaler_.TakeRetirement());
+}
+
 TYPED_TEST(ThreadPoolTest, QuiesceRaceStressTest) {
   constexpr int cycle_count = 333;
   constexpr int thread_count = 8;
@@ -0,0 +1,165 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/common_closures.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+using ::grpc_event_engine::experimental::AnyInvocableClosure;
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
+using ::grpc_event_engine::experimental::EventEngine;
+
+TEST(ChaseLevWorkQueueTest, StartsEmpty) {
+  ChaseLevWorkQueue queue;
+  ASSERT_TRUE(queue.Empty());
+  ASSERT_EQ(queue.PopMostRecent(), nullptr);
+  ASSERT_EQ(queue.PopOldest(), nullptr);
+}
+
+TEST(ChaseLevWorkQueueTest, TakesClosures) {
+  ChaseLevWorkQueue queue;
+  bool ran = false;
+  AnyInvocableClosure closure([&ran] { ran = true; });
+  queue.Add(&closure);
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, TakesAnyInvocables) {
+  ChaseLevWorkQueue queue;
+  bool ran = false;
+  queue.Add([&ran] { ran = true; });
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, PopMostRecentIsLIFO) {
+  ChaseLevWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.PopMostRecent()->Run();
+  EXPECT_FALSE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  queue.PopMostRecent()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, PopOldestIsFIFO) {
+  ChaseLevWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.PopOldest()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_FALSE(flag & 2);
+  queue.PopOldest()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, GrowsPastInitialCapacity) {
+  ChaseLevWorkQueue queue;
+  constexpr int kCount = 10000;
+  std::vector<AnyInvocableClosure*> closures;
+  for (int i = 0; i < kCount; i++) {
+    closures.push_back(new AnyInvocableClosure([] {}));
+    queue.Add(closures.back());
+  }
+  EXPECT_EQ(queue.Size(), kCount);
+  // Interleave both ends to check every element survived the copies.
+  for (int i = 0; i < kCount / 2; i++) {
+    EXPECT_EQ(queue.PopOldest(), closures[i]);
+    EXPECT_EQ(queue.PopMostRecent(), closures[kCount - 1 - i]);
+  }
+  EXPECT_TRUE(queue.Empty());
+  for (auto* closure : closures) delete closure;
+}
+
+TEST(ChaseLevWorkQueueTest, OwnerAndThievesRunEveryClosureOnce) {
+  ChaseLevWorkQueue queue;
+  constexpr int kThiefCount = 8;
+  constexpr int kElementCount = 200000;
+  std::vector<std::atomic<int>> runs(kElementCount);
+  std::vector<std::unique_ptr<AnyInvocableClosure>> closures;
+  closures.reserve(kElementCount);
+  for (int i = 0; i < kElementCount; i++) {
+    closures.push_back(std::make_unique<AnyInvocableClosure>(
+        [&runs, i] { runs[i].fetch_add(1); }));
+  }
+  std::atomic<int> run_count{0};
+  std::vector<std::thread> thieves;
+  thieves.reserve(kThiefCount);
+  for (int i = 0; i < kThiefCount; i++) {
+    thieves.emplace_back([&] {
+      while (run_count.load() < kElementCount) {
+        if (auto* c = queue.PopOldest()) {
+          c->Run();
+          run_count.fetch_add(1);
+        }
+      }
+    });
+  }
+  // The owner adds closures in bursts, popping some of them back itself.
+  for (int i = 0; i < kElementCount; i++) {
+    queue.Add(closures[i].get());
+    if (i % 3 == 0) {
+      if (auto* c = queue.PopMostRecent()) {
+        c->Run();
+        run_count.fetch_add(1);
+      }
+    }
+  }
+  while (run_count.load() < kElementCount) {
+    if (auto* c = queue.PopMostRecent()) {
+      c->Run();
+      run_count.fetch_add(1);
+    }
+  }
+  for (auto& thd : thieves) thd.join();
+  EXPECT_TRUE(queue.Empty());
+  for (int i = 0; i < kElementCount; i++) {
+    ASSERT_EQ(runs[i].load(), 1) << "closure " << i;
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  auto result = RUN_ALL_TESTS();
+  return result;
+}
@@ -0,0 +1,319 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/http/message_compress/compression_filter.h"
+
+#include <grpc/compression.h>
+#include <grpc/impl/compression_types.h>
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/call/message.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/config.h"
+#include "test/core/event_engine/util/delegating_event_engine.h"
+#include "test/core/filters/filter_test.h"
+
+using ::testing::_;
+
+namespace grpc_core {
+namespace {
+
+constexpr absl::string_view kContextTakeoverKey =
+    "grpc-compression-context-takeover";
+
+// Compresses somewhat, and much better against an identical earlier message.
+std::string TestPayload() {
+  std::string payload;
+  for (int i = 0; payload.size() < 2048; i++) {
+    absl::StrAppend(&payload, i * 7919 % 10007, ",");
+  }
+  return payload;
+}
+
+ChannelArgs GzipArgs(bool context_takeover) {
+  return ChannelArgs()
+      .Set(GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM, GRPC_COMPRESS_GZIP)
+      .Set(GRPC_COMPRESSION_CHANNEL_CONTEXT_TAKEOVER, context_takeover);
+}
+
+// Messages compressed the way a peer would send them.
+std::vector<MessageHandle> CompressedMessages(
+    FilterTestBase::Call& call, const std::vector<std::string>& payloads,
+    bool context_takeover) {
+  ChannelCompression peer(GzipArgs(context_takeover));
+  ChannelCompression::CompressArgs compress_args;
+  compress_args.algorithm = GRPC_COMPRESS_GZIP;
+  compress_args.context_takeover = context_takeover;
+  std::vector<MessageHandle> messages;
+  for (const std::string& payload : payloads) {
+    messages.push_back(peer.CompressMessage(call.NewMessage(payload),
+                                            compress_args, nullptr));
+    EXPECT_NE(messages.back()->flags() & GRPC_WRITE_INTERNAL_COMPRESS, 0u);
+  }
+  return messages;
+}
+
+// Holds the closures it is asked to run until Release(), so that a test can
+// act while a decompression is offloaded.
+class HoldingEventEngine final
+    : public grpc_event_engine::experimental::DelegatingEventEngine {
+ public:
+  HoldingEventEngine()
+      : DelegatingEventEngine(
+            grpc_event_engine::experimental::GetDefaultEventEngine()) {}
+
+  using DelegatingEventEngine::Run;
+  void Run(absl::AnyInvocable<void()> closure) override {
+    held_.push_back(std::move(closure));
+  }
+
+  size_t held() const { return held_.size(); }
+
+  void Release() {
+    for (auto& closure : held_) wrapped_engine()->Run(std::move(closure));
+    held_.clear();
+  }
+
+ private:
+  std::vector<absl::AnyInvocable<void()>> held_;
+};
+
+using ClientCompressionFilterTest = FilterTest<ClientCompressionFilter>;
+using ServerCompressionFilterTest = FilterTest<ServerCompressionFilter>;
+
+TEST_F(ClientCompressionFilterTest, OffersContextTakeoverWhenEnabled) {
+  Call call(MakeChannel(GzipArgs(true)).value());
+  EXPECT_EVENT(Started(&call, HasMetadataKeyValue(kContextTakeoverKey, "1")));
+  call.Start(call.NewClientMetadata());
+  Step();
+}
+
+TEST_F(ClientCompressionFilterTest, DoesNotOfferContextTakeoverByDefault) {
+  Call call(MakeChannel(GzipArgs(false)).value());
+  EXPECT_EVENT(Started(&call, LacksMetadataKey(kContextTakeoverKey)));
+  call.Start(call.NewClientMetadata());
+  Step();
+}
+
+TEST_F(ClientCompressionFilterTest, DecompressesAcceptedContextTakeover) {
+  Call call(MakeChannel(GzipArgs(true)).value());
+  // What the server sends once it accepted: each message depends on the one
+  // before it.
+  auto messages =
+      CompressedMessages(call, {TestPayload(), TestPayload()}, true);
+  EXPECT_LT(messages[1]->payload()->Length(),
+            messages[0]->payload()->Length() / 4);
+
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata());
+  call.ForwardServerInitialMetadata(call.NewServerMetadata(
+      {{"grpc-encoding", "gzip"}, {kContextTakeoverKey, "1"}}));
+  for (MessageHandle& message : messages) {
+    call.ForwardMessageServerToClient(std::move(message));
+  }
+  EXPECT_EVENT(ForwardedServerInitialMetadata(&call, _));
+  EXPECT_EVENT(ForwardedMessageServerToClient(
+                   &call, HasMessagePayload(TestPayload())))
+      .Times(2);
+  Step();
+}
+
+TEST_F(ServerCompressionFilterTest, AcceptsOfferedContextTakeover) {
+  Call call(MakeChannel(GzipArgs(true)).value());
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata({{kContextTakeoverKey, "1"}}));
+  call.ForwardServerInitialMetadata(call.NewServerMetadata());
+  call.ForwardMessageServerToClient(call.NewMessage(TestPayload()));
+  call.ForwardMessageServerToClient(call.NewMessage(TestPayload()));
+  EXPECT_EVENT(ForwardedServerInitialMetadata(
+      &call, ::testing::AllOf(HasMetadataKeyValue("grpc-encoding", "gzip"),
+                              HasMetadataKeyValue(kContextTakeoverKey, "1"))));
+  std::vector<size_t> lengths;
+  EXPECT_EVENT(ForwardedMessageServerToClient(&call, _))
+      .Times(2)
+      .WillRepeatedly([&lengths](Call*, const Message& message) {
+        EXPECT_NE(message.flags() & GRPC_WRITE_INTERNAL_COMPRESS, 0u);
+        lengths.push_back(message.payload()->Length());
+      });
+  Step();
+  ASSERT_EQ(lengths.size(), 2u);
+  // The second message refers back to the first.
+  EXPECT_LT(lengths[1], lengths[0] / 4);
+}
+
+TEST_F(ServerCompressionFilterTest, CompressesMessagesOnTheirOwnUnlessOffered) {
+  Call call(MakeChannel(GzipArgs(true)).value());
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata());
+  call.ForwardServerInitialMetadata(call.NewServerMetadata());
+  call.ForwardMessageServerToClient(call.NewMessage(TestPayload()));
+  call.ForwardMessageServerToClient(call.NewMessage(TestPayload()));
+  EXPECT_EVENT(ForwardedServerInitialMetadata(
+      &call, LacksMetadataKey(kContextTakeoverKey)));
+  std::vector<size_t> lengths;
+  EXPECT_EVENT(ForwardedMessageServerToClient(&call, _))
+      .Times(2)
+      .WillRepeatedly([&lengths](Call*, const Message& message) {
+        EXPECT_NE(message.flags() & GRPC_WRITE_INTERNAL_COMPRESS, 0u);
+        lengths.push_back(message.payload()->Length());
+      });
+  Step();
+  ASSERT_EQ(lengths.size(), 2u);
+  EXPECT_EQ(lengths[0], lengths[1]);
+}
+
+TEST_F(ServerCompressionFilterTest, IgnoresContextTakeoverOfferWhenDisabled) {
+  Call call(MakeChannel(GzipArgs(false)).value());
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata({{kContextTakeoverKey, "1"}}));
+  call.ForwardServerInitialMetadata(call.NewServerMetadata());
+  EXPECT_EVENT(ForwardedServerInitialMetadata(
+      &call, LacksMetadataKey(kContextTakeoverKey)));
+  Step();
+}
+
+TEST_F(ServerCompressionFilterTest, DoesNotAcceptContextTakeoverUncompressed) {
+  Call call(
+      MakeChannel(ChannelArgs().Set(GRPC_COMPRESSION_CHANNEL_CONTEXT_TAKEOVER,
+                                    true))
+          .value());
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata({{kContextTakeoverKey, "1"}}));
+  call.ForwardServerInitialMetadata(call.NewServerMetadata());
+  EXPECT_EVENT(ForwardedServerInitialMetadata(
+      &call, LacksMetadataKey(kContextTakeoverKey)));
+  Step();
+}
+
+// With a threshold of 1 byte, every compressed message is decompressed on the
+// call's EventEngine.
+class ClientDecompressionOffloadTest : public ClientCompressionFilterTest {
+ protected:
+  static ChannelArgs OffloadArgs(bool context_takeover) {
+    return GzipArgs(context_takeover)
+        .Set(GRPC_ARG_DECOMPRESSION_OFFLOAD_THRESHOLD, 1);
+  }
+
+  std::shared_ptr<grpc_event_engine::experimental::DelegatingEventEngine>
+      engine_ = std::make_shared<
+          grpc_event_engine::experimental::DelegatingEventEngine>(
+          grpc_event_engine::experimental::GetDefaultEventEngine());
+};
+
+TEST_F(ClientDecompressionOffloadTest, ResumesWithDecompressedMessage) {
+  Call call(MakeChannel(OffloadArgs(false)).value());
+  call.arena()->SetContext<grpc_event_engine::experimental::EventEngine>(
+      engine_.get());
+  auto messages = CompressedMessages(call, {TestPayload()}, false);
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata());
+  call.ForwardServerInitialMetadata(
+      call.NewServerMetadata({{"grpc-encoding", "gzip"}}));
+  call.ForwardMessageServerToClient(std::move(messages[0]));
+  EXPECT_EVENT(ForwardedServerInitialMetadata(&call, _));
+  EXPECT_EVENT(ForwardedMessageServerToClient(
+      &call,
+      ::testing::AllOf(
+          HasMessagePayload(TestPayload()),
+          HasMessageFlags(GRPC_WRITE_INTERNAL_TEST_ONLY_WAS_COMPRESSED))));
+  Step();
+  EXPECT_EQ(engine_->get_run_count(), 1);
+}
+
+TEST_F(ClientDecompressionOffloadTest, LatchesDecompressionError) {
+  Call call(MakeChannel(OffloadArgs(false)).value());
+  call.arena()->SetContext<grpc_event_engine::experimental::EventEngine>(
+      engine_.get());
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata());
+  call.ForwardServerInitialMetadata(
+      call.NewServerMetadata({{"grpc-encoding", "gzip"}}));
+  call.ForwardMessageServerToClient(
+      call.NewMessage("not gzip", GRPC_WRITE_INTERNAL_COMPRESS));
+  EXPECT_EVENT(ForwardedServerInitialMetadata(&call, _));
+  EXPECT_EVENT(Finished(
+      &call, HasMetadataResult(absl::InternalError(
+                 "Unexpected error decompressing data for algorithm gzip"))));
+  Step();
+  EXPECT_EQ(engine_->get_run_count(), 1);
+}
+
+TEST_F(ClientDecompressionOffloadTest, CancelledWhileOffloaded) {
+  auto engine = std::make_shared<HoldingEventEngine>();
+  Call call(MakeChannel(OffloadArgs(false)).value());
+  call.arena()->SetContext<grpc_event_engine::experimental::EventEngine>(
+      engine.get());
+  auto messages = CompressedMessages(call, {TestPayload()}, false);
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata());
+  call.ForwardServerInitialMetadata(
+      call.NewServerMetadata({{"grpc-encoding", "gzip"}}));
+  call.ForwardMessageServerToClient(std::move(messages[0]));
+  EXPECT_EVENT(ForwardedServerInitialMetadata(&call, _));
+  Step();
+  ASSERT_EQ(engine->held(), 1u);
+  // The decompression completes after the call is gone, and the message goes
+  // nowhere.
+  call.Cancel();
+  engine->Release();
+  Step();
+}
+
+TEST_F(ClientDecompressionOffloadTest, KeepsContextTakeoverOrder) {
+  Call call(MakeChannel(OffloadArgs(true)).value());
+  call.arena()->SetContext<grpc_event_engine::experimental::EventEngine>(
+      engine_.get());
+  std::vector<std::string> payloads;
+  for (int i = 0; i < 3; i++) {
+    payloads.push_back(absl::StrCat(i, TestPayload()));
+  }
+  auto messages = CompressedMessages(call, payloads, true);
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata());
+  call.ForwardServerInitialMetadata(call.NewServerMetadata(
+      {{"grpc-encoding", "gzip"}, {kContextTakeoverKey, "1"}}));
+  for (MessageHandle& message : messages) {
+    call.ForwardMessageServerToClient(std::move(message));
+  }
+  ::testing::InSequence seq;
+  EXPECT_EVENT(ForwardedServerInitialMetadata(&call, _));
+  // Each message only decodes against the ones before it.
+  for (const std::string& payload : payloads) {
+    EXPECT_EVENT(
+        ForwardedMessageServerToClient(&call, HasMessagePayload(payload)));
+  }
+  Step();
+  EXPECT_EQ(engine_->get_run_count(), 3);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc_core::ForceEnableExperiment("offload_large_decompression", true);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -17,6 +17,7 @@
 //
 
 #include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/time.h>
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/security/credentials.h>
 #include <grpcpp/support/channel_arguments.h>
@@ -49,6 +50,9 @@ ABSL_FLAG(bool, secure, false, "Use SSL Credentials");
 ABSL_FLAG(int, server_pid, 0, "Server's pid");
 ABSL_FLAG(int, size, 50, "Number of channels");
 ABSL_FLAG(bool, chaotic_good, false, "Use chaotic good");
+ABSL_FLAG(int, idle_compaction_ms, 0,
+          "Compact http2 transports after this many idle milliseconds, and "
+          "report the memory usage of the idle channels");
 
 std::shared_ptr<grpc::Channel> CreateChannelForTest(int index) {
   // Set the authentication mechanism.
@@ -72,6 +76,10 @@ std::shared_ptr<grpc::Channel> CreateChannelForTest(int index) {
   // Arg to bypass mechanism that combines channels on the server side if they
   // have the same channel args. Allows for one channel per connection
   channel_args.SetInt("grpc.memory_usage_counter", index);
+  if (absl::GetFlag(FLAGS_idle_compaction_ms) > 0) {
+    channel_args.SetInt(GRPC_ARG_HTTP2_IDLE_COMPACTION_MS,
+                        absl::GetFlag(FLAGS_idle_compaction_ms));
+  }
 
   // Create a channel to the server and a stub
   std::shared_ptr<grpc::Channel> channel =
@@ -163,6 +171,19 @@ int main(int argc, char** argv) {
                                 : 0;
   long peak_client_memory = GetMemUsage();
 
+  // Let the channels sit idle for long enough that both sides compact them
+  const int idle_compaction_ms = absl::GetFlag(FLAGS_idle_compaction_ms);
+  long idle_server_memory = 0;
+  long idle_client_memory = 0;
+  if (idle_compaction_ms > 0) {
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(
+        2 * idle_compaction_ms + 1000));
+    idle_server_memory = absl::GetFlag(FLAGS_server_pid) > 0
+                             ? GetMemUsage(absl::GetFlag(FLAGS_server_pid))
+                             : 0;
+    idle_client_memory = GetMemUsage();
+  }
+
   // Checking that all channels are still open
   for (int i = 0; i < size; ++i) {
     CHECK(!std::exchange(channels_list[i], nullptr)
@@ -188,6 +209,20 @@ int main(int argc, char** argv) {
            static_cast<double>(peak_server_memory - before_server_memory) /
                size * 1024);
   }
+  if (idle_compaction_ms > 0) {
+    printf("---------Client idle channel stats--------\n");
+    printf("%sclient idle channel memory usage: %f bytes per channel\n",
+           prefix.c_str(),
+           static_cast<double>(idle_client_memory - before_client_memory) /
+               size * 1024);
+    if (absl::GetFlag(FLAGS_server_pid) > 0) {
+      printf("---------Server idle channel stats--------\n");
+      printf("%sserver idle channel memory usage: %f bytes per channel\n",
+             prefix.c_str(),
+             static_cast<double>(idle_server_memory - before_server_memory) /
+                 size * 1024);
+    }
+  }
   LOG(INFO) << "Client Done";
   return 0;
 }
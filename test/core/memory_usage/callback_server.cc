@@ -16,6 +16,7 @@
 //
 //
 
+#include <grpc/impl/channel_arg_names.h>
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/support/server_callback.h>
@@ -42,6 +43,8 @@ ABSL_FLAG(std::string, bind, "", "Bind host:port");
 ABSL_FLAG(bool, secure, false, "Use SSL Credentials");
 ABSL_FLAG(bool, use_xds, false, "Use xDS");
 ABSL_FLAG(bool, chaotic_good, false, "Use chaotic good");
+ABSL_FLAG(int, idle_compaction_ms, 0,
+          "Compact http2 transports after this many idle milliseconds");
 
 class ServerCallbackImpl final
     : public grpc::testing::BenchmarkService::CallbackService {
@@ -106,6 +109,11 @@ int main(int argc, char** argv) {
         std::string(grpc_core::chaotic_good::WireFormatPreferences()));
   }
 
+  if (absl::GetFlag(FLAGS_idle_compaction_ms) > 0) {
+    builder->AddChannelArgument(GRPC_ARG_HTTP2_IDLE_COMPACTION_MS,
+                                absl::GetFlag(FLAGS_idle_compaction_ms));
+  }
+
   // Set the authentication mechanism.
   std::shared_ptr<grpc::ServerCredentials> creds =
       grpc::InsecureServerCredentials();
@@ -58,9 +58,10 @@ using grpc::testing::XdsResourceUtils;
 
 // Default all benchmarks in order to trigger CI testing for each one
 ABSL_FLAG(std::string, benchmark_names, "",
-          "Which benchmark to run.  If empty, defaults to 'call,channel' "
-          "if --use_xds is false, or 'call,channel,channel_multi_address' "
-          "if --use_xds is true.");
+          "Which benchmark to run.  If empty, defaults to "
+          "'call,channel,idle_channel' if --use_xds is false, or "
+          "'call,channel,channel_multi_address,idle_channel' if --use_xds is "
+          "true.");
 
 ABSL_FLAG(int, size, 1000, "Number of channels/calls");
 ABSL_FLAG(
@@ -70,6 +71,9 @@ ABSL_FLAG(
 ABSL_FLAG(bool, memory_profiling, false,
           "Run memory profiling");  // TODO (chennancy) Connect this flag
 ABSL_FLAG(bool, use_xds, false, "Use xDS");
+ABSL_FLAG(int, idle_compaction_ms, 1000,
+          "Idle period after which the idle_channel benchmark expects "
+          "transports to be compacted");
 
 // TODO(roth, ctiller): Add support for multiple addresses per channel.
 
@@ -146,8 +150,10 @@ int RunCallBenchmark(int port, char* root,
   return svr.Join() == 0 ? 0 : 2;
 }
 
-// Per-channel benchmark
-int RunChannelBenchmark(const std::vector<int>& server_ports, char* root) {
+// Per-channel benchmark. If idle_compaction_ms is set, also reports the
+// memory usage of the channels once they have been idle for that long.
+int RunChannelBenchmark(const std::vector<int>& server_ports, char* root,
+                        int idle_compaction_ms = 0) {
   // TODO(chennancy) Add the scenario specific flags
 
   // start the servers
@@ -160,6 +166,10 @@ int RunChannelBenchmark(const std::vector<int>& server_ports, char* root) {
                      gpr_subprocess_binary_extension()),
         "--bind", grpc_core::LocalIpAndPort(port)};
     if (absl::GetFlag(FLAGS_use_xds)) server_flags.emplace_back("--use_xds");
+    if (idle_compaction_ms > 0) {
+      server_flags.emplace_back(
+          absl::StrCat("--idle_compaction_ms=", idle_compaction_ms));
+    }
     servers.emplace_back(server_flags);
     LOG(INFO) << "server started, pid " << servers.back().GetPID();
   }
@@ -182,6 +192,10 @@ int RunChannelBenchmark(const std::vector<int>& server_ports, char* root) {
     client_flags.emplace_back(
         absl::StrCat("--server_pid=", servers[0].GetPID()));
   }
+  if (idle_compaction_ms > 0) {
+    client_flags.emplace_back(
+        absl::StrCat("--idle_compaction_ms=", idle_compaction_ms));
+  }
   Subprocess cli(client_flags);
   LOG(INFO) << "client started, pid " << cli.GetPID();
   // wait for completion
@@ -272,6 +286,9 @@ int RunBenchmark(char* root, absl::string_view benchmark,
                               client_scenario_flags);
   } else if (benchmark == "channel" || benchmark == "channel_multi_address") {
     retval = RunChannelBenchmark(server_ports, root);
+  } else if (benchmark == "idle_channel") {
+    retval = RunChannelBenchmark(server_ports, root,
+                                 absl::GetFlag(FLAGS_idle_compaction_ms));
   } else {
     LOG(INFO) << "Not a valid benchmark name";
     retval = 4;
@@ -320,8 +337,8 @@ int main(int argc, char** argv) {
   std::string benchmark_names = absl::GetFlag(FLAGS_benchmark_names);
   if (benchmark_names.empty()) {
     benchmark_names = absl::GetFlag(FLAGS_use_xds)
-                          ? "call,channel,channel_multi_address"
-                          : "call,channel";
+                          ? "call,channel,channel_multi_address,idle_channel"
+                          : "call,channel,idle_channel";
   }
   auto benchmarks = absl::StrSplit(benchmark_names, ',');
   grpc_init();
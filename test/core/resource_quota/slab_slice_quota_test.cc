@@ -0,0 +1,117 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Quota accounting of slices allocated from the slab allocator, with the
+// slab_slice_allocator experiment enabled.
+
+#include <grpc/slice.h>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/experiments/config.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slab_allocator.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+
+size_t BlocksInUse() {
+  size_t blocks = 0;
+  for (const auto& s : SlabAllocator::Get().GetStats().size_classes) {
+    blocks += s.blocks_in_use;
+  }
+  return blocks;
+}
+
+double Pressure(const MemoryOwner& owner) {
+  return owner.GetPressureInfo().instantaneous_pressure;
+}
+
+TEST(SlabSliceQuotaTest, SlicesReturnTheirBlocksToTheQuota) {
+  constexpr size_t kQuotaSize = 4 * 1024 * 1024;
+  constexpr size_t kSlices = 100;
+  constexpr size_t kLength = 1000;
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota("foo");
+  memory_quota.SetSize(kQuotaSize);
+  auto probe = memory_quota.CreateMemoryOwner();
+  const double idle_pressure = Pressure(probe);
+  auto owner = memory_quota.CreateMemoryOwner();
+  const size_t blocks_in_use = BlocksInUse();
+  std::vector<grpc_slice> slices;
+  for (size_t i = 0; i < kSlices; i++) {
+    slices.push_back(owner.MakeSlice(MemoryRequest(kLength)));
+    EXPECT_EQ(GRPC_SLICE_LENGTH(slices.back()), kLength);
+  }
+  // The slices are slab blocks, each charged with its header and the whole
+  // payload of its size class.
+  EXPECT_EQ(BlocksInUse(), blocks_in_use + kSlices);
+  EXPECT_GE(Pressure(probe),
+            idle_pressure + static_cast<double>(
+                                kSlices * (SlabAllocator::kHeaderSize + 1024)) /
+                                kQuotaSize);
+  for (grpc_slice slice : slices) grpc_slice_unref(slice);
+  exec_ctx.Flush();
+  EXPECT_EQ(BlocksInUse(), blocks_in_use);
+  // Destroying the allocator checks that all it took was given back, and
+  // returns it to the quota.
+  owner.Reset();
+  EXPECT_EQ(Pressure(probe), idle_pressure);
+}
+
+TEST(SlabSliceQuotaTest, ReclamationReleasesIdleSlabs) {
+  constexpr size_t kQuotaSize = 32 * 1024 * 1024;
+  constexpr size_t kBlocks = 100;
+  ExecCtx exec_ctx;
+  auto memory_quota = ResourceQuota::Default()->memory_quota();
+  memory_quota->SetSize(kQuotaSize);
+  auto probe = memory_quota->CreateMemoryOwner();
+  // Spread blocks of the largest size class over several slabs, and free
+  // them: the slabs they leave empty are idle memory, charged to the default
+  // quota.
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < kBlocks; i++) {
+    blocks.push_back(
+        SlabAllocator::Get().Allocate(SlabAllocator::MaxPayloadSize()));
+    ASSERT_NE(blocks.back(), nullptr);
+  }
+  for (void* block : blocks) SlabAllocator::Get().Free(block);
+  exec_ctx.Flush();
+  ASSERT_GT(SlabAllocator::Get().GetIdleMemory().empty_slabs, 0);
+  const double charged_pressure = Pressure(probe);
+  EXPECT_GT(charged_pressure, 0);
+  // Running the quota short sweeps the benign reclaimers, which unmap the
+  // empty slabs.
+  auto owner = memory_quota->CreateMemoryOwner();
+  owner.Reserve(MemoryRequest(kQuotaSize));
+  exec_ctx.Flush();
+  EXPECT_EQ(SlabAllocator::Get().GetIdleMemory().empty_slabs, 0);
+  owner.Release(kQuotaSize);
+  owner.Reset();
+  EXPECT_LT(Pressure(probe), charged_pressure);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc_core::ForceEnableExperiment("slab_slice_allocator", true);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,238 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/slice/slab_allocator.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+SlabAllocator::Options TestOptions(
+    size_t max_mapped_bytes = 64 * SlabAllocator::kSlabSize) {
+  SlabAllocator::Options options;
+  options.huge_pages = SlabAllocator::HugePages::kNone;
+  options.max_mapped_bytes = max_mapped_bytes;
+  return options;
+}
+
+size_t BlocksInUse(const SlabAllocator::Stats& stats) {
+  size_t blocks = 0;
+  for (const auto& s : stats.size_classes) blocks += s.blocks_in_use;
+  return blocks;
+}
+
+TEST(SlabAllocatorTest, RoundsUpToSizeClasses) {
+  SlabAllocator allocator(TestOptions());
+  for (size_t length : {1, 64, 65, 1000, 8192, 8193, 16384, 65536}) {
+    size_t capacity = 0;
+    void* block = allocator.Allocate(length, &capacity);
+    ASSERT_NE(block, nullptr) << length;
+    EXPECT_GE(capacity, length);
+    EXPECT_LE(capacity, std::max<size_t>(64, 2 * length));
+    // The whole block is writable.
+    memset(block, 0xab, SlabAllocator::kHeaderSize + capacity);
+    // Payloads are 16 byte aligned.
+    EXPECT_EQ((reinterpret_cast<uintptr_t>(block) +
+               SlabAllocator::kHeaderSize) %
+                  16,
+              0);
+    allocator.Free(block);
+  }
+  EXPECT_EQ(allocator.Allocate(SlabAllocator::MaxPayloadSize() + 1), nullptr);
+}
+
+TEST(SlabAllocatorTest, ReusesFreedBlocks) {
+  SlabAllocator allocator(TestOptions());
+  std::set<void*> blocks;
+  for (int i = 0; i < 200; i++) {
+    void* block = allocator.Allocate(8192);
+    ASSERT_NE(block, nullptr);
+    EXPECT_TRUE(blocks.insert(block).second);
+  }
+  auto stats = allocator.GetStats();
+  const size_t slabs = stats.slabs_mapped;
+  EXPECT_EQ(BlocksInUse(stats), 200);
+  for (void* block : blocks) allocator.Free(block);
+  EXPECT_EQ(BlocksInUse(allocator.GetStats()), 0);
+  // Allocating the same again needs no more slabs.
+  blocks.clear();
+  for (int i = 0; i < 200; i++) {
+    void* block = allocator.Allocate(8192);
+    ASSERT_NE(block, nullptr);
+    EXPECT_TRUE(blocks.insert(block).second);
+  }
+  EXPECT_EQ(allocator.GetStats().slabs_mapped, slabs);
+  for (void* block : blocks) allocator.Free(block);
+  // The block freed last is the first one reused, while it is still hot.
+  void* block = allocator.Allocate(8000);
+  allocator.Free(block);
+  EXPECT_EQ(allocator.Allocate(8000), block);
+  allocator.Free(block);
+}
+
+TEST(SlabAllocatorTest, FailsOnceMemoryLimitIsReached) {
+  SlabAllocator allocator(TestOptions(SlabAllocator::kSlabSize));
+  std::vector<void*> blocks;
+  while (void* block = allocator.Allocate(65536)) blocks.push_back(block);
+  // One slab's worth.
+  EXPECT_EQ(blocks.size(),
+            (SlabAllocator::kSlabSize - 64) /
+                (SlabAllocator::kHeaderSize + 65536));
+  // Other size classes cannot map a slab either.
+  EXPECT_EQ(allocator.Allocate(100), nullptr);
+  allocator.Free(blocks.back());
+  blocks.pop_back();
+  EXPECT_NE(blocks.emplace_back(allocator.Allocate(65536)), nullptr);
+  for (void* block : blocks) allocator.Free(block);
+}
+
+TEST(SlabAllocatorTest, UnmapsEmptySlabs) {
+  SlabAllocator allocator(TestOptions());
+  std::vector<void*> blocks;
+  for (int i = 0; i < 8 * 31; i++) {
+    blocks.push_back(allocator.Allocate(65536));
+    ASSERT_NE(blocks.back(), nullptr);
+  }
+  EXPECT_EQ(allocator.GetStats().slabs_mapped, 8);
+  for (void* block : blocks) allocator.Free(block);
+  // Two empty slabs are kept, plus those the shard's cache still holds
+  // blocks of.
+  auto stats = allocator.GetStats();
+  EXPECT_LE(stats.empty_slabs, 2);
+  EXPECT_LE(stats.slabs_mapped, 4);
+  allocator.ReleaseFreeMemory();
+  stats = allocator.GetStats();
+  EXPECT_EQ(stats.slabs_mapped, 0);
+  EXPECT_EQ(stats.empty_slabs, 0);
+  EXPECT_EQ(BlocksInUse(stats), 0);
+}
+
+TEST(SlabAllocatorTest, EmptySlabIsTakenOverByOtherSizeClass) {
+  SlabAllocator allocator(TestOptions(2 * SlabAllocator::kSlabSize));
+  // Fills a first slab, and takes three blocks of a second.
+  std::vector<void*> blocks;
+  for (int i = 0; i < 31 + 3; i++) {
+    blocks.push_back(allocator.Allocate(65536));
+    ASSERT_NE(blocks.back(), nullptr);
+  }
+  EXPECT_EQ(allocator.GetStats().slabs_mapped, 2);
+  EXPECT_EQ(allocator.Allocate(100), nullptr);
+  // The shard caches up to three 64KB blocks, and keeps the ones it cached
+  // first: cache two blocks of the second slab first, and push the last
+  // block of the first slab out with the third.
+  allocator.Free(blocks[31]);
+  allocator.Free(blocks[32]);
+  for (int i = 0; i < 31; i++) allocator.Free(blocks[i]);
+  allocator.Free(blocks[33]);
+  EXPECT_EQ(allocator.GetStats().empty_slabs, 1);
+  // The empty slab goes to another size class, without mapping more.
+  void* block = allocator.Allocate(100);
+  EXPECT_NE(block, nullptr);
+  auto stats = allocator.GetStats();
+  EXPECT_EQ(stats.slabs_mapped, 2);
+  EXPECT_EQ(stats.empty_slabs, 0);
+  allocator.Free(block);
+}
+
+// Counts the calls to the allocator's IdleMemoryCallback.
+int idle_memory_callbacks = 0;
+
+TEST(SlabAllocatorTest, ReportsIdleMemory) {
+  idle_memory_callbacks = 0;
+  SlabAllocator allocator(TestOptions());
+  allocator.SetIdleMemoryCallback([]() { ++idle_memory_callbacks; });
+  EXPECT_EQ(idle_memory_callbacks, 1);
+  EXPECT_EQ(allocator.GetIdleMemory().bytes, 0);
+  void* block = allocator.Allocate(65536);
+  ASSERT_NE(block, nullptr);
+  // The rest of the slab is idle.
+  EXPECT_EQ(allocator.GetIdleMemory().bytes,
+            SlabAllocator::kSlabSize - (SlabAllocator::kHeaderSize + 65536));
+  EXPECT_EQ(allocator.GetIdleMemory().empty_slabs, 0);
+  EXPECT_EQ(idle_memory_callbacks, 2);
+  // Freeing the block only caches it.
+  allocator.Free(block);
+  EXPECT_EQ(idle_memory_callbacks, 2);
+  allocator.ReleaseFreeMemory();
+  EXPECT_EQ(allocator.GetIdleMemory().bytes, 0);
+  EXPECT_EQ(idle_memory_callbacks, 3);
+}
+
+TEST(SlabAllocatorTest, ReportsFragmentation) {
+  SlabAllocator allocator(TestOptions());
+  EXPECT_EQ(allocator.GetStats().ExternalFragmentation(), 0);
+  EXPECT_EQ(allocator.GetStats().InternalFragmentation(), 0);
+  // Goes in the 1536 byte class, leaving a third unused.
+  void* block = allocator.Allocate(1025);
+  auto stats = allocator.GetStats();
+  EXPECT_EQ(stats.slabs_mapped, 1);
+  EXPECT_NEAR(stats.InternalFragmentation(), 1.0 / 3, 0.01);
+  // A single block in a slab leaves nearly all of it free.
+  EXPECT_GT(stats.ExternalFragmentation(), 0.99);
+  bool found = false;
+  for (const auto& s : stats.size_classes) {
+    if (s.payload_size != 1536) continue;
+    found = true;
+    EXPECT_EQ(s.allocations, 1);
+    EXPECT_EQ(s.requested_bytes, 1025);
+    EXPECT_EQ(s.blocks_in_use, 1);
+    EXPECT_GT(s.blocks_mapped, 1000);
+  }
+  EXPECT_TRUE(found);
+  allocator.Free(block);
+}
+
+TEST(SlabAllocatorTest, ConcurrentAllocateAndFree) {
+  SlabAllocator allocator(TestOptions());
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&allocator, t]() {
+      std::vector<void*> blocks;
+      for (int i = 0; i < 10000; i++) {
+        const size_t length = 64 << ((i + t) % 11);
+        void* block = allocator.Allocate(length);
+        ASSERT_NE(block, nullptr);
+        memset(static_cast<char*>(block) + SlabAllocator::kHeaderSize, t,
+               length);
+        blocks.push_back(block);
+        if (blocks.size() > 16) {
+          allocator.Free(blocks.front());
+          blocks.erase(blocks.begin());
+        }
+      }
+      for (void* block : blocks) allocator.Free(block);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(BlocksInUse(allocator.GetStats()), 0);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -129,6 +129,37 @@ TEST_P(BdpEstimatorRandomTest, GetEstimateRandomValues) {
   }
 }
 
+TEST(BdpEstimatorTest, TracksBandwidthAndRtt) {
+  BdpEstimator est("test");
+  ExecCtx exec_ctx;
+  auto ping = [&est](int64_t bytes, int seconds) {
+    est.SchedulePing();
+    est.StartPing();
+    est.AddIncomingBytes(bytes);
+    g_clock.fetch_add(seconds);
+    est.CompletePing();
+  };
+  ping(1000, 2);
+  EXPECT_EQ(est.MaxBandwidth(), 500);
+  EXPECT_EQ(est.MinRttSeconds(), 2);
+  ping(3000, 3);
+  EXPECT_EQ(est.MaxBandwidth(), 1000);
+  EXPECT_EQ(est.MinRttSeconds(), 2);
+  EXPECT_FALSE(est.BandwidthPlateaued());
+  // Three rounds without 25% more bandwidth: the link is full.
+  ping(1100, 1);
+  ping(1100, 1);
+  EXPECT_FALSE(est.BandwidthPlateaued());
+  ping(1100, 1);
+  EXPECT_TRUE(est.BandwidthPlateaued());
+  EXPECT_EQ(est.MaxBandwidth(), 1100);
+  EXPECT_EQ(est.MinRttSeconds(), 1);
+  // Old samples age out of the window.
+  for (size_t i = 0; i < BdpEstimator::kNumSamples; i++) ping(100, 4);
+  EXPECT_EQ(est.MaxBandwidth(), 25);
+  EXPECT_EQ(est.MinRttSeconds(), 4);
+}
+
 INSTANTIATE_TEST_SUITE_P(TooManyNames, BdpEstimatorRandomTest,
                          ::testing::Values(3, 4, 6, 9, 13, 19, 28, 42, 63, 94,
                                            141, 211, 316, 474, 711));
@@ -0,0 +1,144 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/base64_simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/escaping.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace base64_simd {
+namespace {
+
+std::vector<Kernel> SupportedKernels() {
+  std::vector<Kernel> kernels;
+  for (Kernel kernel :
+       {Kernel::kNone, Kernel::kSsse3, Kernel::kAvx2, Kernel::kNeon}) {
+    if (KernelSupported(kernel)) kernels.push_back(kernel);
+  }
+  return kernels;
+}
+
+std::string RandomBytes(absl::BitGen& gen, size_t length) {
+  std::string bytes(length, '\0');
+  for (char& c : bytes) c = static_cast<char>(absl::Uniform<uint8_t>(gen));
+  return bytes;
+}
+
+const uint8_t* Bytes(absl::string_view s) {
+  return reinterpret_cast<const uint8_t*>(s.data());
+}
+
+class Base64SimdTest : public ::testing::TestWithParam<Kernel> {};
+
+TEST_P(Base64SimdTest, EncodesLikeScalarBase64) {
+  absl::BitGen gen;
+  for (size_t length = 0; length < 512; length++) {
+    std::string input = RandomBytes(gen, length);
+    std::string expected = absl::Base64Escape(input);
+    std::string output(expected.size(), '\0');
+    size_t consumed = Encode(GetParam(), Bytes(input), input.size(),
+                             reinterpret_cast<uint8_t*>(&output[0]));
+    ASSERT_EQ(consumed % 3, 0u);
+    ASSERT_LE(consumed, input.size());
+    EXPECT_EQ(output.substr(0, consumed / 3 * 4),
+              expected.substr(0, consumed / 3 * 4))
+        << "length " << length;
+    if (GetParam() != Kernel::kNone && length >= 64) {
+      EXPECT_GT(consumed, 0u);
+    }
+  }
+}
+
+TEST_P(Base64SimdTest, DecodesLikeScalarBase64) {
+  absl::BitGen gen;
+  for (size_t length = 0; length < 512; length += 3) {
+    std::string expected = RandomBytes(gen, length);
+    std::string input = absl::Base64Escape(expected);
+    std::string output(expected.size(), '\0');
+    size_t consumed =
+        Decode(GetParam(), Bytes(input), input.size(),
+               reinterpret_cast<uint8_t*>(&output[0]), output.size());
+    ASSERT_EQ(consumed % 4, 0u);
+    ASSERT_LE(consumed, input.size());
+    EXPECT_EQ(output.substr(0, consumed / 4 * 3),
+              expected.substr(0, consumed / 4 * 3))
+        << "length " << length;
+    if (GetParam() != Kernel::kNone && length >= 64) {
+      EXPECT_GT(consumed, 0u);
+    }
+  }
+}
+
+TEST_P(Base64SimdTest, DecodeStopsBeforeInvalidCharacters) {
+  absl::BitGen gen;
+  for (int i = 0; i < 2000; i++) {
+    std::string input = absl::Base64Escape(RandomBytes(gen, 192));
+    size_t bad_position = absl::Uniform<size_t>(gen, 0, input.size());
+    char bad_char;
+    do {
+      bad_char = static_cast<char>(absl::Uniform<uint8_t>(gen));
+    } while (absl::ascii_isalnum(static_cast<unsigned char>(bad_char)) ||
+             bad_char == '+' || bad_char == '/');
+    input[bad_position] = bad_char;
+    std::string output(input.size() / 4 * 3, '\0');
+    size_t consumed =
+        Decode(GetParam(), Bytes(input), input.size(),
+               reinterpret_cast<uint8_t*>(&output[0]), output.size());
+    EXPECT_LE(consumed, bad_position / 4 * 4)
+        << "bad char " << static_cast<int>(static_cast<uint8_t>(bad_char))
+        << " at " << bad_position;
+  }
+}
+
+TEST_P(Base64SimdTest, DecodeRespectsOutputLength) {
+  absl::BitGen gen;
+  std::string expected = RandomBytes(gen, 300);
+  std::string input = absl::Base64Escape(expected);
+  for (size_t out_length = 0; out_length <= expected.size(); out_length++) {
+    // One spare byte to catch writes past out_length.
+    std::string output(out_length + 1, '\xaa');
+    size_t consumed =
+        Decode(GetParam(), Bytes(input), input.size(),
+               reinterpret_cast<uint8_t*>(&output[0]), out_length);
+    ASSERT_LE(consumed / 4 * 3, out_length);
+    EXPECT_EQ(output[out_length], '\xaa') << "out_length " << out_length;
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernels, Base64SimdTest,
+                         ::testing::ValuesIn(SupportedKernels()),
+                         [](const ::testing::TestParamInfo<Kernel>& info) {
+                           return std::string(KernelName(info.param));
+                         });
+
+}  // namespace
+}  // namespace base64_simd
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
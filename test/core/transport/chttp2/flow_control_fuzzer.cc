@@ -356,6 +356,7 @@ void FlowControlFuzzer::PerformAction(FlowControlAction action,
       case FlowControlAction::Urgency::NO_ACTION_NEEDED:
         break;
       case FlowControlAction::Urgency::UPDATE_IMMEDIATELY:
+      case FlowControlAction::Urgency::UPDATE_SOON:
         scheduled_write_ = true;
         [[fallthrough]];
       case FlowControlAction::Urgency::QUEUE_UPDATE:
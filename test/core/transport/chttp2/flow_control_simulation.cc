@@ -0,0 +1,315 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test/core/transport/chttp2/flow_control_simulation.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <random>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "test/core/event_engine/fuzzing_event_engine/fuzzing_event_engine.h"
+#include "test/core/event_engine/fuzzing_event_engine/fuzzing_event_engine.pb.h"
+
+namespace grpc_core {
+namespace chttp2 {
+
+namespace {
+
+using grpc_event_engine::experimental::FuzzingEventEngine;
+
+class Simulator {
+ public:
+  explicit Simulator(const FlowControlSimulation::Options& options)
+      : options_(options),
+        rng_(options.seed),
+        engine_(std::make_shared<FuzzingEventEngine>(
+            FuzzingEventEngine::Options(), fuzzing_event_engine::Actions())),
+        start_(engine_->Now()) {
+    // BdpEstimator jitters its ping interval with rand().
+    srand(static_cast<unsigned>(options.seed));
+    ExecCtx exec_ctx;
+    tfc_.emplace("simulation", /*enable_bdp_probe=*/true, &memory_owner_);
+    tfc_->set_window_policy(options.window_policy);
+    sfc_.emplace(&*tfc_);
+  }
+
+  ~Simulator() {
+    ExecCtx exec_ctx;
+    sfc_.reset();
+    tfc_.reset();
+  }
+
+  FlowControlSimulation::Result Run() {
+    At(0, [this]() {
+      // As the chttp2 transport does on startup.
+      ping_blocked_ = true;
+      Act(tfc_->PeriodicUpdate());
+      TrySend();
+    });
+    At(0, [this]() { TakeSample(); });
+    if (options_.read_rate > 0) At(0, [this]() { ReadSome(); });
+    engine_->TickUntil(start_ + ToChrono(options_.duration.seconds()));
+    FlowControlSimulation::Result result;
+    result.throughput =
+        static_cast<double>(bytes_read_) / options_.duration.seconds();
+    result.max_buffered = max_buffered_;
+    result.mean_buffered = samples_.empty()
+                               ? 0
+                               : static_cast<double>(total_sampled_buffered_) /
+                                     static_cast<double>(samples_.size());
+    result.trace = std::move(samples_);
+    return result;
+  }
+
+ private:
+  static constexpr double kReadInterval = 0.001;
+
+  static FuzzingEventEngine::Duration ToChrono(double seconds) {
+    return std::chrono::nanoseconds(static_cast<int64_t>(seconds * 1e9));
+  }
+
+  double Now() {
+    return std::chrono::duration<double>(engine_->Now() - start_).count();
+  }
+
+  double OneWayDelay() const { return options_.rtt.seconds() / 2; }
+
+  double BandwidthAt(double time) const {
+    double bandwidth = options_.bandwidth;
+    for (const auto& change : options_.bandwidth_schedule) {
+      if (change.first.seconds() > time) break;
+      bandwidth = change.second;
+    }
+    return bandwidth;
+  }
+
+  // Runs fn at the given simulated time (seconds since start).
+  void At(double time, absl::AnyInvocable<void()> fn) {
+    engine_->RunAfterExactly(
+        ToChrono(std::max(0.0, time - Now())), [fn = std::move(fn)]() mutable {
+          ExecCtx exec_ctx;
+          fn();
+        });
+  }
+
+  // Sends a control frame from the sender to the receiver: it leaves once
+  // the DATA frames already queued on the link are out.
+  void SendToReceiver(absl::AnyInvocable<void()> fn) {
+    double arrival = std::max(Now(), link_free_at_) + OneWayDelay();
+    arrival = std::max(arrival, last_arrival_);
+    last_arrival_ = arrival;
+    At(arrival, std::move(fn));
+  }
+
+  void SendToSender(absl::AnyInvocable<void()> fn) {
+    At(Now() + OneWayDelay(), std::move(fn));
+  }
+
+  // Sender side.
+
+  void TrySend() {
+    if (send_scheduled_) return;
+    if (Now() < link_free_at_) {
+      send_scheduled_ = true;
+      At(link_free_at_, [this]() {
+        send_scheduled_ = false;
+        SendFrame();
+      });
+      return;
+    }
+    SendFrame();
+  }
+
+  // Sends one DATA frame if the windows allow, once the link is free. Does
+  // not compare against the clock again: timers are rounded to nanoseconds,
+  // so the callback above may run a hair before link_free_at_.
+  void SendFrame() {
+    const int64_t window =
+        std::min(transport_window_, peer_initial_window_ + stream_delta_);
+    if (window <= 0) return;
+    const double start = std::max(Now(), link_free_at_);
+    const int64_t size = std::min<int64_t>(options_.frame_size, window);
+    transport_window_ -= size;
+    stream_delta_ -= size;
+    in_flight_ += size;
+    link_free_at_ = start + static_cast<double>(size) / BandwidthAt(start);
+    double arrival = link_free_at_ + OneWayDelay();
+    if (std::bernoulli_distribution(options_.loss)(rng_)) {
+      arrival += options_.rtt.seconds();
+    }
+    arrival = std::max(arrival, last_arrival_);
+    last_arrival_ = arrival;
+    At(arrival, [this, size]() { RecvData(size); });
+    TrySend();
+  }
+
+  // Receiver side.
+
+  void RecvData(int64_t size) {
+    in_flight_ -= size;
+    BdpEstimator* bdp = tfc_->bdp_estimator();
+    if (ping_blocked_) {
+      ping_blocked_ = false;
+      SendPing();
+    }
+    bdp->AddIncomingBytes(size);
+    StreamFlowControl::IncomingUpdateContext upd(&*sfc_);
+    absl::Status status = upd.RecvData(size);
+    CHECK(status.ok()) << status;
+    buffered_ += size;
+    max_buffered_ = std::max(max_buffered_, buffered_);
+    if (options_.read_rate == 0) {
+      bytes_read_ += buffered_;
+      buffered_ = 0;
+    }
+    upd.SetPendingSize(buffered_);
+    Act(upd.MakeAction());
+  }
+
+  void ReadSome() {
+    const int64_t n = std::min<int64_t>(
+        buffered_, static_cast<int64_t>(options_.read_rate * kReadInterval));
+    if (n > 0) {
+      buffered_ -= n;
+      bytes_read_ += n;
+      StreamFlowControl::IncomingUpdateContext upd(&*sfc_);
+      upd.SetPendingSize(buffered_);
+      Act(upd.MakeAction());
+    }
+    At(Now() + kReadInterval, [this]() { ReadSome(); });
+  }
+
+  void SendPing() {
+    BdpEstimator* bdp = tfc_->bdp_estimator();
+    bdp->SchedulePing();
+    bdp->StartPing();
+    SendToSender([this]() {
+      SendToReceiver([this]() { RecvPingAck(); });
+    });
+  }
+
+  void RecvPingAck() {
+    Timestamp next_ping = tfc_->bdp_estimator()->CompletePing();
+    Act(tfc_->PeriodicUpdate());
+    At(Now() + (next_ping - Timestamp::Now()).seconds(), [this]() {
+      if (tfc_->bdp_estimator()->accumulator() == 0) {
+        ping_blocked_ = true;
+      } else {
+        SendPing();
+      }
+    });
+  }
+
+  void Act(const FlowControlAction& action) {
+    if (action.send_initial_window_update() !=
+        FlowControlAction::Urgency::NO_ACTION_NEEDED) {
+      const uint32_t initial_window = action.initial_window_size();
+      tfc_->FlushedSettings();
+      SendToSender([this, initial_window]() {
+        peer_initial_window_ = initial_window;
+        TrySend();
+        SendToReceiver([this, initial_window]() {
+          Act(tfc_->SetAckedInitialWindow(initial_window));
+        });
+      });
+    }
+    if (action.send_stream_update() !=
+        FlowControlAction::Urgency::NO_ACTION_NEEDED) {
+      const uint32_t announce = sfc_->MaybeSendUpdate();
+      if (announce > 0) {
+        SendToSender([this, announce]() {
+          stream_delta_ += announce;
+          TrySend();
+        });
+      }
+    }
+    const uint32_t announce = tfc_->MaybeSendUpdate(/*writing_anyway=*/true);
+    if (announce > 0) {
+      SendToSender([this, announce]() {
+        transport_window_ += announce;
+        TrySend();
+      });
+    }
+  }
+
+  void TakeSample() {
+    samples_.push_back(FlowControlSimulation::Sample{
+        Duration::FromSecondsAsDouble(Now()), bytes_read_, buffered_,
+        in_flight_, tfc_->queued_init_window(),
+        tfc_->bdp_estimator()->EstimateBdp()});
+    total_sampled_buffered_ += buffered_;
+    At(Now() + options_.sample_interval.seconds(), [this]() { TakeSample(); });
+  }
+
+  const FlowControlSimulation::Options options_;
+  std::mt19937_64 rng_;
+  MemoryQuotaRefPtr memory_quota_ = MakeMemoryQuota("simulation");
+  MemoryOwner memory_owner_ = memory_quota_->CreateMemoryOwner();
+  std::optional<TransportFlowControl> tfc_;
+  std::optional<StreamFlowControl> sfc_;
+
+  // Sender state.
+  int64_t transport_window_ = kDefaultWindow;
+  int64_t peer_initial_window_ = kDefaultWindow;
+  int64_t stream_delta_ = 0;
+  bool send_scheduled_ = false;
+
+  // Link state, in seconds since the start.
+  double link_free_at_ = 0;
+  double last_arrival_ = 0;
+  int64_t in_flight_ = 0;
+
+  // Receiver state.
+  bool ping_blocked_ = false;
+  int64_t buffered_ = 0;
+  int64_t max_buffered_ = 0;
+  int64_t bytes_read_ = 0;
+
+  std::vector<FlowControlSimulation::Sample> samples_;
+  int64_t total_sampled_buffered_ = 0;
+
+  // Declared last: destroyed first, dropping the pending tasks that refer to
+  // the state above.
+  std::shared_ptr<FuzzingEventEngine> engine_;
+  const FuzzingEventEngine::Time start_;
+};
+
+}  // namespace
+
+std::string FlowControlSimulation::Result::TraceString() const {
+  return absl::StrJoin(trace, "\n", [](std::string* out, const Sample& s) {
+    absl::StrAppend(out, "t=", s.time.millis(), "ms read=", s.bytes_read,
+                    " buffered=", s.buffered, " in_flight=", s.in_flight,
+                    " target_window=", s.target_window,
+                    " bdp=", s.bdp_estimate);
+  });
+}
+
+FlowControlSimulation::Result FlowControlSimulation::Run(
+    const Options& options) {
+  return Simulator(options).Run();
+}
+
+}  // namespace chttp2
+}  // namespace grpc_core
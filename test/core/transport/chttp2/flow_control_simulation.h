@@ -0,0 +1,96 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_TEST_CORE_TRANSPORT_CHTTP2_FLOW_CONTROL_SIMULATION_H
+#define GRPC_TEST_CORE_TRANSPORT_CHTTP2_FLOW_CONTROL_SIMULATION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/flow_control.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace chttp2 {
+
+// Deterministic simulation of one bulk HTTP/2 stream over a network link.
+//
+// The receiver runs TransportFlowControl and StreamFlowControl the way chttp2
+// does, including BDP pings; the sender writes DATA frames whenever the
+// windows it was granted allow. Time is driven by a FuzzingEventEngine, so a
+// run takes milliseconds whatever the simulated duration, and the same
+// options always produce the same trace.
+//
+// The link model is simple: frames are serialized at the link bandwidth and
+// arrive half a round trip later, in order (as over TCP). Control frames
+// (WINDOW_UPDATE, SETTINGS, PING) take no bandwidth, but acks sent by the
+// sender queue behind its DATA frames. Flow control updates are sent as soon
+// as they are due, as chttp2 does while it is writing anyway.
+struct FlowControlSimulation {
+  struct Options {
+    // Round trip propagation delay.
+    Duration rtt = Duration::Milliseconds(50);
+    // Link bandwidth, in bytes per second.
+    double bandwidth = 12.5e6;
+    // Bandwidth changes, as (time since start, bytes per second) pairs sorted
+    // by time. Allows replaying the bandwidth trace of a real link.
+    std::vector<std::pair<Duration, double>> bandwidth_schedule;
+    // Probability that a DATA frame is lost. TCP retransmits it one round trip
+    // later, and holds back the frames behind it meanwhile.
+    double loss = 0;
+    // Rate at which the application reads, in bytes per second. 0 reads data
+    // as soon as it arrives.
+    double read_rate = 0;
+    uint32_t frame_size = kDefaultFrameSize;
+    WindowPolicy window_policy = WindowPolicy::kBdp;
+    Duration duration = Duration::Seconds(10);
+    Duration sample_interval = Duration::Milliseconds(100);
+    uint64_t seed = 0;
+  };
+
+  struct Sample {
+    Duration time;
+    // Total bytes read by the application so far.
+    int64_t bytes_read;
+    // Bytes received but not read yet.
+    int64_t buffered;
+    // Bytes sent but not received yet.
+    int64_t in_flight;
+    // Initial window the receiver wants to advertise.
+    uint32_t target_window;
+    int64_t bdp_estimate;
+  };
+
+  struct Result {
+    // Bytes per second read by the application over the whole run.
+    double throughput;
+    int64_t max_buffered;
+    double mean_buffered;
+    std::vector<Sample> trace;
+
+    // One line per sample.
+    std::string TraceString() const;
+  };
+
+  static Result Run(const Options& options);
+};
+
+}  // namespace chttp2
+}  // namespace grpc_core
+
+#endif  // GRPC_TEST_CORE_TRANSPORT_CHTTP2_FLOW_CONTROL_SIMULATION_H
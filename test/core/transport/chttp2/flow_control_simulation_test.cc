@@ -0,0 +1,122 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test/core/transport/chttp2/flow_control_simulation.h"
+
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/flow_control.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace chttp2 {
+namespace {
+
+using Options = FlowControlSimulation::Options;
+
+class FlowControlSimulationTest
+    : public ::testing::TestWithParam<WindowPolicy> {
+ protected:
+  Options MakeOptions() {
+    Options options;
+    options.window_policy = GetParam();
+    return options;
+  }
+};
+
+TEST_P(FlowControlSimulationTest, SameOptionsGiveSameTrace) {
+  Options options = MakeOptions();
+  options.loss = 0.01;
+  options.seed = 42;
+  auto a = FlowControlSimulation::Run(options);
+  auto b = FlowControlSimulation::Run(options);
+  EXPECT_EQ(a.TraceString(), b.TraceString());
+  options.seed = 43;
+  auto c = FlowControlSimulation::Run(options);
+  EXPECT_NE(a.TraceString(), c.TraceString());
+}
+
+TEST_P(FlowControlSimulationTest, FillsLongFatLink) {
+  Options options = MakeOptions();
+  // 100Mbps over 100ms: the BDP is more than the default window many times.
+  options.rtt = Duration::Milliseconds(100);
+  options.bandwidth = 12.5e6;
+  options.duration = Duration::Seconds(20);
+  auto result = FlowControlSimulation::Run(options);
+  EXPECT_GT(result.throughput, 0.9 * options.bandwidth)
+      << result.TraceString();
+}
+
+TEST_P(FlowControlSimulationTest, FollowsBandwidthSchedule) {
+  Options options = MakeOptions();
+  options.rtt = Duration::Milliseconds(20);
+  options.bandwidth = 12.5e6;
+  options.bandwidth_schedule = {{Duration::Seconds(5), 1.25e6}};
+  auto result = FlowControlSimulation::Run(options);
+  const double capacity = (5 * 12.5e6 + 5 * 1.25e6) / 10;
+  EXPECT_LE(result.throughput, capacity);
+  EXPECT_GT(result.throughput, 0.9 * capacity) << result.TraceString();
+}
+
+TEST_P(FlowControlSimulationTest, KeepsGoingUnderLoss) {
+  Options options = MakeOptions();
+  options.rtt = Duration::Milliseconds(20);
+  options.bandwidth = 12.5e6;
+  options.loss = 0.01;
+  auto result = FlowControlSimulation::Run(options);
+  EXPECT_GT(result.throughput, 0.8 * options.bandwidth)
+      << result.TraceString();
+}
+
+TEST_P(FlowControlSimulationTest, SlowReaderIsNotStarved) {
+  Options options = MakeOptions();
+  options.rtt = Duration::Milliseconds(20);
+  options.bandwidth = 12.5e6;
+  options.read_rate = options.bandwidth / 2;
+  auto result = FlowControlSimulation::Run(options);
+  EXPECT_GT(result.throughput, 0.95 * options.read_rate)
+      << result.TraceString();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    FlowControlSimulationTest, FlowControlSimulationTest,
+    ::testing::Values(WindowPolicy::kBdp, WindowPolicy::kBbr),
+    [](const ::testing::TestParamInfo<WindowPolicy>& info) {
+      return info.param == WindowPolicy::kBbr ? "Bbr" : "Bdp";
+    });
+
+// With a reader slower than the link, the BDP policy still advertises at least
+// 4MB, all of which ends up buffered; the BBR policy sizes the window from the
+// delivery rate instead.
+TEST(WindowPolicyTest, BbrBuffersLessForSlowReader) {
+  Options options;
+  options.rtt = Duration::Milliseconds(20);
+  options.bandwidth = 1.25e6;
+  options.read_rate = options.bandwidth / 2;
+  options.window_policy = WindowPolicy::kBdp;
+  auto bdp = FlowControlSimulation::Run(options);
+  options.window_policy = WindowPolicy::kBbr;
+  auto bbr = FlowControlSimulation::Run(options);
+  EXPECT_LT(bbr.mean_buffered * 4, bdp.mean_buffered);
+  EXPECT_LT(bbr.max_buffered * 4, bdp.max_buffered);
+  EXPECT_GT(bbr.throughput, 0.95 * bdp.throughput);
+}
+
+}  // namespace
+}  // namespace chttp2
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -242,6 +242,7 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
   TransportFlowControl tfc("test", true, &memory_owner_);
   StreamFlowControl sfc(&tfc);
   int immediate_updates = 0;
+  int soon_updates = 0;
   int queued_updates = 0;
   for (int i = 0; i < 65535; i++) {
     StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
@@ -251,6 +252,9 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
       case FlowControlAction::Urgency::UPDATE_IMMEDIATELY:
         immediate_updates++;
         break;
+      case FlowControlAction::Urgency::UPDATE_SOON:
+        soon_updates++;
+        break;
       case FlowControlAction::Urgency::QUEUE_UPDATE:
         queued_updates++;
         break;
@@ -260,7 +264,37 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
   }
   EXPECT_GE(immediate_updates, 0);
   EXPECT_GT(queued_updates, 0);
-  EXPECT_EQ(immediate_updates + queued_updates, 65535);
+  EXPECT_EQ(immediate_updates + soon_updates + queued_updates, 65535);
+}
+
+TEST_F(FlowControlTest, UpdateUrgencyGrowsAsWindowIsConsumed) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  StreamFlowControl sfc(&tfc);
+  auto recv = [&sfc](int64_t bytes) {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(bytes), absl::OkStatus());
+    sfc_upd.SetPendingSize(0);
+    return sfc_upd.MakeAction();
+  };
+  // A quarter of the window consumed: updates ride along with the next write.
+  FlowControlAction action = recv(16384);
+  EXPECT_EQ(action.send_stream_update(),
+            FlowControlAction::Urgency::QUEUE_UPDATE);
+  EXPECT_EQ(action.send_transport_update(),
+            FlowControlAction::Urgency::NO_ACTION_NEEDED);
+  // Past half of it, they should go out soon...
+  action = recv(24576);
+  EXPECT_EQ(action.send_stream_update(),
+            FlowControlAction::Urgency::UPDATE_SOON);
+  EXPECT_EQ(action.send_transport_update(),
+            FlowControlAction::Urgency::UPDATE_SOON);
+  // ...and once the peer is about to stall, right away.
+  action = recv(16384);
+  EXPECT_EQ(action.send_stream_update(),
+            FlowControlAction::Urgency::UPDATE_IMMEDIATELY);
+  EXPECT_EQ(action.send_transport_update(),
+            FlowControlAction::Urgency::UPDATE_IMMEDIATELY);
 }
 
 }  // namespace chttp2
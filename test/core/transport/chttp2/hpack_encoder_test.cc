@@ -27,9 +27,11 @@
 #include <string>
 
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
@@ -180,10 +182,8 @@ class FakeCallTracer final : public CallTracerInterface {
 }  // namespace grpc_core
 
 grpc_slice EncodeHeaderIntoBytes(
-    bool is_eof,
+    grpc_core::HPackCompressor* compressor, bool is_eof,
     const std::vector<std::pair<std::string, std::string>>& header_fields) {
-  std::unique_ptr<grpc_core::HPackCompressor> compressor =
-      std::make_unique<grpc_core::HPackCompressor>();
   grpc_metadata_batch b;
 
   for (const auto& field : header_fields) {
@@ -211,6 +211,13 @@ grpc_slice EncodeHeaderIntoBytes(
   return ret;
 }
 
+grpc_slice EncodeHeaderIntoBytes(
+    bool is_eof,
+    const std::vector<std::pair<std::string, std::string>>& header_fields) {
+  grpc_core::HPackCompressor compressor;
+  return EncodeHeaderIntoBytes(&compressor, is_eof, header_fields);
+}
+
 // verify that the output generated by encoding the stream matches the
 // hexstring passed in
 static void verify(
@@ -325,6 +332,119 @@ TEST(HpackEncoderTest, UserAgentMetadataNoIndexing) {
   grpc_slice_unref(encoded_header);
 }
 
+MATCHER_P(HasIndexedHeaderField, index, "") {
+  constexpr size_t kHttp2FrameHeaderSize = 9u;
+  /// Reference: https://httpwg.org/specs/rfc7541.html#rfc.section.6.1
+  /// An indexed header field sets the top bit, followed by the index.
+  return (GRPC_SLICE_START_PTR(arg)[kHttp2FrameHeaderSize] == (0x80 | index));
+}
+
+TEST(HpackEncoderTest, RepeatedUnknownMetadataIsIndexed) {
+  if (!grpc_core::IsHpackIndexUnknownMetadataEnabled()) {
+    GTEST_SKIP() << "hpack_index_unknown_metadata experiment is disabled";
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+
+  // Seen once: not worth a table entry yet.
+  grpc_slice encoded_header =
+      EncodeHeaderIntoBytes(&compressor, false, {{"x-tenant-id", "tenant-1"}});
+  EXPECT_THAT(encoded_header, HasLiteralHeaderFieldNewNameFlagNoIndexing());
+  grpc_slice_unref(encoded_header);
+  // Seen twice: added to the table.
+  encoded_header =
+      EncodeHeaderIntoBytes(&compressor, false, {{"x-tenant-id", "tenant-1"}});
+  EXPECT_THAT(encoded_header,
+              HasLiteralHeaderFieldNewNameFlagIncrementalIndexing());
+  grpc_slice_unref(encoded_header);
+  // From then on, sent as the first dynamic table entry.
+  for (int i = 0; i < 3; i++) {
+    encoded_header = EncodeHeaderIntoBytes(&compressor, false,
+                                           {{"x-tenant-id", "tenant-1"}});
+    EXPECT_EQ(GRPC_SLICE_LENGTH(encoded_header), 10u);
+    EXPECT_THAT(encoded_header, HasIndexedHeaderField(62));
+    grpc_slice_unref(encoded_header);
+  }
+}
+
+TEST(HpackEncoderTest, UniqueUnknownMetadataIsNotIndexed) {
+  if (!grpc_core::IsHpackIndexUnknownMetadataEnabled()) {
+    GTEST_SKIP() << "hpack_index_unknown_metadata experiment is disabled";
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+
+  for (int i = 0; i < 2000; i++) {
+    const grpc_slice encoded_header = EncodeHeaderIntoBytes(
+        &compressor, false, {{"x-request-id", absl::StrCat("request-", i)}});
+    EXPECT_THAT(encoded_header, HasLiteralHeaderFieldNewNameFlagNoIndexing());
+    grpc_slice_unref(encoded_header);
+  }
+  EXPECT_EQ(compressor.test_only_table_size(), 0u);
+  // Tracking is bounded to 16KiB of HPACK entry size.
+  EXPECT_LE(compressor.test_only_unknown_metadata_tracked_bytes(), 16384u);
+}
+
+TEST(HpackEncoderTest, RepeatedUnknownMetadataSurvivesUniqueValues) {
+  if (!grpc_core::IsHpackIndexUnknownMetadataEnabled()) {
+    GTEST_SKIP() << "hpack_index_unknown_metadata experiment is disabled";
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+
+  for (int i = 0; i < 2000; i++) {
+    const grpc_slice encoded_header = EncodeHeaderIntoBytes(
+        &compressor, false,
+        {{"x-routing-shard-bin", "shard-7"},
+         {"x-request-id", absl::StrCat("request-", i)}});
+    if (i >= 2) EXPECT_THAT(encoded_header, HasIndexedHeaderField(62));
+    grpc_slice_unref(encoded_header);
+  }
+  EXPECT_LE(compressor.test_only_unknown_metadata_tracked_bytes(), 16384u);
+}
+
+MATCHER(HasLiteralHeaderFieldNewNameFlagNeverIndexed, "") {
+  constexpr size_t kHttp2FrameHeaderSize = 9u;
+  /// Reference: https://httpwg.org/specs/rfc7541.html#rfc.section.6.2.3
+  /// The first byte of a never indexed literal header field should be 0x10.
+  constexpr uint8_t kLiteralHeaderFieldNewNameFlagNeverIndexed = 0x10;
+  return (GRPC_SLICE_START_PTR(arg)[kHttp2FrameHeaderSize] ==
+          kLiteralHeaderFieldNewNameFlagNeverIndexed);
+}
+
+TEST(HpackEncoderTest, SensitiveUnknownMetadataIsNeverIndexed) {
+  if (!grpc_core::IsHpackIndexUnknownMetadataEnabled()) {
+    GTEST_SKIP() << "hpack_index_unknown_metadata experiment is disabled";
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+
+  for (const char* key : {"authorization", "proxy-authorization", "cookie",
+                          "x-api-key", "x-session-token",
+                          "x-signing-key-bin"}) {
+    for (int i = 0; i < 3; i++) {
+      const grpc_slice encoded_header =
+          EncodeHeaderIntoBytes(&compressor, false, {{key, "secret"}});
+      EXPECT_THAT(encoded_header,
+                  HasLiteralHeaderFieldNewNameFlagNeverIndexed())
+          << key;
+      grpc_slice_unref(encoded_header);
+    }
+  }
+  EXPECT_EQ(compressor.test_only_table_size(), 0u);
+  EXPECT_EQ(compressor.test_only_unknown_metadata_tracked_bytes(), 0u);
+  // Keys that merely contain the words are still indexed.
+  for (int i = 0; i < 2; i++) {
+    const grpc_slice encoded_header = EncodeHeaderIntoBytes(
+        &compressor, false, {{"x-token-count", "3"}});
+    if (i == 1) {
+      EXPECT_THAT(encoded_header,
+                  HasLiteralHeaderFieldNewNameFlagIncrementalIndexing());
+    }
+    grpc_slice_unref(encoded_header);
+  }
+}
+
 static void verify_continuation_headers(const char* key, const char* value,
                                         bool is_eof) {
   grpc_core::MemoryAllocator memory_allocator =
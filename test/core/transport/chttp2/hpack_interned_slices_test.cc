@@ -0,0 +1,92 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/hpack_interned_slices.h"
+
+#include <grpc/slice.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr size_t kCapacity = HPackInternedSlices::kNumShards *
+                             HPackInternedSlices::kMaxEntriesPerShard;
+
+TEST(HPackInternedSlicesTest, EqualValuesShareABuffer) {
+  const std::string value = "/grpc.testing.TestService/UnaryCall";
+  Slice a = HPackInternedSlices::Intern(value);
+  Slice b = HPackInternedSlices::Intern(std::string(value));
+  EXPECT_EQ(a.as_string_view(), value);
+  EXPECT_EQ(b.as_string_view(), value);
+  EXPECT_EQ(a.data(), b.data());
+  Slice c =
+      HPackInternedSlices::Intern("/grpc.testing.TestService/StreamingCall");
+  EXPECT_NE(a.data(), c.data());
+}
+
+TEST(HPackInternedSlicesTest, ShortValuesAreInlined) {
+  const std::string value(HPackInternedSlices::kMinInternedLength - 1, 'a');
+  Slice a = HPackInternedSlices::Intern(value);
+  EXPECT_EQ(a.as_string_view(), value);
+  EXPECT_EQ(a.c_slice().refcount, nullptr);
+}
+
+TEST(HPackInternedSlicesTest, LongValuesAreCopied) {
+  const std::string value(HPackInternedSlices::kMaxInternedLength + 1, 'a');
+  Slice a = HPackInternedSlices::Intern(value);
+  Slice b = HPackInternedSlices::Intern(value);
+  EXPECT_EQ(a.as_string_view(), value);
+  EXPECT_EQ(b.as_string_view(), value);
+  EXPECT_NE(a.data(), b.data());
+}
+
+TEST(HPackInternedSlicesTest, DropsUnusedValuesWhenFull) {
+  for (size_t i = 0; i < 4 * kCapacity; i++) {
+    std::string value = absl::StrCat("unused-value-that-is-not-inlined-", i);
+    EXPECT_EQ(HPackInternedSlices::Intern(value).as_string_view(), value);
+  }
+  EXPECT_LE(HPackInternedSlices::TestOnlySize(), kCapacity);
+  // Values that are in use are kept, even after the cache fills up again.
+  const std::string value = "a-value-that-stays-in-use";
+  Slice in_use = HPackInternedSlices::Intern(value);
+  for (size_t i = 0; i < 4 * kCapacity; i++) {
+    HPackInternedSlices::Intern(absl::StrCat("another-unused-value-", i));
+  }
+  EXPECT_EQ(HPackInternedSlices::Intern(value).data(), in_use.data());
+}
+
+TEST(HPackInternedSlicesTest, CopiesWhenFullOfValuesInUse) {
+  std::vector<Slice> in_use;
+  for (size_t i = 0; i < 2 * kCapacity; i++) {
+    std::string value = absl::StrCat("value-in-use-that-is-not-inlined-", i);
+    in_use.push_back(HPackInternedSlices::Intern(value));
+    EXPECT_EQ(in_use.back().as_string_view(), value);
+  }
+  EXPECT_LE(HPackInternedSlices::TestOnlySize(), kCapacity);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -188,6 +188,44 @@ TEST(HpackParserTableTest, ManyUnusedAdditions) {
   EXPECT_GT(num_buckets_changed, 0);
 }
 
+TEST(HpackParserTableTest, ShrinkToZeroAndRegrow) {
+  HPackTable tbl;
+
+  ExecCtx exec_ctx;
+
+  auto add = [&tbl](int i) {
+    std::string key = absl::StrCat("K.", i);
+    std::string value = absl::StrCat("VALUE.", i);
+    auto memento = HPackTable::Memento{
+        ParsedMetadata<grpc_metadata_batch>(
+            ParsedMetadata<grpc_metadata_batch>::FromSlicePair{},
+            Slice::FromCopiedString(key), Slice::FromCopiedString(value),
+            key.length() + value.length() + 32),
+        nullptr};
+    return tbl.Add(std::move(memento));
+  };
+
+  // Enough entries for the ring buffer to wrap around.
+  for (int i = 0; i < 1000; i++) ASSERT_TRUE(add(i));
+  EXPECT_GT(tbl.num_entries(), 0u);
+
+  // Shrinking (as done for idle connections) drops every entry.
+  tbl.SetMaxBytes(0);
+  EXPECT_EQ(tbl.num_entries(), 0u);
+  EXPECT_EQ(tbl.test_only_table_size(), 0u);
+  ASSERT_TRUE(tbl.SetCurrentTableSize(0));
+
+  // Growing back makes the table usable again.
+  tbl.SetMaxBytes(hpack_constants::kInitialTableSize);
+  ASSERT_TRUE(tbl.SetCurrentTableSize(hpack_constants::kInitialTableSize));
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_TRUE(add(i));
+    AssertIndex(&tbl, 1 + hpack_constants::kLastStaticEntry,
+                absl::StrCat("K.", i).c_str(),
+                absl::StrCat("VALUE.", i).c_str());
+  }
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
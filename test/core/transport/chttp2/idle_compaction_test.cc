@@ -0,0 +1,426 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/status.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/surface/completion_queue.h"
+#include "src/core/server/server.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/crash.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/sync.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr uint8_t kHeadersFrame = 0x01;
+constexpr uint8_t kSettingsFrame = 0x04;
+constexpr uint8_t kEndStreamFlag = 0x01;
+constexpr uint8_t kAckFlag = 0x01;
+constexpr uint16_t kHeaderTableSizeSetting = 0x01;
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+struct Frame {
+  uint8_t type;
+  uint8_t flags;
+  uint32_t stream_id;
+  std::string payload;
+};
+
+std::string FrameHeader(size_t length, uint8_t type, uint8_t flags,
+                        uint32_t stream_id) {
+  const char header[] = {static_cast<char>(length >> 16),
+                         static_cast<char>(length >> 8),
+                         static_cast<char>(length),
+                         static_cast<char>(type),
+                         static_cast<char>(flags),
+                         static_cast<char>(stream_id >> 24),
+                         static_cast<char>(stream_id >> 16),
+                         static_cast<char>(stream_id >> 8),
+                         static_cast<char>(stream_id)};
+  return std::string(header, sizeof(header));
+}
+
+// A literal header field with a new name. Keys and values must be shorter
+// than 127 bytes.
+std::string LiteralHeader(uint8_t type, absl::string_view key,
+                          absl::string_view value) {
+  return absl::StrCat(std::string(1, static_cast<char>(type)),
+                      std::string(1, static_cast<char>(key.size())), key,
+                      std::string(1, static_cast<char>(value.size())), value);
+}
+
+// A HEADERS frame for a request without a body, with extra_fields appended
+// to the header block.
+std::string RequestFrame(uint32_t stream_id, absl::string_view extra_fields) {
+  constexpr uint8_t kNeverIndexed = 0x10;
+  const std::string block = absl::StrCat(
+      LiteralHeader(kNeverIndexed, ":path", "/foo/bar"),
+      LiteralHeader(kNeverIndexed, ":scheme", "http"),
+      LiteralHeader(kNeverIndexed, ":method", "POST"),
+      LiteralHeader(kNeverIndexed, ":authority", "localhost"),
+      LiteralHeader(kNeverIndexed, "content-type", "application/grpc"),
+      LiteralHeader(kNeverIndexed, "te", "trailers"), extra_fields);
+  return absl::StrCat(
+      FrameHeader(block.size(), kHeadersFrame, /*END_STREAM|END_HEADERS*/ 0x05,
+                  stream_id),
+      block);
+}
+
+// Runs a server transport with idle compaction enabled, and plays the client
+// by reading and writing raw HTTP/2 frames.
+class IdleCompactionTest : public ::testing::Test {
+ protected:
+  IdleCompactionTest() { SetupAndStart(); }
+
+  ~IdleCompactionTest() override { ShutdownAndDestroy(); }
+
+  void SetupAndStart() {
+    ExecCtx exec_ctx;
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    cqv_ = std::make_unique<CqVerifier>(cq_);
+    grpc_arg server_args[] = {
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_HTTP2_BDP_PROBE), 0),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_KEEPALIVE_TIME_MS), INT_MAX),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_HTTP2_IDLE_COMPACTION_MS), 100)};
+    grpc_channel_args server_channel_args = {GPR_ARRAY_SIZE(server_args),
+                                             server_args};
+    server_ = grpc_server_create(&server_channel_args, nullptr);
+    auto* core_server = Server::FromC(server_);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    grpc_server_start(server_);
+    fds_ = grpc_iomgr_create_endpoint_pair("fixture", nullptr);
+    auto* transport = grpc_create_chttp2_transport(
+        core_server->channel_args(), OrphanablePtr<grpc_endpoint>(fds_.server),
+        false);
+    grpc_endpoint_add_to_pollset(fds_.server, grpc_cq_pollset(cq_));
+    CHECK(core_server->SetupTransport(transport, nullptr,
+                                      core_server->channel_args()) ==
+          absl::OkStatus());
+    grpc_chttp2_transport_start_reading(transport, nullptr, nullptr, nullptr,
+                                        nullptr);
+    Notification client_poller_thread_started_notification;
+    client_poll_thread_ = std::make_unique<std::thread>(
+        [this, &client_poller_thread_started_notification]() {
+          grpc_completion_queue* client_cq =
+              grpc_completion_queue_create_for_next(nullptr);
+          {
+            ExecCtx exec_ctx;
+            grpc_endpoint_add_to_pollset(fds_.client,
+                                         grpc_cq_pollset(client_cq));
+            grpc_endpoint_add_to_pollset(fds_.server,
+                                         grpc_cq_pollset(client_cq));
+          }
+          client_poller_thread_started_notification.Notify();
+          while (!shutdown_) {
+            CHECK(grpc_completion_queue_next(
+                      client_cq, grpc_timeout_milliseconds_to_deadline(10),
+                      nullptr)
+                      .type == GRPC_QUEUE_TIMEOUT);
+          }
+          grpc_completion_queue_destroy(client_cq);
+        });
+    client_poller_thread_started_notification.WaitForNotification();
+    // Write the connection prefix and an empty settings frame.
+    Write(absl::StrCat("PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n",
+                       FrameHeader(0, kSettingsFrame, 0, 0)));
+    grpc_slice_buffer_init(&read_buffer_);
+    GRPC_CLOSURE_INIT(&on_read_done_, OnReadDone, this, nullptr);
+    GRPC_CLOSURE_INIT(&on_read_done_scheduler_, OnReadDoneScheduler, this,
+                      nullptr);
+    grpc_endpoint_read(fds_.client, &read_buffer_, &on_read_done_, false,
+                       /*min_progress_size=*/1);
+  }
+
+  void ShutdownAndDestroy() {
+    shutdown_ = true;
+    ExecCtx exec_ctx;
+    {
+      MutexLock lock(&ep_destroy_mu_);
+      grpc_endpoint_destroy(fds_.client);
+      fds_.client = nullptr;
+    }
+    ExecCtx::Get()->Flush();
+    client_poll_thread_->join();
+    CHECK(read_end_notification_.WaitForNotificationWithTimeout(
+        absl::Seconds(5)));
+    grpc_server_shutdown_and_notify(server_, cq_, Tag(1000));
+    cqv_->Expect(Tag(1000), true);
+    cqv_->Verify();
+    grpc_server_destroy(server_);
+    cqv_.reset();
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  static void OnReadDone(void* arg, grpc_error_handle error) {
+    IdleCompactionTest* self = static_cast<IdleCompactionTest*>(arg);
+    if (error.ok()) {
+      {
+        MutexLock lock(&self->mu_);
+        for (size_t i = 0; i < self->read_buffer_.count; ++i) {
+          absl::StrAppend(&self->read_bytes_,
+                          StringViewFromSlice(self->read_buffer_.slices[i]));
+        }
+        self->read_cv_.SignalAll();
+      }
+      MutexLock lock(&self->ep_destroy_mu_);
+      if (self->fds_.client != nullptr) {
+        grpc_slice_buffer_reset_and_unref(&self->read_buffer_);
+        grpc_endpoint_read(self->fds_.client, &self->read_buffer_,
+                           &self->on_read_done_scheduler_, false,
+                           /*min_progress_size=*/1);
+        return;
+      }
+    }
+    grpc_slice_buffer_destroy(&self->read_buffer_);
+    self->read_end_notification_.Notify();
+  }
+
+  // Do async hop for OnReadDone() in case grpc_endpoint_read() invokes
+  // us synchronously while we're holding the lock.
+  static void OnReadDoneScheduler(void* arg, grpc_error_handle error) {
+    IdleCompactionTest* self = static_cast<IdleCompactionTest*>(arg);
+    ExecCtx::Run(DEBUG_LOCATION, &self->on_read_done_, std::move(error));
+  }
+
+  std::string WaitForNBytes(size_t bytes) {
+    auto start_time = absl::Now();
+    MutexLock lock(&mu_);
+    while (read_bytes_.size() < bytes) {
+      EXPECT_LT(absl::Now() - start_time, absl::Seconds(60));
+      read_cv_.WaitWithTimeout(&mu_, absl::Seconds(5));
+    }
+    std::string result = read_bytes_.substr(0, bytes);
+    read_bytes_ = read_bytes_.substr(bytes);
+    return result;
+  }
+
+  Frame ReadFrame() {
+    const std::string header = WaitForNBytes(9);
+    auto byte = [&header](int i) {
+      return static_cast<uint32_t>(static_cast<uint8_t>(header[i]));
+    };
+    Frame frame;
+    frame.type = byte(3);
+    frame.flags = byte(4);
+    frame.stream_id =
+        ((byte(5) << 24) | (byte(6) << 16) | (byte(7) << 8) | byte(8)) &
+        0x7fffffffu;
+    frame.payload = WaitForNBytes((byte(0) << 16) | (byte(1) << 8) | byte(2));
+    return frame;
+  }
+
+  // Skips frames up to the next SETTINGS frame that is not an ack, acks it,
+  // and returns the settings it carried.
+  std::map<uint16_t, uint32_t> ReadAndAckSettings() {
+    while (true) {
+      Frame frame = ReadFrame();
+      if (frame.type != kSettingsFrame || (frame.flags & kAckFlag) != 0) {
+        continue;
+      }
+      std::map<uint16_t, uint32_t> settings;
+      for (size_t i = 0; i + 6 <= frame.payload.size(); i += 6) {
+        auto byte = [&frame, i](int j) {
+          return static_cast<uint32_t>(
+              static_cast<uint8_t>(frame.payload[i + j]));
+        };
+        settings[(byte(0) << 8) | byte(1)] =
+            (byte(2) << 24) | (byte(3) << 16) | (byte(4) << 8) | byte(5);
+      }
+      Write(FrameHeader(0, kSettingsFrame, kAckFlag, 0));
+      return settings;
+    }
+  }
+
+  // Skips frames up to the trailers of stream_id.
+  void ReadUntilEndOfStream(uint32_t stream_id) {
+    while (true) {
+      Frame frame = ReadFrame();
+      if (frame.type == kHeadersFrame && frame.stream_id == stream_id &&
+          (frame.flags & kEndStreamFlag) != 0) {
+        return;
+      }
+    }
+  }
+
+  // Accepts the next call on the server, and finishes it. Returns the
+  // metadata the call was received with.
+  std::map<std::string, std::string> AcceptAndFinishCall(intptr_t tag) {
+    grpc_call* call;
+    grpc_call_details call_details;
+    grpc_metadata_array request_metadata_recv;
+    grpc_call_details_init(&call_details);
+    grpc_metadata_array_init(&request_metadata_recv);
+    CHECK_EQ(grpc_server_request_call(server_, &call, &call_details,
+                                      &request_metadata_recv, cq_, cq_,
+                                      Tag(tag)),
+             GRPC_CALL_OK);
+    cqv_->Expect(Tag(tag), true);
+    cqv_->Verify();
+    std::map<std::string, std::string> metadata;
+    for (size_t i = 0; i < request_metadata_recv.count; i++) {
+      metadata.emplace(
+          std::string(StringViewFromSlice(request_metadata_recv.metadata[i].key)),
+          std::string(
+              StringViewFromSlice(request_metadata_recv.metadata[i].value)));
+    }
+    grpc_op ops[3];
+    memset(ops, 0, sizeof(ops));
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    ops[1].data.send_status_from_server.status = GRPC_STATUS_OK;
+    grpc_slice status_details = grpc_empty_slice();
+    ops[1].data.send_status_from_server.status_details = &status_details;
+    int was_cancelled = 2;
+    ops[2].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    ops[2].data.recv_close_on_server.cancelled = &was_cancelled;
+    CHECK_EQ(grpc_call_start_batch(call, ops, GPR_ARRAY_SIZE(ops),
+                                   Tag(tag + 1), nullptr),
+             GRPC_CALL_OK);
+    cqv_->Expect(Tag(tag + 1), true);
+    cqv_->Verify();
+    EXPECT_EQ(was_cancelled, 0);
+    grpc_call_unref(call);
+    grpc_metadata_array_destroy(&request_metadata_recv);
+    grpc_call_details_destroy(&call_details);
+    return metadata;
+  }
+
+  // This is a blocking call. It waits for the write callback to be invoked
+  // before returning.
+  void Write(absl::string_view bytes) {
+    ExecCtx exec_ctx;
+    grpc_slice_buffer buffer;
+    grpc_slice_buffer_init(&buffer);
+    grpc_slice_buffer_add(&buffer, grpc_slice_from_copied_buffer(
+                                       bytes.data(), bytes.size()));
+    Notification on_write_done_notification;
+    GRPC_CLOSURE_INIT(&on_write_done_, OnWriteDone,
+                      &on_write_done_notification, nullptr);
+    grpc_endpoint_write(
+        fds_.client, &buffer, &on_write_done_,
+        grpc_event_engine::experimental::EventEngine::Endpoint::WriteArgs());
+    ExecCtx::Get()->Flush();
+    CHECK(on_write_done_notification.WaitForNotificationWithTimeout(
+        absl::Seconds(5)));
+    grpc_slice_buffer_destroy(&buffer);
+  }
+
+  static void OnWriteDone(void* arg, grpc_error_handle error) {
+    if (!error.ok()) {
+      Crash(absl::StrCat("Write failed: ", error.ToString()));
+    }
+    static_cast<Notification*>(arg)->Notify();
+  }
+
+  // Held when destroying fds_.client so we know not to start another read.
+  Mutex ep_destroy_mu_;
+
+  grpc_endpoint_pair fds_;
+  grpc_server* server_ = nullptr;
+  grpc_completion_queue* cq_ = nullptr;
+  std::unique_ptr<CqVerifier> cqv_;
+  std::unique_ptr<std::thread> client_poll_thread_;
+  std::atomic<bool> shutdown_{false};
+  grpc_closure on_read_done_;
+  grpc_closure on_read_done_scheduler_;
+  Mutex mu_;
+  CondVar read_cv_;
+  Notification read_end_notification_;
+  grpc_slice_buffer read_buffer_;
+  std::string read_bytes_ ABSL_GUARDED_BY(mu_);
+  grpc_closure on_write_done_;
+};
+
+TEST_F(IdleCompactionTest, NextStreamRestoresHeaderTableSize) {
+  auto before = global_stats().Collect();
+  // The server's initial settings.
+  ReadAndAckSettings();
+  // Without streams, the transport is soon compacted, and asks us to stop
+  // indexing headers.
+  auto compacted = ReadAndAckSettings();
+  ASSERT_EQ(compacted.count(kHeaderTableSizeSetting), 1u);
+  EXPECT_EQ(compacted[kHeaderTableSizeSetting], 0u);
+  EXPECT_EQ(global_stats().Collect()->Diff(*before)->http2_idle_compactions,
+            1u);
+  // The next stream advertises the original header table size again.
+  Write(RequestFrame(1, ""));
+  auto restored = ReadAndAckSettings();
+  ASSERT_EQ(restored.count(kHeaderTableSizeSetting), 1u);
+  EXPECT_EQ(restored[kHeaderTableSizeSetting], 4096u);
+  AcceptAndFinishCall(100);
+  ReadUntilEndOfStream(1);
+  // Now that the size is acked, the header table is usable again: add an
+  // entry with incremental indexing, then refer to it by its index.
+  constexpr uint8_t kIncrementalIndexing = 0x40;
+  Write(RequestFrame(
+      3, LiteralHeader(kIncrementalIndexing, "x-tenant", "acme")));
+  EXPECT_EQ(AcceptAndFinishCall(200)["x-tenant"], "acme");
+  ReadUntilEndOfStream(3);
+  // The first dynamic table entry.
+  constexpr char kIndexedFirstDynamicEntry = static_cast<char>(0x80 | 62);
+  Write(RequestFrame(5, std::string(1, kIndexedFirstDynamicEntry)));
+  EXPECT_EQ(AcceptAndFinishCall(300)["x-tenant"], "acme");
+  ReadUntilEndOfStream(5);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -0,0 +1,160 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/read_ahead.h"
+
+#include <grpc/slice_buffer.h>
+
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using State = Chttp2ReadAhead::State;
+using Next = Chttp2ReadAhead::Next;
+
+class ReadAheadTest : public ::testing::Test {
+ protected:
+  ReadAheadTest() {
+    quota_.SetSize(kQuotaSize);
+    grpc_slice_buffer_init(&read_buffer_);
+  }
+  ~ReadAheadTest() override { grpc_slice_buffer_destroy(&read_buffer_); }
+
+  // The endpoint reads \a bytes into the read-ahead buffer.
+  static void Fill(grpc_slice_buffer* buffer, const std::string& bytes) {
+    grpc_slice_buffer_add(buffer,
+                          Slice::FromCopiedString(bytes).TakeCSlice());
+  }
+
+  // The endpoint reads \a size bytes into the read-ahead buffer, into a slice
+  // charged to the transport's memory quota.
+  void FillFromQuota(grpc_slice_buffer* buffer, size_t size) {
+    grpc_slice_buffer_add(buffer, memory_owner_.MakeSlice(MemoryRequest(size)));
+  }
+
+  std::string ReadBuffer() {
+    std::string bytes;
+    for (size_t i = 0; i < read_buffer_.count; ++i) {
+      absl::StrAppend(&bytes, StringViewFromSlice(read_buffer_.slices[i]));
+    }
+    return bytes;
+  }
+
+  double Pressure() {
+    return memory_owner_.GetPressureInfo().instantaneous_pressure;
+  }
+
+  static constexpr size_t kQuotaSize = 1024 * 1024;
+
+  MemoryQuota quota_{"read_ahead_test"};
+  MemoryOwner memory_owner_ = quota_.CreateMemoryOwner();
+  grpc_slice_buffer read_buffer_;
+  Chttp2ReadAhead read_ahead_;
+};
+
+TEST_F(ReadAheadTest, WithoutReadAheadTransportReads) {
+  grpc_error_handle error;
+  EXPECT_EQ(read_ahead_.OnParsed(&read_buffer_, &error), Next::kRead);
+  EXPECT_EQ(read_ahead_.state(), State::kIdle);
+}
+
+TEST_F(ReadAheadTest, CompletesAfterParsing) {
+  grpc_slice_buffer* buffer = read_ahead_.Start();
+  grpc_error_handle error;
+  // The parser finished the previous read first, and waits.
+  EXPECT_EQ(read_ahead_.OnParsed(&read_buffer_, &error), Next::kWait);
+  EXPECT_EQ(read_ahead_.state(), State::kWaiting);
+  Fill(buffer, "frames");
+  // The completion hands the bytes straight to the parser.
+  EXPECT_TRUE(read_ahead_.OnReadDone(absl::OkStatus(), &read_buffer_));
+  EXPECT_EQ(read_ahead_.state(), State::kIdle);
+  EXPECT_EQ(ReadBuffer(), "frames");
+}
+
+TEST_F(ReadAheadTest, CompletesBeforeParsing) {
+  grpc_slice_buffer* buffer = read_ahead_.Start();
+  FillFromQuota(buffer, kQuotaSize / 2);
+  const double pressure = Pressure();
+  EXPECT_GE(pressure, 0.5);
+  EXPECT_FALSE(read_ahead_.OnReadDone(absl::OkStatus(), &read_buffer_));
+  EXPECT_EQ(read_ahead_.state(), State::kDone);
+  // The previous read is still being parsed: the bytes wait. Their slices are
+  // already charged to the quota, so waiting does not charge them again.
+  EXPECT_EQ(read_buffer_.length, 0u);
+  EXPECT_EQ(Pressure(), pressure);
+  grpc_error_handle error;
+  EXPECT_EQ(read_ahead_.OnParsed(&read_buffer_, &error), Next::kParse);
+  EXPECT_TRUE(error.ok());
+  EXPECT_EQ(read_ahead_.state(), State::kIdle);
+  EXPECT_EQ(read_buffer_.length, kQuotaSize / 2);
+  EXPECT_EQ(Pressure(), pressure);
+}
+
+TEST_F(ReadAheadTest, ErrorIsParsedInOrder) {
+  read_ahead_.Start();
+  EXPECT_FALSE(
+      read_ahead_.OnReadDone(absl::UnavailableError("reset"), &read_buffer_));
+  grpc_error_handle error;
+  EXPECT_EQ(read_ahead_.OnParsed(&read_buffer_, &error), Next::kParse);
+  EXPECT_EQ(error, absl::UnavailableError("reset"));
+  // The next read-ahead starts without the error.
+  read_ahead_.Start();
+  EXPECT_FALSE(read_ahead_.OnReadDone(absl::OkStatus(), &read_buffer_));
+  EXPECT_EQ(read_ahead_.OnParsed(&read_buffer_, &error), Next::kParse);
+  EXPECT_TRUE(error.ok());
+}
+
+TEST_F(ReadAheadTest, ErrorWhileParserWaits) {
+  read_ahead_.Start();
+  grpc_error_handle error;
+  EXPECT_EQ(read_ahead_.OnParsed(&read_buffer_, &error), Next::kWait);
+  // The caller parses the completion's error right away.
+  EXPECT_TRUE(
+      read_ahead_.OnReadDone(absl::UnavailableError("reset"), &read_buffer_));
+  EXPECT_EQ(read_ahead_.state(), State::kIdle);
+}
+
+TEST_F(ReadAheadTest, InFlightAtClose) {
+  grpc_slice_buffer* buffer = read_ahead_.Start();
+  // The transport closes while the read is in flight: the endpoint still owns
+  // the buffer.
+  read_ahead_.Discard();
+  EXPECT_EQ(read_ahead_.state(), State::kPending);
+  Fill(buffer, "frames");
+  EXPECT_FALSE(read_ahead_.OnReadDone(absl::CancelledError(), &read_buffer_));
+  // Once it completes, the bytes are dropped.
+  read_ahead_.Discard();
+  EXPECT_EQ(read_ahead_.state(), State::kIdle);
+  EXPECT_EQ(read_buffer_.length, 0u);
+  grpc_error_handle error;
+  EXPECT_EQ(read_ahead_.OnParsed(&read_buffer_, &error), Next::kRead);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
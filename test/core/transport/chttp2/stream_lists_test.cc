@@ -0,0 +1,194 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/stream_lists.h"
+
+#include <grpc/grpc.h>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/internal_channel_arg_names.h"
+#include "src/core/ext/transport/chttp2/transport/stream_priority.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "test/core/test_util/mock_endpoint.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using Class = Http2StreamPriority::Class;
+
+class StreamListsTest : public ::testing::Test {
+ protected:
+  StreamListsTest() {
+    args_ = args_.SetObject(ResourceQuota::Default());
+    args_ = args_.SetObject(engine_);
+  }
+
+  grpc_chttp2_transport* CreateTransport(bool is_client) {
+    auto mock_endpoint_controller =
+        grpc_event_engine::experimental::MockEndpointController::Create(
+            engine_);
+    mock_endpoint_controller->NoMoreReads();
+    return reinterpret_cast<grpc_chttp2_transport*>(
+        grpc_create_chttp2_transport(
+            args_,
+            OrphanablePtr<grpc_endpoint>(
+                mock_endpoint_controller->TakeCEndpoint()),
+            is_client));
+  }
+
+  // A stream that is only ever put in the transport's stream lists.
+  class Stream {
+   public:
+    Stream(grpc_chttp2_transport* t, uint32_t id,
+           Http2StreamPriority priority) {
+      GRPC_STREAM_REF_INIT(&refcount_, 1, nullptr, nullptr, "test");
+      stream_.emplace(t, &refcount_, nullptr, arena_.get());
+      stream_->id = id;
+      stream_->write_priority = priority;
+    }
+    // The stream was never opened on the wire.
+    ~Stream() { stream_->id = 0; }
+
+    grpc_chttp2_stream* get() { return &*stream_; }
+
+   private:
+    grpc_stream_refcount refcount_;
+    RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
+    std::optional<grpc_chttp2_stream> stream_;
+  };
+
+  // Pops all writable streams, and returns their ids in order.
+  static std::vector<uint32_t> PopAll(grpc_chttp2_transport* t) {
+    std::vector<uint32_t> ids;
+    grpc_chttp2_stream* s;
+    while (grpc_chttp2_list_pop_writable_stream(t, &s)) ids.push_back(s->id);
+    return ids;
+  }
+
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_ =
+      grpc_event_engine::experimental::GetDefaultEventEngine();
+  ChannelArgs args_;
+};
+
+TEST_F(StreamListsTest, PopsWritableStreamsByPriorityClass) {
+  ExecCtx exec_ctx;
+  grpc_chttp2_transport* t = CreateTransport(/*is_client=*/true);
+  {
+    Stream low(t, 1, {Class::kLow, 1});
+    Stream normal1(t, 3, {Class::kNormal, 1});
+    Stream high(t, 5, {Class::kHigh, 1});
+    Stream normal2(t, 7, {Class::kNormal, 4});
+    for (Stream* s : {&low, &normal1, &high, &normal2}) {
+      EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t, s->get()));
+    }
+    // Adding a stream that is already writable does nothing.
+    EXPECT_FALSE(grpc_chttp2_list_add_writable_stream(t, normal1.get()));
+    EXPECT_EQ(PopAll(t), (std::vector<uint32_t>{5, 3, 7, 1}));
+    // Removal finds the stream in its class' list.
+    EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t, high.get()));
+    EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t, low.get()));
+    EXPECT_TRUE(grpc_chttp2_list_remove_writable_stream(t, high.get()));
+    EXPECT_FALSE(grpc_chttp2_list_remove_writable_stream(t, high.get()));
+    EXPECT_EQ(PopAll(t), (std::vector<uint32_t>{1}));
+  }
+  t->Orphan();
+}
+
+TEST_F(StreamListsTest, LowPriorityStreamIsNotStarved) {
+  ExecCtx exec_ctx;
+  grpc_chttp2_transport* t = CreateTransport(/*is_client=*/true);
+  {
+    Stream high(t, 1, {Class::kHigh, 1});
+    Stream low(t, 3, {Class::kLow, 1});
+    EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t, low.get()));
+    // The high priority stream stays writable, as a bulk stream would.
+    std::vector<uint32_t> ids;
+    grpc_chttp2_stream* s;
+    while (ids.size() <= Http2WritableClassScheduler::kMaxTurnsSkipped) {
+      grpc_chttp2_list_add_writable_stream(t, high.get());
+      ASSERT_TRUE(grpc_chttp2_list_pop_writable_stream(t, &s));
+      ids.push_back(s->id);
+    }
+    std::vector<uint32_t> expected(
+        Http2WritableClassScheduler::kMaxTurnsSkipped, 1);
+    expected.push_back(3);
+    EXPECT_EQ(ids, expected);
+    grpc_chttp2_list_remove_writable_stream(t, high.get());
+  }
+  t->Orphan();
+}
+
+TEST_F(StreamListsTest, ServerIgnoresStreamPriorityUnlessAccepted) {
+  ExecCtx exec_ctx;
+  grpc_metadata_batch md;
+  md.Append(Http2StreamPriority::kMetadataKey, Slice::FromStaticString("high"),
+            [](absl::string_view, const Slice&) { FAIL(); });
+  grpc_chttp2_transport* t = CreateTransport(/*is_client=*/false);
+  {
+    Stream stream(t, 1, {});
+    grpc_chttp2_set_stream_write_priority(t, stream.get(), md);
+    EXPECT_EQ(stream.get()->write_priority.priority_class, Class::kNormal);
+  }
+  t->Orphan();
+  args_ = args_.Set(GRPC_ARG_HTTP2_ACCEPT_STREAM_PRIORITY, true);
+  t = CreateTransport(/*is_client=*/false);
+  {
+    Stream stream(t, 1, {});
+    grpc_chttp2_set_stream_write_priority(t, stream.get(), md);
+    EXPECT_EQ(stream.get()->write_priority.priority_class, Class::kHigh);
+  }
+  t->Orphan();
+}
+
+TEST_F(StreamListsTest, StreamWriteQuantumIsAtLeastOneKilobyte) {
+  ExecCtx exec_ctx;
+  grpc_chttp2_transport* t = CreateTransport(/*is_client=*/true);
+  EXPECT_EQ(t->stream_write_quantum, 0u);
+  t->Orphan();
+  args_ = args_.Set(GRPC_ARG_HTTP2_STREAM_WRITE_QUANTUM_BYTES, 1);
+  t = CreateTransport(/*is_client=*/true);
+  EXPECT_EQ(t->stream_write_quantum, 1024u);
+  t->Orphan();
+  args_ = args_.Set(GRPC_ARG_HTTP2_STREAM_WRITE_QUANTUM_BYTES, 65536);
+  t = CreateTransport(/*is_client=*/true);
+  EXPECT_EQ(t->stream_write_quantum, 65536u);
+  t->Orphan();
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
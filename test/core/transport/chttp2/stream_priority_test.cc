@@ -0,0 +1,119 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/stream_priority.h"
+
+#include <array>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+using Class = Http2StreamPriority::Class;
+
+TEST(Http2StreamPriorityTest, DefaultIsNormal) {
+  Http2StreamPriority priority;
+  EXPECT_EQ(priority.priority_class, Class::kNormal);
+  EXPECT_EQ(priority.weight, 1u);
+}
+
+TEST(Http2StreamPriorityTest, ParsesClasses) {
+  EXPECT_EQ(Http2StreamPriority::Parse("high"),
+            (Http2StreamPriority{Class::kHigh, 1}));
+  EXPECT_EQ(Http2StreamPriority::Parse("normal"),
+            (Http2StreamPriority{Class::kNormal, 1}));
+  EXPECT_EQ(Http2StreamPriority::Parse(" low "),
+            (Http2StreamPriority{Class::kLow, 1}));
+}
+
+TEST(Http2StreamPriorityTest, ParsesWeight) {
+  EXPECT_EQ(Http2StreamPriority::Parse("high; weight=4"),
+            (Http2StreamPriority{Class::kHigh, 4}));
+  EXPECT_EQ(Http2StreamPriority::Parse("low;weight = 64"),
+            (Http2StreamPriority{Class::kLow, 64}));
+}
+
+TEST(Http2StreamPriorityTest, RejectsMalformedValues) {
+  EXPECT_EQ(Http2StreamPriority::Parse(""), std::nullopt);
+  EXPECT_EQ(Http2StreamPriority::Parse("urgent"), std::nullopt);
+  EXPECT_EQ(Http2StreamPriority::Parse("HIGH"), std::nullopt);
+  EXPECT_EQ(Http2StreamPriority::Parse("high;"), std::nullopt);
+  EXPECT_EQ(Http2StreamPriority::Parse("high; weight"), std::nullopt);
+  EXPECT_EQ(Http2StreamPriority::Parse("high; weight=0"), std::nullopt);
+  EXPECT_EQ(Http2StreamPriority::Parse("high; weight=65"), std::nullopt);
+  EXPECT_EQ(Http2StreamPriority::Parse("high; weight=-1"), std::nullopt);
+  EXPECT_EQ(Http2StreamPriority::Parse("high; urgency=1"), std::nullopt);
+}
+
+TEST(Http2StreamPriorityTest, WriteBudget) {
+  EXPECT_EQ((Http2StreamPriority{Class::kNormal, 1}).WriteBudget(16384),
+            16384u);
+  EXPECT_EQ((Http2StreamPriority{Class::kLow, 4}).WriteBudget(16384), 65536u);
+  // A zero quantum leaves turns unbounded, regardless of the weight.
+  EXPECT_EQ((Http2StreamPriority{Class::kHigh, 4}).WriteBudget(0),
+            std::numeric_limits<uint32_t>::max());
+  EXPECT_EQ((Http2StreamPriority{Class::kNormal, 64})
+                .WriteBudget(std::numeric_limits<uint32_t>::max()),
+            std::numeric_limits<uint32_t>::max());
+}
+
+TEST(Http2WritableClassSchedulerTest, ServesHighestWritableClass) {
+  Http2WritableClassScheduler scheduler;
+  EXPECT_EQ(scheduler.Next({false, false, false}), std::nullopt);
+  EXPECT_EQ(scheduler.Next({false, false, true}), Class::kLow);
+  EXPECT_EQ(scheduler.Next({false, true, true}), Class::kNormal);
+  EXPECT_EQ(scheduler.Next({true, true, true}), Class::kHigh);
+}
+
+TEST(Http2WritableClassSchedulerTest, LowerClassesAreNotStarved) {
+  Http2WritableClassScheduler scheduler;
+  constexpr uint32_t kRound = Http2WritableClassScheduler::kMaxTurnsSkipped + 1;
+  std::vector<Class> served;
+  for (uint32_t i = 0; i < 2 * kRound; ++i) {
+    served.push_back(*scheduler.Next({true, false, true}));
+  }
+  std::vector<Class> expected;
+  for (int round = 0; round < 2; ++round) {
+    expected.insert(expected.end(),
+                    Http2WritableClassScheduler::kMaxTurnsSkipped,
+                    Class::kHigh);
+    expected.push_back(Class::kLow);
+  }
+  EXPECT_EQ(served, expected);
+}
+
+TEST(Http2WritableClassSchedulerTest, SkippedTurnsResetWhenClassIsIdle) {
+  Http2WritableClassScheduler scheduler;
+  for (uint32_t i = 0; i < Http2WritableClassScheduler::kMaxTurnsSkipped - 1;
+       ++i) {
+    EXPECT_EQ(scheduler.Next({true, true, false}), Class::kHigh);
+  }
+  // The normal class ran out of writable streams, so it starts over when it
+  // has some again.
+  EXPECT_EQ(scheduler.Next({true, false, false}), Class::kHigh);
+  EXPECT_EQ(scheduler.Next({true, true, false}), Class::kHigh);
+  EXPECT_EQ(scheduler.Next({true, true, false}), Class::kHigh);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -15,6 +15,7 @@
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 
 #include <memory>
+#include <optional>
 
 #include "gtest/gtest.h"
 
@@ -116,6 +117,62 @@ TEST(WriteSizePolicyTest, MediumWritesJustHangOut) {
   EXPECT_EQ(policy.WriteTargetSize(), 131072);
 }
 
+TEST(WriteCoalescingPolicyTest, DisabledByDefault) {
+  Chttp2WriteCoalescingPolicy policy;
+  EXPECT_FALSE(policy.enabled());
+  EXPECT_EQ(policy.HoldUntil(1, 1, 131072), std::nullopt);
+  EXPECT_FALSE(policy.holding());
+}
+
+TEST(WriteCoalescingPolicyTest, HoldsSmallWritesUntilDeadline) {
+  ScopedTimeCache time_cache;
+  auto timestamp = [&time_cache](int i) {
+    time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                              Duration::Milliseconds(i));
+  };
+  Chttp2WriteCoalescingPolicy policy(Duration::Milliseconds(10), 0, 64);
+  timestamp(100);
+  EXPECT_EQ(policy.HoldUntil(100, 1, 131072),
+            Timestamp::ProcessEpoch() + Duration::Milliseconds(110));
+  EXPECT_TRUE(policy.holding());
+  // More frames gathered into the held write don't extend the deadline.
+  timestamp(105);
+  EXPECT_EQ(policy.HoldUntil(200, 2, 131072),
+            Timestamp::ProcessEpoch() + Duration::Milliseconds(110));
+  timestamp(110);
+  EXPECT_EQ(policy.HoldUntil(200, 2, 131072), std::nullopt);
+  EXPECT_EQ(policy.Flush(), Duration::Milliseconds(10));
+  EXPECT_FALSE(policy.holding());
+  // The next write gets a fresh deadline.
+  timestamp(200);
+  EXPECT_EQ(policy.HoldUntil(100, 1, 131072),
+            Timestamp::ProcessEpoch() + Duration::Milliseconds(210));
+}
+
+TEST(WriteCoalescingPolicyTest, FlushesLargeWrites) {
+  ScopedTimeCache time_cache;
+  Chttp2WriteCoalescingPolicy policy(Duration::Milliseconds(10), 0, 64);
+  // Without max_bytes, the write target size is the limit.
+  EXPECT_NE(policy.HoldUntil(131071, 1, 131072), std::nullopt);
+  EXPECT_EQ(policy.HoldUntil(131072, 1, 131072), std::nullopt);
+  policy.Flush();
+  Chttp2WriteCoalescingPolicy bounded_policy(Duration::Milliseconds(10), 1024,
+                                             64);
+  EXPECT_NE(bounded_policy.HoldUntil(1023, 1, 131072), std::nullopt);
+  EXPECT_EQ(bounded_policy.HoldUntil(1024, 1, 131072), std::nullopt);
+}
+
+TEST(WriteCoalescingPolicyTest, FlushesWritesWithManyFrames) {
+  ScopedTimeCache time_cache;
+  Chttp2WriteCoalescingPolicy policy(Duration::Milliseconds(10), 0, 64);
+  EXPECT_NE(policy.HoldUntil(100, 63, 131072), std::nullopt);
+  EXPECT_EQ(policy.HoldUntil(100, 64, 131072), std::nullopt);
+  policy.Flush();
+  Chttp2WriteCoalescingPolicy unlimited_policy(Duration::Milliseconds(10), 0,
+                                               0);
+  EXPECT_NE(unlimited_policy.HoldUntil(100, 100000, 131072), std::nullopt);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
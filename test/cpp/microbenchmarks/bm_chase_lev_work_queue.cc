@@ -0,0 +1,127 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the BasicWorkQueue with the ChaseLevWorkQueue in the way the work
+// stealing thread pool uses its thread-local queues: one owner thread adds and
+// pops closures at one end while other threads steal from the other end.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::AnyInvocableClosure;
+using ::grpc_event_engine::experimental::BasicWorkQueue;
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
+using ::grpc_event_engine::experimental::EventEngine;
+
+// The owner adds and pops state.range(0) closures without any thieves.
+template <typename QueueType>
+void BM_OwnerAddPopMostRecent(benchmark::State& state) {
+  QueueType queue;
+  AnyInvocableClosure closure([] {});
+  const int element_count = state.range(0);
+  for (auto _ : state) {
+    for (int i = 0; i < element_count; i++) queue.Add(&closure);
+    for (int i = 0; i < element_count; i++) {
+      CHECK_NE(queue.PopMostRecent(), nullptr);
+    }
+  }
+  state.SetItemsProcessed(element_count * state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_OwnerAddPopMostRecent, BasicWorkQueue)
+    ->Range(1, 512);
+BENCHMARK_TEMPLATE(BM_OwnerAddPopMostRecent, ChaseLevWorkQueue)
+    ->Range(1, 512);
+
+// The owner adds batches of state.range(1) closures and runs them, while
+// state.range(0) thieves continuously steal from the same queue.
+template <typename QueueType>
+void BM_OwnerWithThieves(benchmark::State& state) {
+  QueueType queue;
+  const int thief_count = state.range(0);
+  const int batch_size = state.range(1);
+  std::atomic<int> run_count{0};
+  AnyInvocableClosure closure(
+      [&run_count] { run_count.fetch_add(1, std::memory_order_relaxed); });
+  std::atomic<bool> done{false};
+  std::atomic<int64_t> steals{0};
+  std::vector<std::thread> thieves;
+  thieves.reserve(thief_count);
+  for (int i = 0; i < thief_count; i++) {
+    thieves.emplace_back([&] {
+      int64_t local_steals = 0;
+      while (!done.load(std::memory_order_relaxed)) {
+        if (EventEngine::Closure* c = queue.PopOldest()) {
+          c->Run();
+          ++local_steals;
+        }
+      }
+      steals.fetch_add(local_steals);
+    });
+  }
+  for (auto _ : state) {
+    run_count.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < batch_size; i++) queue.Add(&closure);
+    while (run_count.load(std::memory_order_relaxed) < batch_size) {
+      if (EventEngine::Closure* c = queue.PopMostRecent()) c->Run();
+    }
+  }
+  done.store(true);
+  for (auto& thief : thieves) thief.join();
+  CHECK(queue.Empty());
+  state.SetItemsProcessed(batch_size * state.iterations());
+  state.counters["stolen_pct"] =
+      100.0 * steals.load() / (batch_size * state.iterations());
+}
+
+void ThiefArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"thieves", "batch"});
+  for (int64_t thieves : {1, 3, 7}) {
+    for (int64_t batch : {16, 256}) {
+      b->Args({thieves, batch});
+    }
+  }
+  b->UseRealTime()->MeasureProcessCPUTime();
+}
+BENCHMARK_TEMPLATE(BM_OwnerWithThieves, BasicWorkQueue)->Apply(ThiefArguments);
+BENCHMARK_TEMPLATE(BM_OwnerWithThieves, ChaseLevWorkQueue)
+    ->Apply(ThiefArguments);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,110 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmarks around CHTTP2 base64 encoding and decoding of -bin metadata,
+// for each vector kernel supported by the CPU.
+
+#include <benchmark/benchmark.h>
+#include <grpc/slice.h>
+
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "absl/random/random.h"
+#include "src/core/ext/transport/chttp2/transport/base64_simd.h"
+#include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
+#include "src/core/lib/slice/slice.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using base64_simd::Kernel;
+
+constexpr Kernel kKernels[] = {Kernel::kNone, Kernel::kSsse3, Kernel::kAvx2,
+                               Kernel::kNeon};
+
+// Selects the kernel in state.range(0), and returns false if the benchmark
+// should be skipped because this CPU does not support it.
+bool UseKernel(benchmark::State& state) {
+  Kernel kernel = kKernels[state.range(0)];
+  if (!base64_simd::KernelSupported(kernel)) {
+    state.SkipWithError("kernel not supported on this CPU");
+    return false;
+  }
+  base64_simd::SetKernelForTesting(kernel);
+  state.SetLabel(base64_simd::KernelName(kernel));
+  return true;
+}
+
+Slice RandomSlice(size_t length) {
+  absl::BitGen gen;
+  MutableSlice slice = MutableSlice::CreateUninitialized(length);
+  for (uint8_t& b : slice) b = absl::Uniform<uint8_t>(gen);
+  return Slice(std::move(slice));
+}
+
+void BM_Chttp2Base64Encode(benchmark::State& state) {
+  if (!UseKernel(state)) return;
+  Slice input = RandomSlice(state.range(1));
+  for (auto _ : state) {
+    CSliceUnref(grpc_chttp2_base64_encode(input.c_slice()));
+  }
+  state.SetBytesProcessed(state.range(1) * state.iterations());
+  base64_simd::SetKernelForTesting(base64_simd::BestKernel());
+}
+
+void BM_Chttp2Base64Decode(benchmark::State& state) {
+  if (!UseKernel(state)) return;
+  Slice input = Slice(grpc_chttp2_base64_encode(
+      RandomSlice(state.range(1)).c_slice()));
+  for (auto _ : state) {
+    grpc_slice output = grpc_chttp2_base64_decode_with_length(
+        input.c_slice(), state.range(1));
+    CHECK_EQ(GRPC_SLICE_LENGTH(output), static_cast<size_t>(state.range(1)));
+    CSliceUnref(output);
+  }
+  state.SetBytesProcessed(input.size() * state.iterations());
+  base64_simd::SetKernelForTesting(base64_simd::BestKernel());
+}
+
+void KernelAndSizeArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"kernel", "size"});
+  for (size_t kernel = 0; kernel < std::size(kKernels); kernel++) {
+    for (int64_t size : {16, 64, 256, 1024, 16384}) {
+      b->Args({static_cast<int64_t>(kernel), size});
+    }
+  }
+}
+BENCHMARK(BM_Chttp2Base64Encode)->Apply(KernelAndSizeArguments);
+BENCHMARK(BM_Chttp2Base64Decode)->Apply(KernelAndSizeArguments);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
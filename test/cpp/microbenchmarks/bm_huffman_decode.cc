@@ -25,7 +25,7 @@
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/huffman_geometries/index.h"
 
-std::vector<uint8_t> MakeInput(int min, int max) {
+std::vector<uint8_t> MakeUncompressedInput(int min, int max) {
   std::vector<uint8_t> v;
   std::uniform_int_distribution<> distribution(min, max);
   static std::mt19937 rd(0);
@@ -33,7 +33,12 @@ std::vector<uint8_t> MakeInput(int min, int max) {
   for (int i = 0; i < 1024 * 1024; i++) {
     v.push_back(distribution(rd));
   }
-  grpc_core::Slice s = grpc_core::Slice::FromCopiedBuffer(v);
+  return v;
+}
+
+std::vector<uint8_t> MakeInput(int min, int max) {
+  grpc_core::Slice s =
+      grpc_core::Slice::FromCopiedBuffer(MakeUncompressedInput(min, max));
   grpc_core::Slice c(grpc_chttp2_huffman_compress(s.c_slice()));
   return std::vector<uint8_t>(c.begin(), c.end());
 }
@@ -85,6 +90,19 @@ static void BM_Decode(benchmark::State& state, CharSet chars_gen) {
 
 DECL_HUFFMAN_VARIANTS();
 
+static void BM_Encode(benchmark::State& state, int min, int max) {
+  const grpc_core::Slice input =
+      grpc_core::Slice::FromCopiedBuffer(MakeUncompressedInput(min, max));
+  for (auto _ : state) {
+    grpc_core::Slice output(grpc_chttp2_huffman_compress(input.c_slice()));
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(input.size() * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_Encode, all_chars, 0, 255);
+BENCHMARK_CAPTURE(BM_Encode, ascii_chars, 32, 126);
+BENCHMARK_CAPTURE(BM_Encode, alpha_chars, 'a', 'z');
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -25,6 +26,8 @@
 #include "absl/strings/str_format.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/useful.h"
@@ -44,6 +47,29 @@ struct FanoutParameters {
   int limit;
 };
 
+// Reports the number of closures that were stolen from other workers, and how
+// many of those crossed NUMA nodes, over the lifetime of the object.
+class StealCounters {
+ public:
+  explicit StealCounters(benchmark::State& state)
+      : state_(state), start_(grpc_core::global_stats().Collect()) {}
+  ~StealCounters() {
+    auto end = grpc_core::global_stats().Collect();
+    Report("steals", start_->thread_pool_steals, end->thread_pool_steals);
+    Report("cross_node_steals", start_->thread_pool_cross_node_steals,
+           end->thread_pool_cross_node_steals);
+  }
+
+ private:
+  void Report(const char* name, uint64_t start, uint64_t end) {
+    state_.counters[name] = benchmark::Counter(
+        end - start, benchmark::Counter::kAvgIterations);
+  }
+
+  benchmark::State& state_;
+  const std::unique_ptr<grpc_core::GlobalStats> start_;
+};
+
 void BM_ThreadPool_RunSmallLambda(benchmark::State& state) {
   auto pool = grpc_event_engine::experimental::MakeThreadPool(
       grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u));
@@ -167,6 +193,7 @@ void BM_ThreadPool_Lambda_FanOut(benchmark::State& state) {
   auto params = GetFanoutParameters(state);
   auto pool = grpc_event_engine::experimental::MakeThreadPool(
       grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u));
+  StealCounters steal_counters(state);
   for (auto _ : state) {
     std::atomic_int count{0};
     grpc_core::Notification signal;
@@ -219,6 +246,7 @@ void BM_ThreadPool_Closure_FanOut(benchmark::State& state) {
                                 params);
         }));
   }
+  StealCounters steal_counters(state);
   for (auto _ : state) {
     DCHECK_EQ(count.load(std::memory_order_relaxed), 0);
     pool->Run(closures[params.depth + 1]);
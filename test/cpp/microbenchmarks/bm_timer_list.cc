@@ -0,0 +1,164 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the heap based TimerList with the TimingWheelTimerList across
+// timer counts and cancellation ratios.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timing_wheel.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Timer;
+using ::grpc_event_engine::experimental::TimerList;
+using ::grpc_event_engine::experimental::TimerListHost;
+using ::grpc_event_engine::experimental::TimingWheelTimerList;
+
+// Deadlines are spread uniformly over this many milliseconds.
+constexpr int64_t kDeadlineSpreadMs = 10000;
+// Number of TimerCheck calls needed to expire all the timers.
+constexpr int kChecks = 100;
+
+class ManualHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override { return now_; }
+  void Kick() override {}
+
+  void Advance(grpc_core::Duration d) { now_ += d; }
+
+ private:
+  grpc_core::Timestamp now_ =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1);
+};
+
+class NoopClosure final : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+std::vector<grpc_core::Duration> RandomDelays(size_t count) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int64_t> dist(1, kDeadlineSpreadMs);
+  std::vector<grpc_core::Duration> delays;
+  delays.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    delays.push_back(grpc_core::Duration::Milliseconds(dist(rng)));
+  }
+  return delays;
+}
+
+// Arms state.range(0) timers, cancels state.range(1) percent of them, then
+// advances time until all the remaining ones have fired.
+template <typename TimerListType>
+void BM_TimerListLifecycle(benchmark::State& state) {
+  const size_t timer_count = state.range(0);
+  const size_t cancel_pct = state.range(1);
+  const std::vector<grpc_core::Duration> delays = RandomDelays(timer_count);
+  std::vector<Timer> timers(timer_count);
+  NoopClosure closure;
+  ManualHost host;
+  TimerListType timer_list(&host);
+  size_t fired = 0;
+  for (auto _ : state) {
+    const grpc_core::Timestamp start = host.Now();
+    for (size_t i = 0; i < timer_count; i++) {
+      timer_list.TimerInit(&timers[i], start + delays[i], &closure);
+    }
+    for (size_t i = 0; i < timer_count; i++) {
+      if (i % 100 < cancel_pct) CHECK(timer_list.TimerCancel(&timers[i]));
+    }
+    for (int i = 0; i < kChecks; i++) {
+      host.Advance(grpc_core::Duration::Milliseconds(kDeadlineSpreadMs) /
+                   kChecks);
+      auto expired = timer_list.TimerCheck(nullptr);
+      CHECK(expired.has_value());
+      fired += expired->size();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * timer_count);
+  state.counters["fired"] =
+      benchmark::Counter(fired, benchmark::Counter::kAvgIterations);
+}
+
+// Measures arming and cancelling one timer while state.range(0) other timers
+// are pending, the common pattern of deadlines that are rarely reached.
+template <typename TimerListType>
+void BM_TimerListInitCancel(benchmark::State& state) {
+  const size_t timer_count = state.range(0);
+  const std::vector<grpc_core::Duration> delays =
+      RandomDelays(timer_count + 1);
+  std::vector<Timer> timers(timer_count + 1);
+  NoopClosure closure;
+  ManualHost host;
+  TimerListType timer_list(&host);
+  const grpc_core::Timestamp start = host.Now();
+  for (size_t i = 0; i < timer_count; i++) {
+    timer_list.TimerInit(&timers[i], start + delays[i], &closure);
+  }
+  for (auto _ : state) {
+    timer_list.TimerInit(&timers[timer_count], start + delays[timer_count],
+                         &closure);
+    CHECK(timer_list.TimerCancel(&timers[timer_count]));
+  }
+  for (size_t i = 0; i < timer_count; i++) {
+    CHECK(timer_list.TimerCancel(&timers[i]));
+  }
+}
+
+void LifecycleArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"timers", "cancel_pct"});
+  for (int64_t timers : {1000, 10000, 100000}) {
+    for (int64_t cancel_pct : {0, 50, 90, 100}) {
+      b->Args({timers, cancel_pct});
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_TimerListLifecycle, TimerList)
+    ->Apply(LifecycleArguments);
+BENCHMARK_TEMPLATE(BM_TimerListLifecycle, TimingWheelTimerList)
+    ->Apply(LifecycleArguments);
+BENCHMARK_TEMPLATE(BM_TimerListInitCancel, TimerList)
+    ->RangeMultiplier(10)
+    ->Range(1, 100000);
+BENCHMARK_TEMPLATE(BM_TimerListInitCancel, TimingWheelTimerList)
+    ->RangeMultiplier(10)
+    ->Range(1, 100000);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -14,6 +14,7 @@
 
 #include <openssl/sha.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <fstream>
@@ -489,9 +490,11 @@ class FunMaker;
 
 class BuildCtx {
  public:
-  BuildCtx(std::vector<int> max_bits_for_depth, Sink* global_fns,
-           Sink* global_decls, Sink* global_values, FunMaker* fun_maker)
+  BuildCtx(std::vector<int> max_bits_for_depth, bool multi_symbol_nested,
+           Sink* global_fns, Sink* global_decls, Sink* global_values,
+           FunMaker* fun_maker)
       : max_bits_for_depth_(std::move(max_bits_for_depth)),
+        multi_symbol_nested_(multi_symbol_nested),
         global_fns_(global_fns),
         global_decls_(global_decls),
         global_values_(global_values),
@@ -528,6 +531,9 @@ class BuildCtx {
                    std::map<std::optional<int>, int>* cases);
 
   const std::vector<int> max_bits_for_depth_;
+  // If true, steps below the top one keep decoding symbols after finishing
+  // the one they were started for, like the top step always does.
+  const bool multi_symbol_nested_;
   std::map<Hash, std::string> arrays_;
   int next_id_ = 1;
   Sink* const global_fns_;
@@ -1410,13 +1416,20 @@ void BuildCtx::AddStep(SymSet start_syms, int num_bits, bool is_top,
                         ";"));
   std::map<MatchCase, int> match_cases;
   for (int i = 0; i < (1 << num_bits); i++) {
-    auto actions = ActionsFor(BitQueue(i, num_bits), start_syms, is_top);
+    auto actions = ActionsFor(BitQueue(i, num_bits), start_syms,
+                              is_top || multi_symbol_nested_);
     auto add_case = [&match_cases](MatchCase match_case) {
       if (match_cases.find(match_case) == match_cases.end()) {
         match_cases[match_case] = match_cases.size();
       }
       return match_cases[match_case];
     };
+    // EOS is 30 bits long, longer than any step: nothing can be decoded in
+    // the same step before it.
+    if (std::count(actions.emit.begin(), actions.emit.end(), 256) != 0 &&
+        actions.emit.size() != 1) {
+      abort();
+    }
     if (actions.emit.size() == 1 && actions.emit[0] == 256) {
       table_builder.Add(add_case(End{}), {}, actions.consumed);
     } else if (actions.consumed == 0) {
@@ -1496,7 +1509,8 @@ struct FileSet {
 
   explicit FileSet(std::string base_name) : base_name(base_name) {}
   void AddFrontMatter(int copyright_year);
-  void AddBuild(std::vector<int> max_bits_for_depth, bool selected_version);
+  void AddBuild(std::vector<int> max_bits_for_depth, bool multi_symbol_nested,
+                bool selected_version);
   void AddTailMatter();
 };
 
@@ -1526,7 +1540,7 @@ void FileSet::AddTailMatter() {
 // Given max_bits_for_depth = {n1,n2,n3,...}
 // Build a decoder that first considers n1 bits, then n2, then n3, ...
 void FileSet::AddBuild(std::vector<int> max_bits_for_depth,
-                       bool selected_version) {
+                       bool multi_symbol_nested, bool selected_version) {
   auto hdr = std::make_unique<Sink>();
   auto src = std::make_unique<Sink>();
   src->Add(absl::StrCat("#include \"", base_name, ".h\""));
@@ -1538,7 +1552,8 @@ void FileSet::AddBuild(std::vector<int> max_bits_for_depth,
   src->Add("namespace grpc_core {");
   std::string ns;
   if (!selected_version) {
-    ns = absl::StrCat("geometry_", absl::StrJoin(max_bits_for_depth, "_"));
+    ns = absl::StrCat("geometry_", absl::StrJoin(max_bits_for_depth, "_"),
+                      multi_symbol_nested ? "_multi" : "");
     hdr->Add(absl::StrCat("namespace ", ns, " {"));
     src->Add(absl::StrCat("namespace ", ns, " {"));
   }
@@ -1565,8 +1580,8 @@ void FileSet::AddBuild(std::vector<int> max_bits_for_depth,
     src->Add("}  // namespace geometry");
   }
   src->Add("}  // namespace grpc_core");
-  BuildCtx ctx(std::move(max_bits_for_depth), global_fns, global_decls,
-               global_values, &fun_maker);
+  BuildCtx ctx(std::move(max_bits_for_depth), multi_symbol_nested, global_fns,
+               global_decls, global_values, &fun_maker);
   // constructor
   pub->Add(
       "HuffDecoder(F sink, const uint8_t* begin, const uint8_t* end) : "
@@ -1665,12 +1680,17 @@ void GenMicrobenchmarks() {
   }
   int r = 0;
   for (const auto& perm : PermutationBuilder(3).Run()) {
-    int shard = r++ % kNumShards;
-    threads.emplace(
-        [perm, fileset = results[shard].get(), mu = &results_mutexes[shard]] {
-          std::lock_guard<std::mutex> lock(*mu);
-          fileset->AddBuild(perm, false);
-        });
+    // Every geometry is built twice: decoding one symbol per step below the
+    // top step, and decoding as many as fit in each step.
+    for (bool multi_symbol_nested : {false, true}) {
+      int shard = r++ % kNumShards;
+      threads.emplace([perm, multi_symbol_nested,
+                       fileset = results[shard].get(),
+                       mu = &results_mutexes[shard]] {
+        std::lock_guard<std::mutex> lock(*mu);
+        fileset->AddBuild(perm, multi_symbol_nested, false);
+      });
+    }
   }
   while (!threads.empty()) {
     threads.front().join();
@@ -1706,7 +1726,7 @@ void GenMicrobenchmarks() {
 void GenSelected() {
   FileSet selected("src/core/ext/transport/chttp2/transport/decode_huff");
   selected.AddFrontMatter(2023);
-  selected.AddBuild(std::vector<int>({15, 7, 8}), true);
+  selected.AddBuild(std::vector<int>({15, 7, 8}), false, true);
   selected.AddTailMatter();
   WriteFile(selected.base_name + ".h", selected.header);
   WriteFile(selected.base_name + ".cc", selected.source);